@@ -0,0 +1,160 @@
+/*** INCLUDES ***/
+#include "Settings.h"
+#include "ArtNetReceiver.h"
+#include "E131Frame.h"
+#include "PacketPool.h"
+#include "Realtime.h"
+
+#ifdef INCLUDE_REALTIME_ARTNET
+
+#ifdef BOARD_ESP32
+  #include <AsyncUDP.h>
+#endif //BOARD_ESP32
+
+/*** DEFINES ***/
+#define ARTNET_OPCODE_DMX           0x5000
+#define ARTNET_OPCODE_SYNC          0x5200
+#define ARTNET_MIN_VERSION          14
+#define ARTNET_MAX_SLOTS            512
+#define ARTNET_SYNC_ADDRESS         0xffff  // for E131Frame, E1.31 synchronization addresses end at 63999
+
+/*** PRIVATE VARIABLES ***/
+static const uint8_t c_ArtNetId[8] = {'A', 'r', 't', '-', 'N', 'e', 't', 0};
+
+static ArtNetReceiverStats s_Stats;
+
+static bool s_Synchronized = false;               // the sender uses ArtSync
+static unsigned long s_LastSyncUs = 0;
+
+#ifdef BOARD_ESP32
+static AsyncUDP s_Udp;
+#endif //BOARD_ESP32
+
+/*** FORWARD DECLARATIONS ***/
+#ifdef BOARD_ESP32
+static void ArtNetReceiver_OnPacket(AsyncUDPPacket &inPacket);
+#endif //BOARD_ESP32
+
+/*** PUBLIC FUNCTIONS ***/
+bool ArtNetReceiver_Begin()
+{
+  s_Synchronized = false;
+#ifdef BOARD_ESP32
+  // broadcast and unicast
+  if (!s_Udp.listen(ARTNET_PORT))
+  {
+    return false;
+  }
+  s_Udp.onPacket(ArtNetReceiver_OnPacket);
+  return true;
+#else
+  return false;
+#endif //BOARD_ESP32
+}
+
+void ArtNetReceiver_Stop()
+{
+#ifdef BOARD_ESP32
+  s_Udp.close();
+#endif //BOARD_ESP32
+}
+
+void ArtNetReceiver_Process(const uint8_t *inData, uint16_t inLength, const RealtimeOutput *inOutput)
+{
+  s_Stats.Packets++;
+  s_Stats.Bytes += inLength;
+
+  // ID, OpCode (little endian) and protocol version
+  if ((inLength < 12) || (memcmp(inData, c_ArtNetId, sizeof(c_ArtNetId)) != 0))
+  {
+    s_Stats.Invalid++;
+    return;
+  }
+  uint16_t lvOpCode = inData[8] | ((uint16_t)inData[9] << 8);
+  if ((lvOpCode != ARTNET_OPCODE_DMX) && (lvOpCode != ARTNET_OPCODE_SYNC))
+  {
+    s_Stats.Ignored++;
+    return;
+  }
+  if (Realtime_Read16(&inData[10]) < ARTNET_MIN_VERSION)
+  {
+    s_Stats.Invalid++;
+    return;
+  }
+
+  unsigned long lvNowUs = micros();
+  if (lvOpCode == ARTNET_OPCODE_SYNC)
+  {
+    if (inLength < ARTNET_SYNC_LENGTH)
+    {
+      s_Stats.Invalid++;
+      return;
+    }
+    s_Stats.Sync++;
+    s_Synchronized = true;
+    s_LastSyncUs = lvNowUs;
+    E131Frame_Sync(ARTNET_SYNC_ADDRESS);
+    return;
+  }
+
+  // ArtDmx
+  uint16_t lvLength = (inLength >= ARTNET_DMX_HEADER_LENGTH) ? Realtime_Read16(&inData[16]) : 0;
+  if ((lvLength < 2) || (lvLength > ARTNET_MAX_SLOTS) || ((ARTNET_DMX_HEADER_LENGTH + lvLength) > inLength))
+  {
+    s_Stats.Invalid++;
+    return;
+  }
+  uint16_t lvPortAddress = ((uint16_t)(inData[15] & 0x7f) << 8) | inData[14];
+  if ((lvPortAddress < ARTNET_UNIVERSE_START) || (lvPortAddress >= (ARTNET_UNIVERSE_START + E131_UNIVERSE_COUNT)))
+  {
+    return;
+  }
+  if (s_Synchronized && ((lvNowUs - s_LastSyncUs) >= ARTNET_SYNC_TIMEOUT_US))
+  {
+    s_Synchronized = false;
+  }
+
+  RealtimeUniverse lvUniverse;
+  lvUniverse.Index = lvPortAddress - ARTNET_UNIVERSE_START;
+  lvUniverse.Sequence = (inData[12] == 0) ? E131_FRAME_NO_SEQUENCE : inData[12];
+  lvUniverse.SyncAddress = s_Synchronized ? ARTNET_SYNC_ADDRESS : 0;
+  lvUniverse.Slots = &inData[ARTNET_DMX_HEADER_LENGTH];
+  lvUniverse.NumSlots = lvLength;
+  Realtime_StoreUniverse(&lvUniverse, inOutput);
+}
+
+const ArtNetReceiverStats *ArtNetReceiver_GetStats()
+{
+  return &s_Stats;
+}
+
+void ArtNetReceiver_ClearStats()
+{
+  memset(&s_Stats, 0, sizeof(s_Stats));
+}
+
+void ArtNetReceiver_PrintStats()
+{
+  Serial.print(F("Art-Net Packets: "));
+  Serial.print(s_Stats.Packets);
+  Serial.print(F("; Bytes: "));
+  Serial.print(s_Stats.Bytes);
+  Serial.print(F("; Invalid: "));
+  Serial.print(s_Stats.Invalid);
+  Serial.print(F("; Ignored: "));
+  Serial.print(s_Stats.Ignored);
+  Serial.print(F("; Sync: "));
+  Serial.println(s_Stats.Sync);
+}
+
+/*** PRIVATE FUNCTIONS ***/
+
+#ifdef BOARD_ESP32
+// Runs in the AsyncUDP task: only the copy into the pool, the packet is parsed in loop()
+static void ArtNetReceiver_OnPacket(AsyncUDPPacket &inPacket)
+{
+  PacketPool_Put(inPacket.data(), inPacket.length(), REALTIME_PROTOCOL_ARTNET);
+}
+#endif //BOARD_ESP32
+
+#endif //INCLUDE_REALTIME_ARTNET
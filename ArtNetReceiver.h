@@ -0,0 +1,42 @@
+#ifndef ARTNETRECEIVER_H
+#define ARTNETRECEIVER_H
+
+/*** INCLUDES ***/
+#include "Settings.h"
+#include "Realtime.h"
+
+/*** DEFINES ***/
+#define ARTNET_PORT               6454
+#define ARTNET_DMX_HEADER_LENGTH  18
+#define ARTNET_SYNC_LENGTH        14
+#define ARTNET_SYNC_TIMEOUT_US    4000000UL // Art-Net 4: without ArtSync for 4 s, frames are not synchronized anymore
+
+// Port-address (net, sub-net, universe) of the strip's first universe. Port-addresses count from 0 and E1.31
+// universes from 1, so port-address 0 is universe 1, as most senders map them.
+#ifndef ARTNET_UNIVERSE_START
+  #define ARTNET_UNIVERSE_START   (E131_UNIVERSE_START - 1)
+#endif //ARTNET_UNIVERSE_START
+
+/*** TYPE DEFINITIONS ***/
+typedef struct
+{
+  unsigned long Packets;
+  unsigned long Bytes;                    // UDP payload of the packets
+  unsigned long Invalid;                  // not Art-Net
+  unsigned long Ignored;                  // other Art-Net packets, e.g. ArtPoll
+  unsigned long Sync;
+} ArtNetReceiverStats;
+
+/*** PUBLIC FUNCTIONS ***/
+// ArtDmx universes of the strip are assembled into frames like E1.31 universes, ArtSync presents them
+bool ArtNetReceiver_Begin(void);
+void ArtNetReceiver_Stop(void);
+
+// Decodes a datagram from the PacketPool into the frame
+void ArtNetReceiver_Process(const uint8_t *inData, uint16_t inLength, const RealtimeOutput *inOutput);
+
+const ArtNetReceiverStats *ArtNetReceiver_GetStats(void);
+void ArtNetReceiver_ClearStats(void);
+void ArtNetReceiver_PrintStats(void);
+
+#endif //ARTNETRECEIVER_H
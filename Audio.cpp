@@ -0,0 +1,572 @@
+/*** INCLUDES ***/
+#include "Settings.h"
+#include "Audio.h"
+#include "AudioBus.h"
+
+#ifdef INCLUDE_PROGRAM_SOUND
+
+#if defined(BOARD_ESP32)
+  #include <driver/i2s.h>
+  #include <driver/adc.h>
+  #define AUDIO_CAPTURE_I2S         // DMA from the built-in ADC, analysis on a task
+#elif defined(__AVR__)
+  #define AUDIO_CAPTURE_ADC_ISR     // free running ADC interrupt, analysis in Audio_GetFrame()
+  #define AUDIO_USE_FHT             // fixed point FHT, no floating point on an 8 bit core
+#endif
+
+#ifdef AUDIO_USE_FHT
+  #define OCTAVE 1    // Group buckets into octaves  (use the log output function LOG_OUT 1)
+  #define OCT_NORM 0  // Don't normalise octave intensities by number of bins
+  #define FHT_N AUDIO_FFT_SIZE
+  #include <FHT.h>    // include the library
+#else
+  #include <math.h>
+#endif //AUDIO_USE_FHT
+
+/*** DEFINES ***/
+#define AUDIO_FULL_SCALE_BITS   16          // samples are scaled to 16 bit signed before the window, like the FHT input
+#define AUDIO_WAV_ADC_BITS      12          // WAV samples are converted to 12 bit ADC counts, like the ESP32 capture
+#define AUDIO_DMA_BUFFERS       4           // one block each
+#define AUDIO_READ_TIMEOUT_MS   100
+#define AUDIO_ISR_IDLE          0xffff      // s_SampleCount while the capture is stopped
+
+/*** PRIVATE VARIABLES ***/
+// constants, measured with MEASURE_NOISE_FLOOR in Program_Sound.cpp
+static const uint8_t c_NoiseCorrection[AUDIO_NUM_BANDS] = {63, 80, 94, 102, 106, 107, 106, 103};
+static const uint8_t c_Threshold = 32;
+static const uint8_t c_Gain = 2;
+
+static AudioStats s_Stats;
+static AudioFrame s_Frame;                  // latest published frame
+static uint8_t s_Users = 0;                 // Audio_Start() calls without Audio_Stop()
+
+#ifdef AUDIO_USE_FHT
+static int16_t *const s_Block = fht_input;  // the ISR samples straight into the FHT buffer
+#else
+static int16_t s_Block[AUDIO_FFT_SIZE];
+static float s_Re[AUDIO_FFT_SIZE];
+static float s_Im[AUDIO_FFT_SIZE];
+static float s_Window[AUDIO_FFT_SIZE];      // Hann
+static float s_Cos[AUDIO_FFT_SIZE / 2];     // twiddle factors
+static float s_Sin[AUDIO_FFT_SIZE / 2];
+static bool s_TablesReady = false;
+#endif //AUDIO_USE_FHT
+
+#ifdef AUDIO_CAPTURE_I2S
+// s_Frame is written by the capture task on AUDIO_TASK_CORE and copied by loop() under s_FrameLock
+static portMUX_TYPE s_FrameLock = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t s_CaptureTask = NULL;
+static QueueHandle_t s_I2SEvents = NULL;
+static volatile bool s_Running = false;
+static volatile bool s_TaskIdle = true;     // the task waits for Audio_Start() and publishes nothing
+#endif //AUDIO_CAPTURE_I2S
+
+#ifdef AUDIO_CAPTURE_ADC_ISR
+// The ISR owns s_Block while s_SampleCount < AUDIO_FFT_SIZE, loop() owns it when the block is full
+static volatile uint16_t s_SampleCount = AUDIO_ISR_IDLE;
+static volatile uint16_t s_DroppedSamples = 0;
+static volatile unsigned long s_BlockEndUs = 0;
+#endif //AUDIO_CAPTURE_ADC_ISR
+
+/*** FORWARD DECLARATIONS ***/
+static void Audio_Octaves(int16_t *ioSamples, uint8_t *outOctaves);
+#if defined(AUDIO_CAPTURE_I2S) || defined(AUDIO_CAPTURE_ADC_ISR)
+static void Audio_Publish(const AudioFrame *inFrame, unsigned long inBlockEndUs, unsigned long inAnalysisUs);
+#endif
+#ifndef AUDIO_USE_FHT
+static void Audio_InitTables(void);
+static void Audio_Fft(float *ioRe, float *ioIm);
+#endif //AUDIO_USE_FHT
+#ifdef AUDIO_CAPTURE_I2S
+static void Audio_CaptureTask(void *inParam);
+#endif //AUDIO_CAPTURE_I2S
+static uint16_t Audio_Read16(const uint8_t *inData);
+static uint32_t Audio_Read32(const uint8_t *inData);
+
+/*** PUBLIC FUNCTIONS ***/
+// Every program that uses the audio starts the capture, it runs until the last one stops it
+bool Audio_Start()
+{
+  if (s_Users > 0)
+  {
+    s_Users++;
+    return true;
+  }
+#if defined(AUDIO_CAPTURE_I2S) || defined(AUDIO_CAPTURE_ADC_ISR)
+  AudioBus_Reset();
+#endif
+#ifdef AUDIO_CAPTURE_I2S
+  portENTER_CRITICAL(&s_FrameLock);
+  s_Frame.Sequence = 0;
+  portEXIT_CRITICAL(&s_FrameLock);
+
+  if (s_CaptureTask == NULL)
+  {
+    // The driver and the task stay installed, Audio_Stop() only stops the sampling
+    i2s_config_t lvConfig = {};
+    lvConfig.mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_RX | I2S_MODE_ADC_BUILT_IN);
+    lvConfig.sample_rate = AUDIO_SAMPLE_RATE;
+    lvConfig.bits_per_sample = I2S_BITS_PER_SAMPLE_16BIT;
+    lvConfig.channel_format = I2S_CHANNEL_FMT_ONLY_LEFT;
+    lvConfig.communication_format = I2S_COMM_FORMAT_I2S_MSB;
+    lvConfig.dma_buf_count = AUDIO_DMA_BUFFERS;
+    lvConfig.dma_buf_len = AUDIO_FFT_SIZE;
+    if (i2s_driver_install(I2S_NUM_0, &lvConfig, AUDIO_DMA_BUFFERS, &s_I2SEvents) != ESP_OK)
+    {
+      return false;
+    }
+    i2s_set_adc_mode(ADC_UNIT_1, AUDIO_ADC_CHANNEL);
+    if (xTaskCreatePinnedToCore(Audio_CaptureTask, "Audio", AUDIO_TASK_STACK_SIZE, NULL, AUDIO_TASK_PRIORITY, &s_CaptureTask, AUDIO_TASK_CORE) != pdPASS)
+    {
+      s_CaptureTask = NULL;
+      i2s_driver_uninstall(I2S_NUM_0);
+      s_I2SEvents = NULL;
+      return false;
+    }
+  }
+  else
+  {
+    i2s_start(I2S_NUM_0);
+  }
+  i2s_adc_enable(I2S_NUM_0);
+  s_Running = true;
+  xTaskNotifyGive(s_CaptureTask);
+  s_Users++;
+  return true;
+#elif defined(AUDIO_CAPTURE_ADC_ISR)
+  s_Frame.Sequence = 0;
+  s_SampleCount = 0;
+  ADMUX = 0x40;   // use adc0
+  DIDR0 = 0x01;   // turn off the digital input for adc0
+  ADCSRB = 0;     // free running
+  ADCSRA = 0xed;  // enable, start, auto trigger, interrupt, prescaler 32
+  s_Users++;
+  return true;
+#else
+  return false;
+#endif
+}
+
+void Audio_Stop()
+{
+  if ((s_Users == 0) || (--s_Users > 0))
+  {
+    return;
+  }
+#ifdef AUDIO_CAPTURE_I2S
+  if (s_Running)
+  {
+    s_Running = false;
+    i2s_adc_disable(I2S_NUM_0);
+    i2s_stop(I2S_NUM_0);
+    // the task may still be in a read or a publish, the next AudioBus_Reset() must be the only writer of the bus
+    while (!s_TaskIdle)
+    {
+      delay(1);
+    }
+  }
+#elif defined(AUDIO_CAPTURE_ADC_ISR)
+  ADCSRA = 0;  // disable ADC
+  s_SampleCount = AUDIO_ISR_IDLE;
+#endif
+}
+
+// Called every loop: on AVR boards the analysis of a complete block runs here, in loop() instead of the ISR
+void Audio_Tick()
+{
+#ifdef AUDIO_CAPTURE_ADC_ISR
+  if (s_SampleCount == AUDIO_FFT_SIZE)
+  {
+    // block complete, the ISR drops samples until it is re-armed
+    AudioFrame lvFrame;
+    unsigned long lvStartUs = micros();
+    Audio_Analyze(s_Block, 10, &lvFrame);
+    lvFrame.Sequence = s_Frame.Sequence + 1;
+    Audio_Publish(&lvFrame, s_BlockEndUs, micros() - lvStartUs);
+    cli();
+    s_Stats.Overruns += s_DroppedSamples;
+    s_DroppedSamples = 0;
+    s_SampleCount = 0;
+    sei();
+  }
+#endif //AUDIO_CAPTURE_ADC_ISR
+}
+
+bool Audio_GetFrame(AudioFrame *outFrame)
+{
+  Audio_Tick();
+#ifdef AUDIO_CAPTURE_I2S
+  portENTER_CRITICAL(&s_FrameLock);
+  *outFrame = s_Frame;
+  portEXIT_CRITICAL(&s_FrameLock);
+#else
+  *outFrame = s_Frame;
+#endif //AUDIO_CAPTURE_I2S
+  return outFrame->Sequence != 0;
+}
+
+// DC removal, window, FFT and octave binning of one block, then the noise correction of Program_Sound
+void Audio_Analyze(int16_t *ioSamples, uint8_t inAdcBits, AudioFrame *outFrame)
+{
+  int32_t lvSum = 0;
+  int16_t lvMin = ioSamples[0];
+  int16_t lvMax = ioSamples[0];
+  uint16_t lvResultSum = 0;
+
+  for (uint16_t i = 0; i < AUDIO_FFT_SIZE; i++)
+  {
+    int16_t lvSample = ioSamples[i];
+    lvSum += lvSample;
+    lvMin = min(lvMin, lvSample);
+    lvMax = max(lvMax, lvSample);
+  }
+  // subtract the block mean as baseline offset and form into a 16b signed int
+  int16_t lvMean = lvSum / AUDIO_FFT_SIZE;
+  uint8_t lvShift = AUDIO_FULL_SCALE_BITS - inAdcBits;
+  for (uint16_t i = 0; i < AUDIO_FFT_SIZE; i++)
+  {
+    int32_t lvSample = (int32_t)(ioSamples[i] - lvMean) << lvShift;
+    ioSamples[i] = constrain(lvSample, -32768L, 32767L);
+  }
+  outFrame->PeakPeak = lvMax - lvMin;
+
+  Audio_Octaves(ioSamples, outFrame->Octaves);
+
+  for (uint8_t i = 0; i < AUDIO_NUM_BANDS; i++)
+  {
+    int16_t lvTemp = (int16_t)outFrame->Octaves[i] - c_NoiseCorrection[i];
+    if (lvTemp < c_Threshold)
+    {
+      lvTemp = 0;
+    }
+    else
+    {
+      lvTemp -= c_Threshold;
+      lvTemp = constrain(lvTemp * c_Gain, 0, 255);
+    }
+    outFrame->Bands[i] = (uint8_t)lvTemp;
+    lvResultSum += outFrame->Bands[i];
+  }
+  outFrame->Level = constrain(lvResultSum, 0, 255);
+  outFrame->Sequence = 0;
+}
+
+// Not while the capture runs: the WAV samples go through the capture block buffer
+bool Audio_AnalyzeWav(const uint8_t *inWav, uint32_t inLength, AudioFrameFcn inFrameFcn, AudioWavStats *outStats)
+{
+  const uint8_t *lvData = NULL;
+  uint32_t lvDataLength = 0;
+  uint16_t lvChannels = 0;
+  uint32_t lvPos = 12;
+  AudioFrame lvFrame;
+
+  memset(outStats, 0, sizeof(AudioWavStats));
+  if ((inLength < 12) || (memcmp(inWav, "RIFF", 4) != 0) || (memcmp(&inWav[8], "WAVE", 4) != 0))
+  {
+    return false;
+  }
+  // chunks: 4 byte id, 4 byte length, data padded to an even length
+  while ((lvPos + 8) <= inLength)
+  {
+    const uint8_t *lvChunk = &inWav[lvPos + 8];
+    uint32_t lvChunkLength = min(Audio_Read32(&inWav[lvPos + 4]), inLength - lvPos - 8);
+
+    if ((memcmp(&inWav[lvPos], "fmt ", 4) == 0) && (lvChunkLength >= 16))
+    {
+      if ((Audio_Read16(&lvChunk[0]) != 1) || (Audio_Read16(&lvChunk[14]) != 16))
+      {
+        return false;   // not 16 bit PCM
+      }
+      lvChannels = Audio_Read16(&lvChunk[2]);
+      outStats->SampleRate = Audio_Read32(&lvChunk[4]);
+    }
+    else if (memcmp(&inWav[lvPos], "data", 4) == 0)
+    {
+      lvData = lvChunk;
+      lvDataLength = lvChunkLength;
+    }
+    lvPos += 8 + ((lvChunkLength + 1) & ~1UL);
+  }
+  if ((lvData == NULL) || (lvChannels == 0) || (outStats->SampleRate == 0))
+  {
+    return false;
+  }
+
+  uint32_t lvFrameBytes = 2UL * lvChannels;
+  uint32_t lvNumSamples = lvDataLength / lvFrameBytes;
+  for (uint32_t lvStart = 0; (lvStart + AUDIO_FFT_SIZE) <= lvNumSamples; lvStart += AUDIO_FFT_SIZE)
+  {
+    // downmix to mono, then to ADC counts like the capture delivers them
+    for (uint16_t i = 0; i < AUDIO_FFT_SIZE; i++)
+    {
+      const uint8_t *lvSample = &lvData[(lvStart + i) * lvFrameBytes];
+      int32_t lvMix = 0;
+      for (uint16_t c = 0; c < lvChannels; c++)
+      {
+        lvMix += (int16_t)Audio_Read16(&lvSample[c * 2]);
+      }
+      lvMix /= lvChannels;
+      s_Block[i] = (lvMix >> (AUDIO_FULL_SCALE_BITS - AUDIO_WAV_ADC_BITS)) + (1 << (AUDIO_WAV_ADC_BITS - 1));
+    }
+
+    unsigned long lvStartUs = micros();
+    Audio_Analyze(s_Block, AUDIO_WAV_ADC_BITS, &lvFrame);
+    unsigned long lvAnalysisUs = micros() - lvStartUs;
+
+    outStats->Blocks++;
+    lvFrame.Sequence = outStats->Blocks;
+    outStats->TotalUs += lvAnalysisUs;
+    outStats->MaxUs = max(outStats->MaxUs, lvAnalysisUs);
+    if (inFrameFcn != NULL)
+    {
+      inFrameFcn(&lvFrame);
+    }
+  }
+  outStats->AudioUs = (unsigned long)(((uint64_t)outStats->Blocks * AUDIO_FFT_SIZE * 1000000UL) / outStats->SampleRate);
+  return true;
+}
+
+const AudioStats *Audio_GetStats()
+{
+  return &s_Stats;
+}
+
+void Audio_ClearStats()
+{
+  memset(&s_Stats, 0, sizeof(s_Stats));
+}
+
+void Audio_PrintStats()
+{
+  Serial.print(F("Audio Blocks: "));
+  Serial.print(s_Stats.Blocks);
+  Serial.print(F("; Overruns: "));
+  Serial.print(s_Stats.Overruns);
+  Serial.print(F("; Analysis: "));
+  Serial.print(s_Stats.AnalysisUs);
+  Serial.print(F("us (max "));
+  Serial.print(s_Stats.MaxAnalysisUs);
+  Serial.print(F("us); Latency: "));
+  Serial.print(s_Stats.LatencyUs);
+  Serial.println(F("us"));
+}
+
+/*** PRIVATE FUNCTIONS ***/
+
+#ifdef AUDIO_USE_FHT
+// ioSamples: 16 bit signed, the FHT runs in place in fht_input
+static void Audio_Octaves(int16_t *ioSamples, uint8_t *outOctaves)
+{
+  if (ioSamples != fht_input)
+  {
+    memcpy(fht_input, ioSamples, sizeof(fht_input));
+  }
+  fht_window();     // window the data for better frequency response
+  fht_reorder();    // reorder the data before doing the fht
+  fht_run();        // process the data in the fht
+  fht_mag_octave();
+  memcpy(outOctaves, fht_oct_out, AUDIO_NUM_BANDS);
+}
+#else
+// ioSamples: 16 bit signed. Same bins and log scale as fht_mag_octave(): 8 * log2 of the summed power of the bins
+// 0, 1, 2-3, .. 64-127, with the FFT output scaled by 1/N like the FHT.
+static void Audio_Octaves(int16_t *ioSamples, uint8_t *outOctaves)
+{
+  Audio_InitTables();
+  for (uint16_t i = 0; i < AUDIO_FFT_SIZE; i++)
+  {
+    s_Re[i] = ioSamples[i] * s_Window[i];
+    s_Im[i] = 0;
+  }
+  Audio_Fft(s_Re, s_Im);
+
+  uint16_t lvBin = 0;
+  for (uint8_t lvOctave = 0; lvOctave < AUDIO_NUM_BANDS; lvOctave++)
+  {
+    uint16_t lvEnd = 1 << lvOctave;
+    float lvPower = 0;
+    for (; lvBin < lvEnd; lvBin++)
+    {
+      lvPower += (s_Re[lvBin] * s_Re[lvBin]) + (s_Im[lvBin] * s_Im[lvBin]);
+    }
+    float lvLog = (lvPower >= 1.0f) ? (8.0f * log2f(lvPower)) : 0;
+    outOctaves[lvOctave] = (uint8_t)min(lvLog, 255.0f);
+  }
+}
+
+static void Audio_InitTables()
+{
+  if (s_TablesReady)
+  {
+    return;
+  }
+  for (uint16_t i = 0; i < AUDIO_FFT_SIZE; i++)
+  {
+    // window and 1/N scaling in one multiply
+    s_Window[i] = (0.5f - 0.5f * cosf(2.0f * (float)M_PI * i / AUDIO_FFT_SIZE)) / AUDIO_FFT_SIZE;
+  }
+  for (uint16_t i = 0; i < (AUDIO_FFT_SIZE / 2); i++)
+  {
+    s_Cos[i] = cosf(2.0f * (float)M_PI * i / AUDIO_FFT_SIZE);
+    s_Sin[i] = sinf(2.0f * (float)M_PI * i / AUDIO_FFT_SIZE);
+  }
+  s_TablesReady = true;
+}
+
+// In place radix-2 decimation in time
+static void Audio_Fft(float *ioRe, float *ioIm)
+{
+  for (uint16_t i = 1, j = 0; i < AUDIO_FFT_SIZE; i++)
+  {
+    uint16_t lvBit = AUDIO_FFT_SIZE >> 1;
+    for (; j & lvBit; lvBit >>= 1)
+    {
+      j ^= lvBit;
+    }
+    j ^= lvBit;
+    if (i < j)
+    {
+      float lvTemp = ioRe[i];
+      ioRe[i] = ioRe[j];
+      ioRe[j] = lvTemp;
+      lvTemp = ioIm[i];
+      ioIm[i] = ioIm[j];
+      ioIm[j] = lvTemp;
+    }
+  }
+
+  for (uint16_t lvHalf = 1; lvHalf < AUDIO_FFT_SIZE; lvHalf <<= 1)
+  {
+    uint16_t lvStep = (AUDIO_FFT_SIZE / 2) / lvHalf;
+    for (uint16_t i = 0; i < AUDIO_FFT_SIZE; i += 2 * lvHalf)
+    {
+      for (uint16_t k = 0; k < lvHalf; k++)
+      {
+        float lvWr = s_Cos[k * lvStep];
+        float lvWi = -s_Sin[k * lvStep];
+        uint16_t a = i + k;
+        uint16_t b = a + lvHalf;
+        float lvTr = (ioRe[b] * lvWr) - (ioIm[b] * lvWi);
+        float lvTi = (ioRe[b] * lvWi) + (ioIm[b] * lvWr);
+        ioRe[b] = ioRe[a] - lvTr;
+        ioIm[b] = ioIm[a] - lvTi;
+        ioRe[a] += lvTr;
+        ioIm[a] += lvTi;
+      }
+    }
+  }
+}
+#endif //AUDIO_USE_FHT
+
+#if defined(AUDIO_CAPTURE_I2S) || defined(AUDIO_CAPTURE_ADC_ISR)
+static void Audio_Publish(const AudioFrame *inFrame, unsigned long inBlockEndUs, unsigned long inAnalysisUs)
+{
+#ifdef AUDIO_CAPTURE_I2S
+  portENTER_CRITICAL(&s_FrameLock);
+  s_Frame = *inFrame;
+  portEXIT_CRITICAL(&s_FrameLock);
+#else
+  s_Frame = *inFrame;
+#endif //AUDIO_CAPTURE_I2S
+  AudioBus_Publish(inFrame, inBlockEndUs);
+  s_Stats.Blocks++;
+  s_Stats.AnalysisUs = inAnalysisUs;
+  s_Stats.MaxAnalysisUs = max(s_Stats.MaxAnalysisUs, inAnalysisUs);
+  s_Stats.LatencyUs = micros() - inBlockEndUs;
+}
+#endif
+
+#ifdef AUDIO_CAPTURE_I2S
+// Reads one DMA buffer per block and analyses it, while loop() renders on the other core
+static void Audio_CaptureTask(void *inParam)
+{
+  unsigned long lvSequence = 0;
+
+  for (;;)
+  {
+    if (!s_Running)
+    {
+      s_TaskIdle = true;
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      s_TaskIdle = false;
+      lvSequence = 0;
+      continue;
+    }
+
+    size_t lvBytesRead = 0;
+    i2s_read(I2S_NUM_0, s_Block, sizeof(s_Block), &lvBytesRead, pdMS_TO_TICKS(AUDIO_READ_TIMEOUT_MS));
+    if (lvBytesRead < sizeof(s_Block))
+    {
+      continue;   // stopped or timed out, a partial block is dropped
+    }
+    unsigned long lvBlockEndUs = micros();
+
+    // every filled DMA buffer posts an event, all buffers full means the oldest one was overwritten
+    i2s_event_t lvEvent;
+    if (uxQueueMessagesWaiting(s_I2SEvents) >= AUDIO_DMA_BUFFERS)
+    {
+      s_Stats.Overruns += AUDIO_FFT_SIZE;
+      xQueueReset(s_I2SEvents);
+    }
+    else
+    {
+      xQueueReceive(s_I2SEvents, &lvEvent, 0);
+    }
+
+    // the built-in ADC puts the channel number in the upper 4 bits
+    for (uint16_t i = 0; i < AUDIO_FFT_SIZE; i++)
+    {
+      s_Block[i] &= 0x0fff;
+    }
+    AudioFrame lvFrame;
+    Audio_Analyze(s_Block, 12, &lvFrame);
+    lvFrame.Sequence = ++lvSequence;
+    Audio_Publish(&lvFrame, lvBlockEndUs, micros() - lvBlockEndUs);
+  }
+}
+#endif //AUDIO_CAPTURE_I2S
+
+#ifdef AUDIO_CAPTURE_ADC_ISR
+ISR(ADC_vect)
+{
+  uint16_t lvCount = s_SampleCount;
+  if (lvCount < AUDIO_FFT_SIZE)
+  {
+    s_Block[lvCount] = ADC;
+    s_SampleCount = ++lvCount;
+    if (lvCount == AUDIO_FFT_SIZE)
+    {
+      s_BlockEndUs = micros();
+    }
+  }
+  else if (s_DroppedSamples < 0xffff)
+  {
+    s_DroppedSamples++;
+  }
+}
+#endif //AUDIO_CAPTURE_ADC_ISR
+
+// WAV data is little endian
+static uint16_t Audio_Read16(const uint8_t *inData)
+{
+  return inData[0] | ((uint16_t)inData[1] << 8);
+}
+
+static uint32_t Audio_Read32(const uint8_t *inData)
+{
+  return Audio_Read16(inData) | ((uint32_t)Audio_Read16(&inData[2]) << 16);
+}
+
+#else
+
+// No capture, programs that use the audio get no frames from AudioBus_Read()
+bool Audio_Start()
+{
+  return false;
+}
+
+void Audio_Stop()
+{
+}
+
+#endif //INCLUDE_PROGRAM_SOUND
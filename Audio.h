@@ -0,0 +1,63 @@
+#ifndef AUDIO_H
+#define AUDIO_H
+
+/*** INCLUDES ***/
+#include <stdint.h>                       // included by CProgram.h, so not Settings.h
+
+/*** DEFINES ***/
+#define AUDIO_FFT_SIZE        256                 // samples per analysed block
+#define AUDIO_NUM_BANDS       8                   // octaves: DC, 1, 2-3, 4-7, .. 64-127 (FFT bins)
+
+/*** TYPE DEFINITIONS ***/
+// Result of one analysed block
+typedef struct
+{
+  uint8_t Octaves[AUDIO_NUM_BANDS];       // 8 * log2 of the power per octave, like fht_mag_octave()
+  uint8_t Bands[AUDIO_NUM_BANDS];         // octaves after noise correction, threshold and gain: 0..255
+  uint8_t Level;                          // sum of the bands, 0..255
+  uint16_t PeakPeak;                      // sample range of the block, in ADC counts
+  unsigned long Sequence;                 // blocks analysed since Audio_Start(), 0: none yet
+} AudioFrame;
+
+typedef struct
+{
+  unsigned long Blocks;                   // analysed blocks
+  unsigned long Overruns;                 // samples dropped because the analysis was late
+  unsigned long AnalysisUs;               // analysis time of the last block
+  unsigned long MaxAnalysisUs;
+  unsigned long LatencyUs;                // last sample of a block to its frame being published
+} AudioStats;
+
+// Analysis of a WAV buffer
+typedef struct
+{
+  uint32_t SampleRate;
+  unsigned long Blocks;
+  unsigned long AudioUs;                  // duration of the analysed audio
+  unsigned long TotalUs;                  // analysis time of all blocks
+  unsigned long MaxUs;
+} AudioWavStats;
+
+typedef void (*AudioFrameFcn)(const AudioFrame *inFrame);
+
+/*** PUBLIC FUNCTIONS ***/
+// Continuous capture into DMA buffers (ESP32, I2S from the built-in ADC) with the analysis on a task on the other core,
+// or the free running ADC interrupt on AVR boards. Returns false if the board has no capture or INCLUDE_PROGRAM_SOUND
+// is not defined. The calls nest: the capture runs until every Audio_Start() has its Audio_Stop().
+bool Audio_Start(void);
+void Audio_Stop(void);
+void Audio_Tick(void);
+// Copy of the latest frame, never waits for the capture. Returns false if no block has been analysed yet.
+bool Audio_GetFrame(AudioFrame *outFrame);
+
+// The analysis on one block of AUDIO_FFT_SIZE ADC samples (12 bit on ESP32, 10 bit on AVR). ioSamples is overwritten.
+void Audio_Analyze(int16_t *ioSamples, uint8_t inAdcBits, AudioFrame *outFrame);
+// Feed a RIFF/WAVE buffer (16 bit PCM, mono or stereo) through the same analysis, e.g. on a host build to measure the
+// FFT throughput and latency. inFrameFcn (may be NULL) gets every frame.
+bool Audio_AnalyzeWav(const uint8_t *inWav, uint32_t inLength, AudioFrameFcn inFrameFcn, AudioWavStats *outStats);
+
+const AudioStats *Audio_GetStats(void);
+void Audio_ClearStats(void);
+void Audio_PrintStats(void);
+
+#endif //AUDIO_H
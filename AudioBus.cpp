@@ -0,0 +1,308 @@
+/*** INCLUDES ***/
+#include "Settings.h"
+#include "AudioBus.h"
+
+#ifdef INCLUDE_PROGRAM_SOUND
+
+/*** DEFINES ***/
+// Adaptive noise floor per band, 8.8 fixed point on the 8 * log2 scale of the octaves (8 = 3 dB)
+#define AUDIOBUS_FLOOR_FALL_SHIFT     5           // follows a quieter room within half a second
+#define AUDIOBUS_FLOOR_RISE_SHIFT     9           // rises over seconds, so sustained music stays above it
+#define AUDIOBUS_FLOOR_MARGIN         24          // 9 dB above the floor before a band counts, above the noise spread
+#define AUDIOBUS_GAIN                 2
+
+// Onsets: the summed rise of the bands (spectral flux) against its running mean
+#define AUDIOBUS_FLUX_MEAN_SHIFT      4
+#define AUDIOBUS_ONSET_RATIO_NUM      2           // flux > 2 * mean
+#define AUDIOBUS_ONSET_RATIO_DEN      1
+#define AUDIOBUS_MIN_FLUX             64
+#define AUDIOBUS_REFRACTORY_US        100000UL
+
+// Tempo: onset intervals are folded into one octave of periods, 90..180 BPM
+#define AUDIOBUS_MIN_PERIOD_US        333333UL
+#define AUDIOBUS_MAX_PERIOD_US        (2 * AUDIOBUS_MIN_PERIOD_US)
+#define AUDIOBUS_DEFAULT_PERIOD_US    500000UL    // 120 BPM
+#define AUDIOBUS_MAX_CONFIDENCE       8           // matching intervals for full confidence
+
+#ifdef BOARD_ESP32
+  #define AUDIOBUS_BARRIER()          __sync_synchronize()              // the writer runs on the other core
+#else
+  #define AUDIOBUS_BARRIER()          __asm__ __volatile__("" ::: "memory")
+#endif //BOARD_ESP32
+
+/*** TYPE DEFINITIONS ***/
+typedef struct
+{
+  uint16_t Floor[AUDIO_NUM_BANDS];        // 8.8
+  uint8_t PrevBands[AUDIO_NUM_BANDS];
+  uint32_t FluxMean;                      // 8.8
+  unsigned long LastOnsetUs;
+  unsigned long NextBeatUs;
+  uint8_t Confidence;                     // 0..AUDIOBUS_MAX_CONFIDENCE
+} AudioBusTracker;
+
+/*** PRIVATE VARIABLES ***/
+// Seqlock: odd while the writer updates s_Frame, readers retry until they copied it between two equal even values
+static volatile unsigned long s_WriteSequence = 0;
+static AudioBusFrame s_Frame = {{0}, 0, 0, 0, 0, 0, 0, 0, AUDIOBUS_DEFAULT_PERIOD_US, 0, 0, 0};   // until the first AudioBus_Reset()
+static AudioBusTracker s_Tracker;         // writer only
+static AudioBusStats s_Stats;
+
+// reader side, loop() only
+static unsigned long s_ReadSequence = 0;
+static unsigned long s_ReadCaptureUs = 0;
+static unsigned long s_ShownSequence = 0;
+
+/*** FORWARD DECLARATIONS ***/
+static void AudioBus_Track(AudioBusFrame *ioFrame, const AudioFrame *inFrame, unsigned long inCaptureUs);
+static void AudioBus_Write(const AudioBusFrame *inFrame);
+static void AudioBus_Snapshot(AudioBusFrame *outFrame);
+
+/*** PUBLIC FUNCTIONS ***/
+
+// Called by Audio_Start() before the first frame. Audio_Stop() waited for the capture task to go idle, so this is
+// the only writer.
+void AudioBus_Reset()
+{
+  AudioBusFrame lvFrame;
+
+  memset(&s_Tracker, 0, sizeof(s_Tracker));
+  for (uint8_t i = 0; i < AUDIO_NUM_BANDS; i++)
+  {
+    s_Tracker.Floor[i] = 0xffff;          // falls to the room level in the first frames
+  }
+  memset(&lvFrame, 0, sizeof(lvFrame));
+  lvFrame.PeriodUs = AUDIOBUS_DEFAULT_PERIOD_US;
+  AudioBus_Write(&lvFrame);
+}
+
+// Runs the onset and tempo tracker on a new analysis frame and publishes the result
+void AudioBus_Publish(const AudioFrame *inFrame, unsigned long inCaptureUs)
+{
+  AudioBusFrame lvFrame = s_Frame;        // only the writer changes s_Frame
+
+  AudioBus_Track(&lvFrame, inFrame, inCaptureUs);
+  lvFrame.CaptureUs = inCaptureUs;
+  lvFrame.Sequence++;
+  AudioBus_Write(&lvFrame);
+  s_Stats.Frames++;
+}
+
+bool AudioBus_Read(AudioBusFrame *outFrame)
+{
+  AudioBus_Snapshot(outFrame);
+
+  // extrapolate the beat phase to now, a missing beat keeps the phase running at the last tempo
+  if (outFrame->PeriodUs > 0)
+  {
+    unsigned long lvSinceBeatUs = (micros() - outFrame->LastBeatUs) % outFrame->PeriodUs;
+    outFrame->BeatPhase = (lvSinceBeatUs << 8) / outFrame->PeriodUs;
+  }
+
+  if (outFrame->Sequence != s_ReadSequence)
+  {
+    s_ReadSequence = outFrame->Sequence;
+    s_ReadCaptureUs = outFrame->CaptureUs;
+  }
+  return outFrame->Sequence != 0;
+}
+
+void AudioBus_FrameShown()
+{
+  if ((s_ReadSequence != 0) && (s_ReadSequence != s_ShownSequence))
+  {
+    s_ShownSequence = s_ReadSequence;
+    s_Stats.LatencyUs = micros() - s_ReadCaptureUs;
+    s_Stats.MaxLatencyUs = max(s_Stats.MaxLatencyUs, s_Stats.LatencyUs);
+  }
+}
+
+const AudioBusStats *AudioBus_GetStats()
+{
+  return &s_Stats;
+}
+
+void AudioBus_ClearStats()
+{
+  memset(&s_Stats, 0, sizeof(s_Stats));
+}
+
+void AudioBus_PrintStats()
+{
+  AudioBusFrame lvFrame;
+
+  // not AudioBus_Read(): the stats must not count as the frame a program used
+  AudioBus_Snapshot(&lvFrame);
+  Serial.print(F("Audio Bus Frames: "));
+  Serial.print(s_Stats.Frames);
+  Serial.print(F("; Retries: "));
+  Serial.print(s_Stats.Retries);
+  Serial.print(F("; Onsets: "));
+  Serial.print(lvFrame.Onsets);
+  Serial.print(F("; BPM: "));
+  if (lvFrame.PeriodUs > 0)
+  {
+    Serial.print(60000000UL / lvFrame.PeriodUs);
+  }
+  else
+  {
+    Serial.print(F("-"));
+  }
+  Serial.print(F(" ("));
+  Serial.print(lvFrame.Confidence);
+  Serial.print(F("); Latency: "));
+  Serial.print(s_Stats.LatencyUs);
+  Serial.print(F("us (max "));
+  Serial.print(s_Stats.MaxLatencyUs);
+  Serial.println(F("us)"));
+}
+
+/*** PRIVATE FUNCTIONS ***/
+
+// One frame of the incremental tracker: noise floor, band energies, onset detection and tempo/phase estimate
+static void AudioBus_Track(AudioBusFrame *ioFrame, const AudioFrame *inFrame, unsigned long inCaptureUs)
+{
+  AudioBusTracker *lvTracker = &s_Tracker;
+  uint16_t lvLevel = 0;
+  uint16_t lvFlux = 0;
+  uint8_t lvOnsetBands = 0;
+
+  for (uint8_t i = 0; i < AUDIO_NUM_BANDS; i++)
+  {
+    uint16_t lvOctave = (uint16_t)inFrame->Octaves[i] << 8;
+    uint16_t lvFloor = lvTracker->Floor[i];
+    if (lvOctave < lvFloor)
+    {
+      lvFloor -= (lvFloor - lvOctave) >> AUDIOBUS_FLOOR_FALL_SHIFT;
+    }
+    else
+    {
+      lvFloor += (lvOctave - lvFloor) >> AUDIOBUS_FLOOR_RISE_SHIFT;
+    }
+    lvTracker->Floor[i] = lvFloor;
+
+    int16_t lvTemp = (int16_t)inFrame->Octaves[i] - (lvFloor >> 8) - AUDIOBUS_FLOOR_MARGIN;
+    uint8_t lvBand = (lvTemp > 0) ? min(lvTemp * AUDIOBUS_GAIN, 255) : 0;
+    if (lvBand > lvTracker->PrevBands[i])
+    {
+      lvFlux += lvBand - lvTracker->PrevBands[i];
+      lvOnsetBands |= (1 << i);
+    }
+    lvTracker->PrevBands[i] = lvBand;
+    ioFrame->Bands[i] = lvBand;
+    lvLevel += lvBand;
+  }
+  ioFrame->Level = min(lvLevel, (uint16_t)255);
+  ioFrame->OnsetBands = 0;
+
+  bool lvOnset = (lvFlux >= AUDIOBUS_MIN_FLUX)
+              && (((uint32_t)lvFlux << 8) * AUDIOBUS_ONSET_RATIO_DEN > lvTracker->FluxMean * AUDIOBUS_ONSET_RATIO_NUM)
+              && ((lvTracker->LastOnsetUs == 0) || ((inCaptureUs - lvTracker->LastOnsetUs) >= AUDIOBUS_REFRACTORY_US));
+  lvTracker->FluxMean += (((uint32_t)lvFlux << 8) >> AUDIOBUS_FLUX_MEAN_SHIFT) - (lvTracker->FluxMean >> AUDIOBUS_FLUX_MEAN_SHIFT);
+
+  if (lvTracker->NextBeatUs == 0)
+  {
+    lvTracker->NextBeatUs = inCaptureUs + ioFrame->PeriodUs;
+    ioFrame->LastBeatUs = inCaptureUs;
+  }
+
+  if (lvOnset)
+  {
+    ioFrame->Onsets++;
+    ioFrame->OnsetBands = lvOnsetBands;
+    ioFrame->OnsetStrength = min(lvFlux, (uint16_t)255);
+
+    // tempo: the onset interval, folded into the period range, confirms or replaces the period
+    if (lvTracker->LastOnsetUs != 0)
+    {
+      unsigned long lvIntervalUs = inCaptureUs - lvTracker->LastOnsetUs;
+      if (lvIntervalUs >= (AUDIOBUS_MIN_PERIOD_US / 2))
+      {
+        while (lvIntervalUs < AUDIOBUS_MIN_PERIOD_US)
+        {
+          lvIntervalUs *= 2;
+        }
+        while (lvIntervalUs >= AUDIOBUS_MAX_PERIOD_US)
+        {
+          lvIntervalUs /= 2;
+        }
+        long lvErrorUs = (long)(lvIntervalUs - ioFrame->PeriodUs);
+        if (labs(lvErrorUs) < (long)(ioFrame->PeriodUs / 8))
+        {
+          ioFrame->PeriodUs += lvErrorUs / 4;
+          lvTracker->Confidence = min(lvTracker->Confidence + 1, AUDIOBUS_MAX_CONFIDENCE);
+        }
+        else if (lvTracker->Confidence > 0)
+        {
+          lvTracker->Confidence--;
+        }
+        else
+        {
+          ioFrame->PeriodUs = lvIntervalUs;
+        }
+      }
+    }
+    lvTracker->LastOnsetUs = inCaptureUs;
+
+    // phase: an onset close to a beat pulls the beat grid half way towards it
+    long lvPhaseErrorUs = (long)(inCaptureUs - lvTracker->NextBeatUs);
+    if (lvPhaseErrorUs < -(long)(ioFrame->PeriodUs / 2))
+    {
+      lvPhaseErrorUs += ioFrame->PeriodUs;      // closer to the previous beat
+    }
+    if (labs(lvPhaseErrorUs) < (long)(ioFrame->PeriodUs / 4))
+    {
+      lvTracker->NextBeatUs += lvPhaseErrorUs / 2;
+    }
+  }
+  ioFrame->Confidence = (lvTracker->Confidence * 255) / AUDIOBUS_MAX_CONFIDENCE;
+
+  // beats fire on the first frame at or after the predicted time
+  while ((long)(inCaptureUs - lvTracker->NextBeatUs) >= 0)
+  {
+    ioFrame->LastBeatUs = lvTracker->NextBeatUs;
+    ioFrame->Beats++;
+    lvTracker->NextBeatUs += ioFrame->PeriodUs;
+  }
+}
+
+static void AudioBus_Write(const AudioBusFrame *inFrame)
+{
+  s_WriteSequence = s_WriteSequence + 1;
+  AUDIOBUS_BARRIER();
+  s_Frame = *inFrame;
+  AUDIOBUS_BARRIER();
+  s_WriteSequence = s_WriteSequence + 1;
+}
+
+// Seqlock read of s_Frame
+static void AudioBus_Snapshot(AudioBusFrame *outFrame)
+{
+  unsigned long lvSequence;
+
+  for (;;)
+  {
+    lvSequence = s_WriteSequence;
+    AUDIOBUS_BARRIER();
+    if (!(lvSequence & 1))
+    {
+      *outFrame = s_Frame;
+      AUDIOBUS_BARRIER();
+      if (s_WriteSequence == lvSequence)
+      {
+        break;
+      }
+    }
+    s_Stats.Retries++;
+  }
+}
+
+#else
+
+bool AudioBus_Read(AudioBusFrame *outFrame)
+{
+  memset(outFrame, 0, sizeof(AudioBusFrame));
+  return false;
+}
+
+#endif //INCLUDE_PROGRAM_SOUND
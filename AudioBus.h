@@ -0,0 +1,54 @@
+#ifndef AUDIOBUS_H
+#define AUDIOBUS_H
+
+/*** INCLUDES ***/
+#include "Settings.h"
+#include "Audio.h"
+
+/*** TYPE DEFINITIONS ***/
+// Modulation sources from the audio analysis, for any program. Start the capture with UseAudio() in Start() (see
+// CProgram.h), CLEDProgram::Stop() stops it. Then call AudioBus_Read() from Update(), e.g.
+//   Hue + lvBus.Bands[1]          bass shifts the hue
+//   scale8(lvValue, lvBus.Level)  loudness as brightness
+//   lvBus.Beats != LastBeats      one pulse per beat, 255 - lvBus.BeatPhase decays between beats
+// Latency from the last sample of a block to the frame that used it being handed to the output: one analysis
+// (AudioStats.AnalysisUs) plus at most one frame period, the oldest sample of a block is AUDIO_FFT_SIZE samples older.
+typedef struct
+{
+  uint8_t Bands[AUDIO_NUM_BANDS];         // octave energies above the adaptive noise floor, 0..255
+  uint8_t Level;                          // sum of the bands, 0..255
+  uint8_t OnsetBands;                     // bit per band that rose in the last frame
+  uint8_t OnsetStrength;                  // of the last onset, 0..255
+  uint8_t BeatPhase;                      // 0 at a beat .. 255 just before the next, extrapolated by AudioBus_Read()
+  uint8_t Confidence;                     // of the tempo: 0 free running .. 255 locked to the onsets
+  unsigned long Onsets;                   // counters: a change means an onset/beat since the last read
+  unsigned long Beats;
+  unsigned long PeriodUs;                 // beat period, 60000000 / PeriodUs = BPM
+  unsigned long LastBeatUs;               // micros() of the last beat
+  unsigned long CaptureUs;                // micros() at the last sample of the analysed block
+  unsigned long Sequence;                 // frames since Audio_Start(), 0: none yet
+} AudioBusFrame;
+
+typedef struct
+{
+  unsigned long Frames;                   // published
+  unsigned long Retries;                  // reads that overlapped a publish
+  unsigned long LatencyUs;                // last sample of a block to the frame shown with it
+  unsigned long MaxLatencyUs;
+} AudioBusStats;
+
+/*** PUBLIC FUNCTIONS ***/
+// Writer side, from the audio analysis
+void AudioBus_Reset(void);
+void AudioBus_Publish(const AudioFrame *inFrame, unsigned long inCaptureUs);
+
+// Copy of the latest frame without locks, returns false if no frame has been published yet
+bool AudioBus_Read(AudioBusFrame *outFrame);
+// Called after a frame has been handed to the output, measures the latency of the bus frame it used
+void AudioBus_FrameShown(void);
+
+const AudioBusStats *AudioBus_GetStats(void);
+void AudioBus_ClearStats(void);
+void AudioBus_PrintStats(void);
+
+#endif //AUDIOBUS_H
@@ -0,0 +1,318 @@
+/*** INCLUDES ***/
+#include "Benchmark.h"
+#include "Registry.h"
+#include "Programs.h"
+
+#ifdef ENABLE_BENCHMARK
+
+#if defined(BOARD_ESP32) || defined(ESP8266)
+  #define BENCHMARK_FREE_HEAP()     ESP.getFreeHeap()
+#else
+  #define BENCHMARK_FREE_HEAP()     0
+#endif
+
+/*** PRIVATE VARIABLES ***/
+// strip lengths of the supported devices and of the host build, lengths that do not fit in g_LEDS are skipped
+static const uint16_t c_BenchmarkNumLeds[] = {LEDSTRIP4_NUM_LEDS, LEDSTRIP1_NUM_LEDS, LEDSTRIP3_NUM_LEDS, LEDSTRIP2_NUM_LEDS, LEDSTRIP_HOST_NUM_LEDS};
+static const uint16_t c_BenchmarkFireNumLeds[] = {LEDSTRIP2_NUM_LEDS, BENCHMARK_FIRE_MAX_LEDS};
+static const uint16_t c_BenchmarkMagnetsNumLeds[] = {LEDSTRIP2_NUM_LEDS, BENCHMARK_MAGNETS_MAX_LEDS};
+static const char *c_BenchmarkHsvCases[] = {"hues", "hues sat/val", "ramp"};
+
+/*** FORWARD DECLARATIONS ***/
+static void Benchmark_FireKernels(void);
+static void Benchmark_MagnetsKernels(void);
+static void Benchmark_HsvKernels(void);
+static unsigned long Benchmark_HsvCase(uint8_t inCase, bool inBatch, const uint8_t *inHues, CRGB *outLEDs, uint16_t inNumLeds);
+
+/*** PUBLIC FUNCTIONS ***/
+
+// Render every program for BENCHMARK_FRAMES frames at each strip length and report the render cost.
+// Only CLEDProgram::Update() is measured, the strip is not updated.
+// Each program is constructed in the program arena for its run: call with no program running.
+void Benchmark_Run()
+{
+  uint16_t lvSavedNumLeds = NUM_LEDS;
+
+  Serial.println(F("Benchmark: program, LEDs, us/frame, ns/pixel, max us/frame, heap bytes allocated"));
+  for (uint8_t n = 0; n < (sizeof(c_BenchmarkNumLeds) / sizeof(c_BenchmarkNumLeds[0])); n++)
+  {
+    if (c_BenchmarkNumLeds[n] > DEFAULT_NUM_LEDS)
+    {
+      continue;
+    }
+    NUM_LEDS = c_BenchmarkNumLeds[n];
+    for (uint8_t i = 0; i < g_NumPrograms; i++)
+    {
+      unsigned long lvTotalUs = 0;
+      unsigned long lvMaxUs = 0;
+      long lvFreeHeap = BENCHMARK_FREE_HEAP();
+
+      fill_solid(g_LEDBuffer, DEFAULT_NUM_LEDS, CRGB(0,0,0));
+      CLEDProgram *lvProgram = Registry_Acquire(i);
+      if (lvProgram == NULL)
+      {
+        continue;
+      }
+      if (!lvProgram->Start())
+      {
+        // e.g. Realtime without a network or Sound without a capture, its Update() would measure nothing
+        Registry_Release(i);
+        Serial.print(g_ProgramRegistry[i].Name);
+        Serial.print(F(", "));
+        Serial.print(NUM_LEDS);
+        Serial.println(F(", skipped: Start() failed"));
+        continue;
+      }
+      for (uint16_t f = 0; f < BENCHMARK_FRAMES; f++)
+      {
+        unsigned long lvStartUs = micros();
+        // fixed frame time: every run simulates the same number of animation steps
+        lvProgram->Update(FRAME_PERIOD_MIN_US);
+        unsigned long lvDurationUs = micros() - lvStartUs;
+        lvTotalUs += lvDurationUs;
+        if (lvDurationUs > lvMaxUs)
+        {
+          lvMaxUs = lvDurationUs;
+        }
+      }
+      Registry_Release(i);
+      lvFreeHeap -= BENCHMARK_FREE_HEAP();
+
+      Serial.print(g_ProgramRegistry[i].Name);
+      Serial.print(F(", "));
+      Serial.print(NUM_LEDS);
+      Serial.print(F(", "));
+      Serial.print(lvTotalUs / BENCHMARK_FRAMES);
+      Serial.print(F(", "));
+      Serial.print((1000.0f * lvTotalUs) / ((unsigned long)BENCHMARK_FRAMES * NUM_LEDS));
+      Serial.print(F(", "));
+      Serial.print(lvMaxUs);
+      Serial.print(F(", "));
+      Serial.println(lvFreeHeap);
+      
+      // keep the watchdog and network stack alive
+      yield();
+    }
+  }
+
+  NUM_LEDS = lvSavedNumLeds;
+  fill_solid(g_LEDBuffer, DEFAULT_NUM_LEDS, CRGB(0,0,0));
+
+  Benchmark_FireKernels();
+  Benchmark_MagnetsKernels();
+  Benchmark_HsvKernels();
+}
+
+/*** PRIVATE FUNCTIONS ***/
+
+// Fire simulation and color mapping on heap buffers, so strip lengths beyond DEFAULT_NUM_LEDS can be measured.
+// The worst case frame simulates MAX_STEPS_PER_UPDATE steps and renders once, it has to fit in FRAME_PERIOD_MIN_US.
+static void Benchmark_FireKernels()
+{
+  Serial.println(F("Fire kernels: LEDs, us/step, us/render, worst case us/frame, frame budget us"));
+  for (uint8_t n = 0; n < (sizeof(c_BenchmarkFireNumLeds) / sizeof(c_BenchmarkFireNumLeds[0])); n++)
+  {
+    uint16_t lvNumLeds = c_BenchmarkFireNumLeds[n];
+    unsigned long lvStepUs = 0;
+    unsigned long lvRenderUs = 0;
+    RandomStream lvRandom;
+
+    // two heat rows and the LEDs
+    uint8_t *lvBuffer = (uint8_t *)malloc((2 + sizeof(CRGB)) * lvNumLeds);
+    if (lvBuffer == NULL)
+    {
+      Serial.print(lvNumLeds);
+      Serial.println(F(", out of memory"));
+      continue;
+    }
+    memset(lvBuffer, 0, (2 + sizeof(CRGB)) * lvNumLeds);
+    uint8_t *lvHeat = lvBuffer;
+    uint8_t *lvScratch = lvBuffer + lvNumLeds;
+    CRGB *lvLEDs = (CRGB *)(lvBuffer + (2 * lvNumLeds));
+    Random_InitStream(&lvRandom, lvNumLeds);
+
+    for (uint16_t f = 0; f < BENCHMARK_FRAMES; f++)
+    {
+      unsigned long lvStartUs = micros();
+      Program_Fire::Step(&lvRandom, lvHeat, lvScratch, lvNumLeds);
+      lvStepUs += micros() - lvStartUs;
+
+      uint8_t *lvTemp = lvHeat;
+      lvHeat = lvScratch;
+      lvScratch = lvTemp;
+
+      lvStartUs = micros();
+      Program_Fire::Render(lvHeat, lvLEDs, lvNumLeds);
+      lvRenderUs += micros() - lvStartUs;
+    }
+    free(lvBuffer);
+
+    unsigned long lvWorstUs = ((lvStepUs * MAX_STEPS_PER_UPDATE) + lvRenderUs) / BENCHMARK_FRAMES;
+    Serial.print(lvNumLeds);
+    Serial.print(F(", "));
+    Serial.print((float)lvStepUs / BENCHMARK_FRAMES);
+    Serial.print(F(", "));
+    Serial.print((float)lvRenderUs / BENCHMARK_FRAMES);
+    Serial.print(F(", "));
+    Serial.print(lvWorstUs);
+    Serial.print(F(", "));
+    Serial.print(FRAME_PERIOD_MIN_US);
+    Serial.println((lvWorstUs <= FRAME_PERIOD_MIN_US) ? F(", OK") : F(", OVER BUDGET"));
+
+    yield();
+  }
+}
+
+// Magnets physics and drawing on heap buffers. The step time grows with the number of magnets, so the average and the
+// slowest step are reported together with the number of magnets at the end of the run.
+static void Benchmark_MagnetsKernels()
+{
+  Serial.println(F("Magnets kernels: LEDs, magnets, us/step, max us/step, us/draw, worst case us/frame, frame budget us"));
+  for (uint8_t n = 0; n < (sizeof(c_BenchmarkMagnetsNumLeds) / sizeof(c_BenchmarkMagnetsNumLeds[0])); n++)
+  {
+    uint16_t lvNumLeds = c_BenchmarkMagnetsNumLeds[n];
+    uint16_t lvStateSize = Program_Magnets::StateSize(lvNumLeds);
+    unsigned long lvStepUs = 0;
+    unsigned long lvMaxStepUs = 0;
+    unsigned long lvDrawUs = 0;
+    uint8_t lvMagnets = 0;
+    RandomStream lvRandom;
+
+    // simulation state and the LEDs
+    uint8_t *lvBuffer = (uint8_t *)malloc(lvStateSize + (sizeof(CRGB) * lvNumLeds));
+    if (lvBuffer == NULL)
+    {
+      Serial.print(lvNumLeds);
+      Serial.println(F(", out of memory"));
+      continue;
+    }
+    MagnetsState *lvState = (MagnetsState *)lvBuffer;
+    CRGB *lvLEDs = (CRGB *)(lvBuffer + lvStateSize);
+    Random_InitStream(&lvRandom, lvNumLeds);
+    Program_Magnets::Init(lvState, lvNumLeds);
+
+    for (uint16_t s = 0; s < BENCHMARK_MAGNETS_STEPS; s++)
+    {
+      unsigned long lvStartUs = micros();
+      lvMagnets = Program_Magnets::Step(lvState, &lvRandom);
+      unsigned long lvUs = micros() - lvStartUs;
+      lvStepUs += lvUs;
+      lvMaxStepUs = max(lvMaxStepUs, lvUs);
+
+      if ((s % (BENCHMARK_MAGNETS_STEPS / BENCHMARK_FRAMES)) == 0)
+      {
+        lvStartUs = micros();
+        Program_Magnets::Draw(lvState, lvLEDs);
+        lvDrawUs += micros() - lvStartUs;
+        yield();
+      }
+    }
+    free(lvBuffer);
+
+    unsigned long lvWorstUs = (lvMaxStepUs * MAX_STEPS_PER_UPDATE) + (lvDrawUs / BENCHMARK_FRAMES);
+    Serial.print(lvNumLeds);
+    Serial.print(F(", "));
+    Serial.print(lvMagnets);
+    Serial.print(F(", "));
+    Serial.print((float)lvStepUs / BENCHMARK_MAGNETS_STEPS);
+    Serial.print(F(", "));
+    Serial.print(lvMaxStepUs);
+    Serial.print(F(", "));
+    Serial.print((float)lvDrawUs / BENCHMARK_FRAMES);
+    Serial.print(F(", "));
+    Serial.print(lvWorstUs);
+    Serial.print(F(", "));
+    Serial.print(FRAME_PERIOD_MIN_US);
+    Serial.println((lvWorstUs <= FRAME_PERIOD_MIN_US) ? F(", OK") : F(", OVER BUDGET"));
+
+    yield();
+  }
+}
+
+// Per-pixel CHSV conversion against the batched kernels of Hsv.h, on one strip of random hues
+static void Benchmark_HsvKernels()
+{
+  uint16_t lvNumLeds = LEDSTRIP2_NUM_LEDS;
+  RandomStream lvRandom;
+
+  uint8_t *lvBuffer = (uint8_t *)malloc((1 + sizeof(CRGB)) * lvNumLeds);
+  if (lvBuffer == NULL)
+  {
+    Serial.println(F("HSV kernels: out of memory"));
+    return;
+  }
+  uint8_t *lvHues = lvBuffer;
+  CRGB *lvLEDs = (CRGB *)(lvBuffer + lvNumLeds);
+  Random_InitStream(&lvRandom, lvNumLeds);
+  Random_FillBytes(&lvRandom, lvHues, lvNumLeds);
+
+  Serial.println(F("HSV kernels: LEDs, case, us per-pixel CHSV, us batched, speedup"));
+  for (uint8_t c = 0; c < (sizeof(c_BenchmarkHsvCases) / sizeof(c_BenchmarkHsvCases[0])); c++)
+  {
+    unsigned long lvPixelUs = Benchmark_HsvCase(c, false, lvHues, lvLEDs, lvNumLeds);
+    unsigned long lvBatchUs = Benchmark_HsvCase(c, true, lvHues, lvLEDs, lvNumLeds);
+    Serial.print(lvNumLeds);
+    Serial.print(F(", "));
+    Serial.print(c_BenchmarkHsvCases[c]);
+    Serial.print(F(", "));
+    Serial.print((float)lvPixelUs / BENCHMARK_FRAMES);
+    Serial.print(F(", "));
+    Serial.print((float)lvBatchUs / BENCHMARK_FRAMES);
+    Serial.print(F(", "));
+    Serial.println((float)lvPixelUs / max(lvBatchUs, 1UL));
+    yield();
+  }
+  free(lvBuffer);
+}
+
+// Total time of BENCHMARK_FRAMES conversions of the strip
+static unsigned long Benchmark_HsvCase(uint8_t inCase, bool inBatch, const uint8_t *inHues, CRGB *outLEDs, uint16_t inNumLeds)
+{
+  unsigned long lvStartUs = micros();
+
+  for (uint16_t f = 0; f < BENCHMARK_FRAMES; f++)
+  {
+    switch (inCase)
+    {
+      case 0:
+        if (inBatch)
+        {
+          Hsv_FillHues(outLEDs, inHues, inNumLeds, 255, 255);
+        }
+        else
+        {
+          for (uint16_t i = 0; i < inNumLeds; i++)
+          {
+            outLEDs[i] = CHSV(inHues[i], 255, 255);
+          }
+        }
+        break;
+      case 1:
+        if (inBatch)
+        {
+          Hsv_FillHues(outLEDs, inHues, inNumLeds, 200, 180);
+        }
+        else
+        {
+          for (uint16_t i = 0; i < inNumLeds; i++)
+          {
+            outLEDs[i] = CHSV(inHues[i], 200, 180);
+          }
+        }
+        break;
+      default:
+        if (inBatch)
+        {
+          Hsv_FillRamp(outLEDs, inNumLeds, f, 5, 240, 255);
+        }
+        else
+        {
+          fill_rainbow(outLEDs, inNumLeds, f, 5);
+        }
+        break;
+    }
+  }
+  return micros() - lvStartUs;
+}
+
+#endif //ENABLE_BENCHMARK
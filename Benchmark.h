@@ -0,0 +1,16 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+/*** INCLUDES ***/
+#include "Settings.h"
+
+/*** DEFINES ***/
+#define BENCHMARK_FRAMES          100     // frames rendered per program and strip length
+#define BENCHMARK_FIRE_MAX_LEDS   2000    // Fire kernels are also measured on strips longer than g_LEDS
+#define BENCHMARK_MAGNETS_MAX_LEDS  3000  // Magnets physics at its maximum number of magnets
+#define BENCHMARK_MAGNETS_STEPS   2000    // enough steps to spawn up to the maximum number of magnets
+
+/*** PUBLIC FUNCTIONS ***/
+void Benchmark_Run(void);
+
+#endif //BENCHMARK_H
@@ -1,28 +1,100 @@
 #ifndef CPROGRAM_H
 #define CPROGRAM_H
 
-class CLEDProgram 
+#include "StateArena.h"
+#include "Random.h"
+#include "Audio.h"
+
+#define STEP_FRACTION_BITS      8           // animation steps are accumulated in 8.8 fixed-point
+#define STEP_FRACTION_MASK      ((1U << STEP_FRACTION_BITS) - 1)
+#define MIN_STEP_PERIOD_US      100UL       // fastest animation step
+#define MAX_ELAPSED_US          250000UL    // longer gaps between updates are clamped, so animations never jump
+#define MAX_STEPS_PER_UPDATE    16          // limit for programs that simulate each step
+
+class CLEDProgram
 {
   protected:
-    CLEDProgram(const char *inName = "") : IncludeInAutoProgram(true) { Name = inName; TicksPerCycle = NUM_LEDS; };
+    CLEDProgram(const char *inName = "") : StepAccu(0) { Name = inName; TicksPerCycle = NUM_LEDS; Rng.State = 1; };
   public:
+    virtual ~CLEDProgram() { StateArena_Free(this); };
     virtual bool Start() { return true; };
-    virtual bool Update() = 0;
-    bool Stop() { return true; };
-    virtual int GetUpdatePeriod(uint8_t inSpeed) {
-        unsigned long lvUpdatePeriodMs = ((MAX_CYCLE_TIME_MS * (255 - g_GlobalSettings.Speed)) / 255);
+    // inElapsedUs: time since the previous update. Programs advance their animation by the matching
+    // number of steps (see TakeSteps), so the animation speed does not depend on the frame rate.
+    virtual bool Update(unsigned long inElapsedUs) = 0;
+    // Releases the state of the program and the audio capture, programs that override Stop() call CLEDProgram::Stop()
+    virtual bool Stop() {
+        StateArena_Free(this);
+        if (AudioUser)
+        {
+          Audio_Stop();
+          AudioUser = false;
+        }
+        return true;
+      };
+    // Time per animation step
+    virtual unsigned long GetUpdatePeriodUs(uint8_t inSpeed) {
+        unsigned long lvUpdatePeriodUs = ((MAX_CYCLE_TIME_MS * 1000UL) / 255) * (255 - inSpeed);
         if (TicksPerCycle > 0)
         {
-          lvUpdatePeriodMs /= TicksPerCycle;
+          lvUpdatePeriodUs /= TicksPerCycle;
         }
-        return lvUpdatePeriodMs;
+        return lvUpdatePeriodUs;
       };
-    
+
     bool NoDelay = false;
     uint16_t TicksPerCycle;
     const char* Name;
-    bool IncludeInAutoProgram;
+    RandomStream Rng;                     // seeded by Registry_Acquire(), see Random.h
   protected:
+    // Number of whole animation steps in inElapsedUs. The remainder is kept for the next update.
+    uint16_t TakeSteps(unsigned long inElapsedUs, uint16_t inMaxSteps = 0xFFFF) {
+        unsigned long lvPeriodUs = GetUpdatePeriodUs(g_GlobalSettings.Speed);
+        if (lvPeriodUs < MIN_STEP_PERIOD_US)
+        {
+          lvPeriodUs = MIN_STEP_PERIOD_US;
+        }
+        if (inElapsedUs > MAX_ELAPSED_US)
+        {
+          inElapsedUs = MAX_ELAPSED_US;
+        }
+        StepAccu += (inElapsedUs << STEP_FRACTION_BITS) / lvPeriodUs;
+        unsigned long lvSteps = StepAccu >> STEP_FRACTION_BITS;
+        StepAccu &= STEP_FRACTION_MASK;
+        if (lvSteps > inMaxSteps)
+        {
+          // drop the excess steps: the animation slows down instead of overloading the frame
+          lvSteps = inMaxSteps;
+        }
+        return lvSteps;
+      };
+    // Zeroed simulation state for this instance, from the state arena. Call from Start(), a restart replaces the previous block.
+    // Returns NULL if the arena is full.
+    void *AllocState(uint16_t inSize) { return StateArena_Alloc(this, inSize); };
+    // Largest block AllocState() can return, for state that can shrink to fit
+    uint16_t MaxStateSize() { return StateArena_MaxAlloc(this); };
+    // Starts the audio capture that feeds AudioBus_Read() (see AudioBus.h) until Stop(), a restart keeps it running.
+    // Returns false if there is no capture.
+    bool UseAudio() {
+        if (!AudioUser)
+        {
+          AudioUser = Audio_Start();
+        }
+        return AudioUser;
+      };
+    // Progress towards the next step (0..255), for sub-pixel rendering
+    uint8_t StepFraction() { return StepAccu; };
+    // Fade amount equivalent to fading by inFadeAmount for inSteps steps
+    static uint8_t FadeSteps(uint8_t inFadeAmount, uint16_t inSteps) {
+        uint8_t lvScale = 255;
+        while ((inSteps-- > 0) && (lvScale > 0))
+        {
+          lvScale = scale8(lvScale, 255 - inFadeAmount);
+        }
+        return 255 - lvScale;
+      };
+
+    unsigned long StepAccu;
+    bool AudioUser = false;               // holds an Audio_Start()
 };
 
 #endif //CPROGRAM_H
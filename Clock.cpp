@@ -0,0 +1,41 @@
+/*** INCLUDES ***/
+#include "Settings.h"
+#include "Clock.h"
+
+/*** PRIVATE VARIABLES ***/
+static bool s_Virtual = false;
+static unsigned long s_VirtualUs = 0;
+
+/*** PUBLIC FUNCTIONS ***/
+unsigned long Clock_Millis()
+{
+  return s_Virtual ? (s_VirtualUs / 1000) : millis();
+}
+
+unsigned long Clock_Micros()
+{
+  return s_Virtual ? s_VirtualUs : micros();
+}
+
+// Freeze the time seen by the programs, it only moves on with Clock_Advance()
+void Clock_StartVirtual(unsigned long inStartUs)
+{
+  s_VirtualUs = inStartUs;
+  s_Virtual = true;
+}
+
+void Clock_Advance(unsigned long inDeltaUs)
+{
+  s_VirtualUs += inDeltaUs;
+}
+
+void Clock_StopVirtual()
+{
+  s_Virtual = false;
+}
+
+// FastLED time source (beatsin8(), beatsin16(), ...), enabled by USE_GET_MILLISECOND_TIMER in Settings.h
+uint32_t get_millisecond_timer()
+{
+  return Clock_Millis();
+}
@@ -0,0 +1,16 @@
+#ifndef CLOCK_H
+#define CLOCK_H
+
+/*** INCLUDES ***/
+#include <stdint.h>
+
+/*** PUBLIC FUNCTIONS ***/
+// Time as seen by the programs. Normally millis()/micros(), a virtual clock while frames are replayed (see GoldenFrames.h).
+unsigned long Clock_Millis(void);
+unsigned long Clock_Micros(void);
+
+void Clock_StartVirtual(unsigned long inStartUs);
+void Clock_Advance(unsigned long inDeltaUs);
+void Clock_StopVirtual(void);
+
+#endif //CLOCK_H
@@ -0,0 +1,171 @@
+/*** INCLUDES ***/
+#include "Settings.h"
+#include "DdpReceiver.h"
+#include "PacketPool.h"
+#include "Realtime.h"
+
+#ifdef INCLUDE_REALTIME_DDP
+
+#ifdef BOARD_ESP32
+  #include <AsyncUDP.h>
+#endif //BOARD_ESP32
+
+/*** DEFINES ***/
+#define DDP_VERSION_MASK            0xc0
+#define DDP_VERSION_1               0x40
+#define DDP_FLAG_TIMECODE           0x10
+#define DDP_FLAG_STORAGE            0x08
+#define DDP_FLAG_REPLY              0x04
+#define DDP_FLAG_QUERY              0x02
+#define DDP_FLAG_PUSH               0x01
+#define DDP_SEQUENCE_MASK           0x0f    // 1..15, 0: not used
+#define DDP_TYPE_UNDEFINED          0x00
+#define DDP_TYPE_RGB                0x01    // as sent by most software, without the element size
+#define DDP_TYPE_RGB8               0x0b    // RGB, 8 bits per element
+#define DDP_ID_DISPLAY              1
+#define DDP_ID_ALL                  255
+
+/*** PRIVATE VARIABLES ***/
+static DdpReceiverStats s_Stats;
+
+static uint8_t s_LastSequence = 0;
+static bool s_Pending = false;                    // data stored since the last push
+static unsigned long s_FrameStartUs = 0;
+
+#ifdef BOARD_ESP32
+static AsyncUDP s_Udp;
+#endif //BOARD_ESP32
+
+/*** FORWARD DECLARATIONS ***/
+#ifdef BOARD_ESP32
+static void DdpReceiver_OnPacket(AsyncUDPPacket &inPacket);
+#endif //BOARD_ESP32
+
+/*** PUBLIC FUNCTIONS ***/
+bool DdpReceiver_Begin()
+{
+  s_LastSequence = 0;
+  s_Pending = false;
+#ifdef BOARD_ESP32
+  if (!s_Udp.listen(DDP_PORT))
+  {
+    return false;
+  }
+  s_Udp.onPacket(DdpReceiver_OnPacket);
+  return true;
+#else
+  return false;
+#endif //BOARD_ESP32
+}
+
+void DdpReceiver_Stop()
+{
+#ifdef BOARD_ESP32
+  s_Udp.close();
+#endif //BOARD_ESP32
+}
+
+void DdpReceiver_Process(const uint8_t *inData, uint16_t inLength, const RealtimeOutput *inOutput)
+{
+  s_Stats.Packets++;
+  s_Stats.Bytes += inLength;
+
+  if ((inLength < DDP_HEADER_LENGTH) || ((inData[0] & DDP_VERSION_MASK) != DDP_VERSION_1))
+  {
+    s_Stats.Invalid++;
+    return;
+  }
+  uint8_t lvFlags = inData[0];
+  uint8_t lvType = inData[2];
+  uint8_t lvId = inData[3];
+  // queries, replies and writes to storage are not supported, only pixel data for the display
+  if ((lvFlags & (DDP_FLAG_STORAGE | DDP_FLAG_REPLY | DDP_FLAG_QUERY)) || ((lvId != DDP_ID_DISPLAY) && (lvId != DDP_ID_ALL))
+   || ((lvType != DDP_TYPE_UNDEFINED) && (lvType != DDP_TYPE_RGB) && (lvType != DDP_TYPE_RGB8)))
+  {
+    s_Stats.Invalid++;
+    return;
+  }
+  uint16_t lvHeader = (lvFlags & DDP_FLAG_TIMECODE) ? (DDP_HEADER_LENGTH + DDP_TIMECODE_LENGTH) : DDP_HEADER_LENGTH;
+  uint32_t lvOffset = Realtime_Read32(&inData[4]);
+  uint16_t lvLength = Realtime_Read16(&inData[8]);
+  if ((lvHeader + lvLength) > inLength)
+  {
+    s_Stats.Invalid++;
+    return;
+  }
+
+  uint8_t lvSequence = inData[1] & DDP_SEQUENCE_MASK;
+  if ((lvSequence != 0) && (s_LastSequence != 0))
+  {
+    uint8_t lvDelta = (lvSequence + 15 - s_LastSequence) % 15;
+    if (lvDelta > 1)
+    {
+      s_Stats.Lost += lvDelta - 1;
+    }
+  }
+  s_LastSequence = lvSequence;
+
+  if (lvLength > 0)
+  {
+    if (!s_Pending)
+    {
+      s_FrameStartUs = micros();
+      s_Pending = true;
+    }
+    Realtime_StorePixels(&inData[lvHeader], lvOffset, lvLength, inOutput);
+  }
+  if (lvFlags & DDP_FLAG_PUSH)
+  {
+    s_Stats.Pushed++;
+    s_Pending = false;
+    Realtime_Present(inOutput);
+  }
+}
+
+void DdpReceiver_CheckTimeout(unsigned long inNowUs, const RealtimeOutput *inOutput)
+{
+  if (s_Pending && ((inNowUs - s_FrameStartUs) >= DDP_FRAME_TIMEOUT_US))
+  {
+    s_Stats.TimedOut++;
+    s_Pending = false;
+    Realtime_Present(inOutput);
+  }
+}
+
+const DdpReceiverStats *DdpReceiver_GetStats()
+{
+  return &s_Stats;
+}
+
+void DdpReceiver_ClearStats()
+{
+  memset(&s_Stats, 0, sizeof(s_Stats));
+}
+
+void DdpReceiver_PrintStats()
+{
+  Serial.print(F("DDP Packets: "));
+  Serial.print(s_Stats.Packets);
+  Serial.print(F("; Bytes: "));
+  Serial.print(s_Stats.Bytes);
+  Serial.print(F("; Invalid: "));
+  Serial.print(s_Stats.Invalid);
+  Serial.print(F("; Pushed: "));
+  Serial.print(s_Stats.Pushed);
+  Serial.print(F("; Timed out: "));
+  Serial.print(s_Stats.TimedOut);
+  Serial.print(F("; Lost: "));
+  Serial.println(s_Stats.Lost);
+}
+
+/*** PRIVATE FUNCTIONS ***/
+
+#ifdef BOARD_ESP32
+// Runs in the AsyncUDP task: only the copy into the pool, the packet is parsed in loop()
+static void DdpReceiver_OnPacket(AsyncUDPPacket &inPacket)
+{
+  PacketPool_Put(inPacket.data(), inPacket.length(), REALTIME_PROTOCOL_DDP);
+}
+#endif //BOARD_ESP32
+
+#endif //INCLUDE_REALTIME_DDP
@@ -0,0 +1,41 @@
+#ifndef DDPRECEIVER_H
+#define DDPRECEIVER_H
+
+/*** INCLUDES ***/
+#include "Settings.h"
+#include "Realtime.h"
+
+/*** DEFINES ***/
+#define DDP_PORT                  4048
+#define DDP_HEADER_LENGTH         10
+#define DDP_TIMECODE_LENGTH       4         // after the header if DDP_FLAG_TIMECODE is set
+#define DDP_MAX_DATA_LENGTH       1440      // 480 pixels
+#define DDP_FRAME_TIMEOUT_US      50000UL   // data without a push is shown after this time
+
+/*** TYPE DEFINITIONS ***/
+typedef struct
+{
+  unsigned long Packets;
+  unsigned long Bytes;                    // UDP payload of the packets
+  unsigned long Invalid;                  // not DDP, or not RGB data for the display
+  unsigned long Pushed;                   // frames presented on a push flag
+  unsigned long TimedOut;                 // .. after DDP_FRAME_TIMEOUT_US without a push
+  unsigned long Lost;                     // skipped sequence numbers
+} DdpReceiverStats;
+
+/*** PUBLIC FUNCTIONS ***/
+// Distributed Display Protocol: pixel data at a byte offset of the strip, no universes. A packet with the push flag
+// completes the frame.
+bool DdpReceiver_Begin(void);
+void DdpReceiver_Stop(void);
+
+// Decodes a datagram from the PacketPool into the frame
+void DdpReceiver_Process(const uint8_t *inData, uint16_t inLength, const RealtimeOutput *inOutput);
+// Presents data that was not pushed after DDP_FRAME_TIMEOUT_US
+void DdpReceiver_CheckTimeout(unsigned long inNowUs, const RealtimeOutput *inOutput);
+
+const DdpReceiverStats *DdpReceiver_GetStats(void);
+void DdpReceiver_ClearStats(void);
+void DdpReceiver_PrintStats(void);
+
+#endif //DDPRECEIVER_H
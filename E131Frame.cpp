@@ -0,0 +1,178 @@
+/*** INCLUDES ***/
+#include "Settings.h"
+#include "E131Frame.h"
+
+#ifdef INCLUDE_PROGRAM_REALTIME
+
+/*** PRIVATE VARIABLES ***/
+static E131FrameStats s_Stats;
+
+static uint8_t s_NumUniverses = 0;
+static uint32_t s_AllUniverses = 0;               // bit per universe
+static uint32_t s_Pending = 0;                    // universes received for the pending frame
+static uint32_t s_HasSequence = 0;                // universes with a valid s_LastSequence
+static uint8_t s_LastSequence[E131_FRAME_MAX_UNIVERSES];
+static unsigned long s_FrameStartUs = 0;          // first packet of the pending frame
+static uint16_t s_SyncUniverse = 0;               // 0: the sender does not synchronize
+static bool s_Synced = false;
+
+/*** FORWARD DECLARATIONS ***/
+static void E131Frame_Present(unsigned long inNowUs);
+
+/*** PUBLIC FUNCTIONS ***/
+void E131Frame_Init(uint8_t inNumUniverses)
+{
+  s_NumUniverses = min(inNumUniverses, (uint8_t)E131_FRAME_MAX_UNIVERSES);
+  s_AllUniverses = (s_NumUniverses < 32) ? ((1UL << s_NumUniverses) - 1) : 0xFFFFFFFFUL;
+  s_Pending = 0;
+  s_HasSequence = 0;
+  s_SyncUniverse = 0;
+  s_Synced = false;
+}
+
+// Sequence check and frame membership of a data packet. inSyncUniverse: synchronization address of the packet.
+E131FrameResult E131Frame_Receive(uint8_t inUniverseIndex, uint16_t inSequence, uint16_t inSyncUniverse, unsigned long inNowUs)
+{
+  E131FrameResult lvResult = E131_FRAME_ACCEPT;
+  uint32_t lvMask;
+
+  if (inUniverseIndex >= s_NumUniverses)
+  {
+    return E131_FRAME_REJECT;
+  }
+  lvMask = 1UL << inUniverseIndex;
+  s_Stats.Packets++;
+
+  if (inSequence == E131_FRAME_NO_SEQUENCE)
+  {
+    s_HasSequence &= ~lvMask;
+  }
+  else if (s_HasSequence & lvMask)
+  {
+    // E1.31 6.7.2: a packet up to 20 sequence numbers behind the last one is out of order, further back the source restarted
+    int8_t lvDelta = (int8_t)(inSequence - s_LastSequence[inUniverseIndex]);
+    if (lvDelta == 0)
+    {
+      s_Stats.Duplicate++;
+      return E131_FRAME_REJECT;
+    }
+    if ((lvDelta < 0) && (lvDelta > -E131_SEQUENCE_WINDOW))
+    {
+      s_Stats.Late++;
+      return E131_FRAME_REJECT;
+    }
+    if (lvDelta > 1)
+    {
+      s_Stats.Lost += lvDelta - 1;
+    }
+  }
+  if (inSequence != E131_FRAME_NO_SEQUENCE)
+  {
+    s_HasSequence |= lvMask;
+    s_LastSequence[inUniverseIndex] = inSequence;
+  }
+
+  if (s_Pending & lvMask)
+  {
+    // this universe belongs to the next frame, the pending one will not be completed anymore
+    E131Frame_Present(inNowUs);
+    lvResult = E131_FRAME_FLUSH;
+  }
+  if (s_Pending == 0)
+  {
+    s_FrameStartUs = inNowUs;
+  }
+  s_Pending |= lvMask;
+  s_SyncUniverse = inSyncUniverse;
+  return lvResult;
+}
+
+// Sync packet: presents the pending frame if its universes wait for this synchronization address
+void E131Frame_Sync(uint16_t inSyncUniverse)
+{
+  if ((s_Pending != 0) && (inSyncUniverse == s_SyncUniverse))
+  {
+    s_Synced = true;
+  }
+}
+
+bool E131Frame_TakeReady(unsigned long inNowUs)
+{
+  if (s_Pending == 0)
+  {
+    return false;
+  }
+  if (s_Synced || ((s_Pending == s_AllUniverses) && (s_SyncUniverse == 0)) || ((inNowUs - s_FrameStartUs) >= E131_FRAME_TIMEOUT_US))
+  {
+    E131Frame_Present(inNowUs);
+    return true;
+  }
+  return false;
+}
+
+void E131Frame_Drained(uint16_t inPackets)
+{
+  s_Stats.MaxDrained = max(s_Stats.MaxDrained, inPackets);
+}
+
+const E131FrameStats *E131Frame_GetStats()
+{
+  return &s_Stats;
+}
+
+void E131Frame_ClearStats()
+{
+  memset(&s_Stats, 0, sizeof(s_Stats));
+}
+
+void E131Frame_PrintStats()
+{
+  Serial.print(F("Universe packets: "));
+  Serial.print(s_Stats.Packets);
+  Serial.print(F("; Frames: "));
+  Serial.print(s_Stats.Frames);
+  Serial.print(F(" (complete "));
+  Serial.print(s_Stats.Complete);
+  Serial.print(F(", synced "));
+  Serial.print(s_Stats.Synced);
+  Serial.print(F(", timed out "));
+  Serial.print(s_Stats.TimedOut);
+  Serial.print(F(", incomplete "));
+  Serial.print(s_Stats.Incomplete);
+  Serial.print(F("); Duplicate: "));
+  Serial.print(s_Stats.Duplicate);
+  Serial.print(F("; Late: "));
+  Serial.print(s_Stats.Late);
+  Serial.print(F("; Lost: "));
+  Serial.print(s_Stats.Lost);
+  Serial.print(F("; Max drained: "));
+  Serial.println(s_Stats.MaxDrained);
+}
+
+/*** PRIVATE FUNCTIONS ***/
+
+// Counts how the pending frame ends and starts an empty one
+static void E131Frame_Present(unsigned long inNowUs)
+{
+  if (s_Synced)
+  {
+    s_Stats.Synced++;
+  }
+  else if (s_Pending == s_AllUniverses)
+  {
+    s_Stats.Complete++;
+  }
+  else if ((inNowUs - s_FrameStartUs) >= E131_FRAME_TIMEOUT_US)
+  {
+    s_Stats.TimedOut++;
+  }
+  else
+  {
+    s_Stats.Incomplete++;
+  }
+  s_Stats.Frames++;
+  s_Pending = 0;
+  s_Synced = false;
+}
+
+#endif //INCLUDE_PROGRAM_REALTIME
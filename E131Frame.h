@@ -0,0 +1,50 @@
+#ifndef E131FRAME_H
+#define E131FRAME_H
+
+/*** INCLUDES ***/
+#include "Settings.h"
+
+/*** DEFINES ***/
+#define E131_FRAME_MAX_UNIVERSES    32            // one bit per universe of the strip
+#define E131_FRAME_TIMEOUT_US       50000UL       // an incomplete frame is shown after this time
+#define E131_SEQUENCE_WINDOW        20            // E1.31: packets up to 20 sequence numbers older are out of order
+#define E131_FRAME_NO_SEQUENCE      0x100         // Art-Net sequence 0: not numbered, no sequence check
+
+/*** TYPE DEFINITIONS ***/
+// Result of E131Frame_Receive()
+typedef enum
+{
+  E131_FRAME_REJECT,                      // duplicate or late packet, ignore its data
+  E131_FRAME_ACCEPT,                      // add the data to the frame
+  E131_FRAME_FLUSH                        // present the pending incomplete frame first, the packet starts the next one
+} E131FrameResult;
+
+typedef struct
+{
+  unsigned long Packets;                  // data packets of the strip's universes, E1.31 and Art-Net
+  unsigned long Frames;                   // presented frames
+  unsigned long Complete;                 // .. with all universes
+  unsigned long Synced;                   // .. on a sync packet
+  unsigned long TimedOut;                 // .. incomplete after E131_FRAME_TIMEOUT_US
+  unsigned long Incomplete;               // .. incomplete because the next frame started
+  unsigned long Duplicate;                // same sequence number again
+  unsigned long Late;                     // older than the last packet of the universe
+  unsigned long Lost;                     // skipped sequence numbers
+  uint16_t MaxDrained;                    // most packets taken from the receive queue in one update
+} E131FrameStats;
+
+/*** PUBLIC FUNCTIONS ***/
+// Assembles the universes of a strip into frames, so a frame is shown only when all of its universes arrived,
+// on a sync packet or after a timeout, instead of showing every universe as it arrives.
+void E131Frame_Init(uint8_t inNumUniverses);
+E131FrameResult E131Frame_Receive(uint8_t inUniverseIndex, uint16_t inSequence, uint16_t inSyncUniverse, unsigned long inNowUs);
+void E131Frame_Sync(uint16_t inSyncUniverse);
+// True once if the pending frame should be presented now, call after the data of the received packets is stored
+bool E131Frame_TakeReady(unsigned long inNowUs);
+void E131Frame_Drained(uint16_t inPackets);
+
+const E131FrameStats *E131Frame_GetStats(void);
+void E131Frame_ClearStats(void);
+void E131Frame_PrintStats(void);
+
+#endif //E131FRAME_H
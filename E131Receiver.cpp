@@ -0,0 +1,211 @@
+/*** INCLUDES ***/
+#include "Settings.h"
+#include "E131Receiver.h"
+#include "E131Frame.h"
+#include "PacketPool.h"
+#include "Realtime.h"
+
+#ifdef INCLUDE_REALTIME_E131
+
+#ifdef BOARD_ESP32
+  #include <WiFi.h>
+  #include <AsyncUDP.h>
+  #include <lwip/igmp.h>
+  #include <lwip/tcpip.h>
+#endif //BOARD_ESP32
+
+/*** DEFINES ***/
+#define E131_VECTOR_ROOT_DATA       0x00000004
+#define E131_VECTOR_ROOT_EXTENDED   0x00000008
+#define E131_VECTOR_FRAME_DATA      0x00000002
+#define E131_VECTOR_EXTENDED_SYNC   0x00000001
+#define E131_VECTOR_DMP_SET         0x02
+#define E131_DMP_TYPE               0xa1
+#define E131_OPTION_PREVIEW         0x80
+#define E131_MAX_SLOTS              512
+
+/*** PRIVATE VARIABLES ***/
+static const uint8_t c_AcnId[12] = {'A', 'S', 'C', '-', 'E', '1', '.', '1', '7', 0, 0, 0};
+
+static E131ReceiverStats s_Stats;
+
+#ifdef BOARD_ESP32
+static AsyncUDP s_Udp;
+static ip4_addr_t s_GroupInterface;       // for E131Receiver_ChangeGroups() in the lwIP thread
+#endif //BOARD_ESP32
+
+/*** FORWARD DECLARATIONS ***/
+#ifdef BOARD_ESP32
+static void E131Receiver_OnPacket(AsyncUDPPacket &inPacket);
+static void E131Receiver_JoinGroups(bool inJoin);
+static void E131Receiver_ChangeGroups(void *inJoin);
+#endif //BOARD_ESP32
+
+/*** PUBLIC FUNCTIONS ***/
+bool E131Receiver_Begin()
+{
+#ifdef BOARD_ESP32
+  // one socket, the other universes join their multicast groups on it
+  if (!s_Udp.listenMulticast(IPAddress(239, 255, E131_UNIVERSE_START >> 8, E131_UNIVERSE_START & 0xff), E131_PORT))
+  {
+    return false;
+  }
+  E131Receiver_JoinGroups(true);
+  s_Udp.onPacket(E131Receiver_OnPacket);
+  return true;
+#else
+  return false;
+#endif //BOARD_ESP32
+}
+
+void E131Receiver_Stop()
+{
+#ifdef BOARD_ESP32
+  E131Receiver_JoinGroups(false);
+  s_Udp.close();
+#endif //BOARD_ESP32
+}
+
+// Validates an E1.31 (ANSI E1.31-2016) packet in place
+E131PacketType E131Receiver_Parse(const uint8_t *inData, uint16_t inLength, E131Packet *outPacket)
+{
+  if ((inLength < E131_SYNC_LENGTH) || (Realtime_Read16(&inData[0]) != 0x0010) || (Realtime_Read16(&inData[2]) != 0) || (memcmp(&inData[4], c_AcnId, sizeof(c_AcnId)) != 0))
+  {
+    return E131_PACKET_INVALID;
+  }
+
+  uint32_t lvRootVector = Realtime_Read32(&inData[18]);
+  if (lvRootVector == E131_VECTOR_ROOT_EXTENDED)
+  {
+    if (Realtime_Read32(&inData[40]) != E131_VECTOR_EXTENDED_SYNC)
+    {
+      return E131_PACKET_INVALID;       // universe discovery
+    }
+    outPacket->Sequence = inData[44];
+    outPacket->Universe = Realtime_Read16(&inData[45]);
+    outPacket->SyncUniverse = 0;
+    outPacket->Options = 0;
+    outPacket->Slots = NULL;
+    outPacket->NumSlots = 0;
+    return E131_PACKET_SYNC;
+  }
+
+  if ((lvRootVector != E131_VECTOR_ROOT_DATA) || (inLength < E131_MIN_DATA_LENGTH) || (Realtime_Read32(&inData[40]) != E131_VECTOR_FRAME_DATA)
+   || (inData[117] != E131_VECTOR_DMP_SET) || (inData[118] != E131_DMP_TYPE) || (Realtime_Read16(&inData[119]) != 0) || (Realtime_Read16(&inData[121]) != 1))
+  {
+    return E131_PACKET_INVALID;
+  }
+  // property values: the start code and the DMX slots
+  uint16_t lvCount = Realtime_Read16(&inData[123]);
+  if ((lvCount < 1) || (lvCount > (E131_MAX_SLOTS + 1)) || ((125 + lvCount) > inLength) || (inData[125] != 0))
+  {
+    return E131_PACKET_INVALID;
+  }
+  outPacket->SyncUniverse = Realtime_Read16(&inData[109]);
+  outPacket->Sequence = inData[111];
+  outPacket->Options = inData[112];
+  outPacket->Universe = Realtime_Read16(&inData[113]);
+  outPacket->Slots = &inData[126];
+  outPacket->NumSlots = lvCount - 1;
+  return E131_PACKET_DATA;
+}
+
+void E131Receiver_Process(const uint8_t *inData, uint16_t inLength, const RealtimeOutput *inOutput)
+{
+  E131Packet lvPacket;
+
+  s_Stats.Packets++;
+  s_Stats.Bytes += inLength;
+  switch (E131Receiver_Parse(inData, inLength, &lvPacket))
+  {
+    case E131_PACKET_SYNC:
+      s_Stats.Sync++;
+      E131Frame_Sync(lvPacket.Universe);
+      break;
+    case E131_PACKET_DATA:
+      if (lvPacket.Options & E131_OPTION_PREVIEW)
+      {
+        s_Stats.Preview++;
+      }
+      else if ((lvPacket.Universe >= E131_UNIVERSE_START) && (lvPacket.Universe <= E131_UNIVERSE_END))
+      {
+        RealtimeUniverse lvUniverse;
+        lvUniverse.Index = lvPacket.Universe - E131_UNIVERSE_START;
+        lvUniverse.Sequence = lvPacket.Sequence;
+        lvUniverse.SyncAddress = lvPacket.SyncUniverse;
+        lvUniverse.Slots = lvPacket.Slots;
+        lvUniverse.NumSlots = lvPacket.NumSlots;
+        Realtime_StoreUniverse(&lvUniverse, inOutput);
+      }
+      break;
+    default:
+      s_Stats.Invalid++;
+      break;
+  }
+}
+
+const E131ReceiverStats *E131Receiver_GetStats()
+{
+  return &s_Stats;
+}
+
+void E131Receiver_ClearStats()
+{
+  memset(&s_Stats, 0, sizeof(s_Stats));
+}
+
+void E131Receiver_PrintStats()
+{
+  Serial.print(F("E1.31 Packets: "));
+  Serial.print(s_Stats.Packets);
+  Serial.print(F("; Bytes: "));
+  Serial.print(s_Stats.Bytes);
+  Serial.print(F("; Invalid: "));
+  Serial.print(s_Stats.Invalid);
+  Serial.print(F("; Preview: "));
+  Serial.print(s_Stats.Preview);
+  Serial.print(F("; Sync: "));
+  Serial.println(s_Stats.Sync);
+}
+
+/*** PRIVATE FUNCTIONS ***/
+
+#ifdef BOARD_ESP32
+// Runs in the AsyncUDP task: only the copy into the pool, the packet is parsed in loop()
+static void E131Receiver_OnPacket(AsyncUDPPacket &inPacket)
+{
+  PacketPool_Put(inPacket.data(), inPacket.length(), REALTIME_PROTOCOL_E131);
+}
+
+// The raw IGMP calls must run in the lwIP thread. It also runs the listen and close of AsyncUDP, in the order they are
+// queued, so the groups are left before the socket is closed.
+static void E131Receiver_JoinGroups(bool inJoin)
+{
+  if (E131_UNIVERSE_END > E131_UNIVERSE_START)
+  {
+    s_GroupInterface.addr = (uint32_t)WiFi.localIP();
+    tcpip_callback(E131Receiver_ChangeGroups, inJoin ? &s_GroupInterface : NULL);
+  }
+}
+
+// In the lwIP thread, inJoin is NULL to leave the groups
+static void E131Receiver_ChangeGroups(void *inJoin)
+{
+  ip4_addr_t lvGroup;
+
+  for (uint16_t lvUniverse = E131_UNIVERSE_START + 1; lvUniverse <= E131_UNIVERSE_END; lvUniverse++)
+  {
+    lvGroup.addr = (uint32_t)IPAddress(239, 255, lvUniverse >> 8, lvUniverse & 0xff);
+    if (inJoin != NULL)
+    {
+      igmp_joingroup(&s_GroupInterface, &lvGroup);
+    }
+    else
+    {
+      igmp_leavegroup(&s_GroupInterface, &lvGroup);
+    }
+  }
+}
+#endif //BOARD_ESP32
+
+#endif //INCLUDE_REALTIME_E131
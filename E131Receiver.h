@@ -0,0 +1,54 @@
+#ifndef E131RECEIVER_H
+#define E131RECEIVER_H
+
+/*** INCLUDES ***/
+#include "Settings.h"
+#include "Realtime.h"
+
+/*** DEFINES ***/
+#define E131_PORT                 5568
+#define E131_MIN_DATA_LENGTH      126       // data packet up to the start code
+#define E131_SYNC_LENGTH          49
+
+/*** TYPE DEFINITIONS ***/
+typedef enum
+{
+  E131_PACKET_INVALID,
+  E131_PACKET_DATA,
+  E131_PACKET_SYNC
+} E131PacketType;
+
+// Fields of a packet, pointing into the receive buffer
+typedef struct
+{
+  uint16_t Universe;                      // data: universe, sync: synchronization address
+  uint16_t SyncUniverse;                  // data: synchronization address, 0: none
+  uint8_t Sequence;
+  uint8_t Options;
+  const uint8_t *Slots;                   // DMX data after the start code
+  uint16_t NumSlots;
+} E131Packet;
+
+typedef struct
+{
+  unsigned long Packets;
+  unsigned long Bytes;                    // UDP payload of the packets
+  unsigned long Invalid;                  // not E1.31, or not DMX data
+  unsigned long Preview;                  // preview data, not for display
+  unsigned long Sync;
+} E131ReceiverStats;
+
+/*** PUBLIC FUNCTIONS ***/
+// Joins the multicast groups of the strip's universes
+bool E131Receiver_Begin(void);
+void E131Receiver_Stop(void);
+
+E131PacketType E131Receiver_Parse(const uint8_t *inData, uint16_t inLength, E131Packet *outPacket);
+// Decodes a datagram from the PacketPool into the frame
+void E131Receiver_Process(const uint8_t *inData, uint16_t inLength, const RealtimeOutput *inOutput);
+
+const E131ReceiverStats *E131Receiver_GetStats(void);
+void E131Receiver_ClearStats(void);
+void E131Receiver_PrintStats(void);
+
+#endif //E131RECEIVER_H
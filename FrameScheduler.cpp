@@ -0,0 +1,114 @@
+/*** INCLUDES ***/
+#include "FrameScheduler.h"
+
+/*** PRIVATE VARIABLES ***/
+static unsigned long s_PeriodUs = FRAME_PERIOD_MIN_US;
+static unsigned long s_DeadlineUs = 0;
+static FrameSchedulerStats s_Stats;
+
+/*** PUBLIC FUNCTIONS ***/
+
+// Make the next frame due immediately (program change, output re-enabled)
+void FrameScheduler_Reset()
+{
+  s_DeadlineUs = micros();
+}
+
+void FrameScheduler_SetPeriod(unsigned long inPeriodUs)
+{
+  if (inPeriodUs < FRAME_PERIOD_MIN_US)
+  {
+    // limit the frame rate, also prevents a period of 0 for fast programs
+    inPeriodUs = FRAME_PERIOD_MIN_US;
+  }
+  if (inPeriodUs != s_PeriodUs)
+  {
+    // keep the start of the previous frame as reference, only the distance to the next deadline changes
+    s_DeadlineUs = s_DeadlineUs - s_PeriodUs + inPeriodUs;
+    s_PeriodUs = inPeriodUs;
+  }
+}
+
+unsigned long FrameScheduler_GetPeriod()
+{
+  return s_PeriodUs;
+}
+
+bool FrameScheduler_IsFrameDue()
+{
+  unsigned long lvNowUs = micros();
+  long lvLatenessUs = (long)(lvNowUs - s_DeadlineUs);
+
+  if (lvLatenessUs < 0)
+  {
+    // deadline not reached yet
+    return false;
+  }
+
+  // Lateness accounting
+  s_Stats.Frames++;
+  s_Stats.SumLatenessUs += lvLatenessUs;
+  if ((unsigned long)lvLatenessUs > s_Stats.MaxLatenessUs)
+  {
+    s_Stats.MaxLatenessUs = lvLatenessUs;
+  }
+  if (lvLatenessUs > FRAME_LATE_THRESHOLD_US)
+  {
+    s_Stats.LateFrames++;
+  }
+  uint8_t lvBucket = 0;
+  unsigned long lvScaled = (unsigned long)lvLatenessUs >> 6;
+  while ((lvScaled != 0) && (lvBucket < (FRAME_JITTER_BUCKETS - 1)))
+  {
+    lvScaled >>= 1;
+    lvBucket++;
+  }
+  s_Stats.JitterHistogram[lvBucket]++;
+
+  if ((unsigned long)lvLatenessUs >= (s_PeriodUs * FRAME_MAX_CATCHUP))
+  {
+    // Too far behind: drop the missed frames and re-base on the current time
+    s_Stats.SkippedFrames += (unsigned long)lvLatenessUs / s_PeriodUs;
+    s_DeadlineUs = lvNowUs + s_PeriodUs;
+  }
+  else
+  {
+    // Advance by exactly one period (not relative to the late wake-up), so the frame rate does not drift.
+    // A late frame is caught up by releasing the next frame(s) sooner.
+    s_DeadlineUs += s_PeriodUs;
+  }
+  return true;
+}
+
+const FrameSchedulerStats *FrameScheduler_GetStats()
+{
+  return &s_Stats;
+}
+
+void FrameScheduler_ClearStats()
+{
+  memset(&s_Stats, 0, sizeof(s_Stats));
+}
+
+void FrameScheduler_PrintStats()
+{
+  Serial.print(F("Frames: "));
+  Serial.print(s_Stats.Frames);
+  Serial.print(F("; Period: "));
+  Serial.print(s_PeriodUs);
+  Serial.print(F("us; Late: "));
+  Serial.print(s_Stats.LateFrames);
+  Serial.print(F("; Skipped: "));
+  Serial.print(s_Stats.SkippedFrames);
+  Serial.print(F("; AvgLate: "));
+  Serial.print((s_Stats.Frames > 0) ? (s_Stats.SumLatenessUs / s_Stats.Frames) : 0);
+  Serial.print(F("us; MaxLate: "));
+  Serial.print(s_Stats.MaxLatenessUs);
+  Serial.print(F("us; Jitter:"));
+  for (uint8_t i = 0; i < FRAME_JITTER_BUCKETS; i++)
+  {
+    Serial.print(' ');
+    Serial.print(s_Stats.JitterHistogram[i]);
+  }
+  Serial.println();
+}
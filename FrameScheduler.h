@@ -0,0 +1,31 @@
+#ifndef FRAMESCHEDULER_H
+#define FRAMESCHEDULER_H
+
+/*** INCLUDES ***/
+#include "Settings.h"
+
+/*** DEFINES ***/
+#define FRAME_JITTER_BUCKETS      8     // lateness histogram buckets: <64us, <128us, <256us, ... , >=4096us
+
+/*** TYPE DEFINITIONS ***/
+typedef struct
+{
+  unsigned long Frames;                 // frames released by the scheduler
+  unsigned long LateFrames;             // frames released after their deadline had passed by more than FRAME_LATE_THRESHOLD_US
+  unsigned long SkippedFrames;          // frames dropped because we were more than FRAME_MAX_CATCHUP periods behind
+  unsigned long SumLatenessUs;
+  unsigned long MaxLatenessUs;
+  unsigned long JitterHistogram[FRAME_JITTER_BUCKETS];
+} FrameSchedulerStats;
+
+/*** PUBLIC FUNCTIONS ***/
+void FrameScheduler_Reset(void);
+void FrameScheduler_SetPeriod(unsigned long inPeriodUs);
+unsigned long FrameScheduler_GetPeriod(void);
+bool FrameScheduler_IsFrameDue(void);
+
+const FrameSchedulerStats *FrameScheduler_GetStats(void);
+void FrameScheduler_ClearStats(void);
+void FrameScheduler_PrintStats(void);
+
+#endif //FRAMESCHEDULER_H
@@ -0,0 +1,314 @@
+/*** INCLUDES ***/
+#include "GoldenFrames.h"
+#include "Clock.h"
+#include "Registry.h"
+#include "Random.h"
+
+#ifdef ENABLE_GOLDEN_FRAMES
+
+#include "GoldenFrames_Data.h"
+
+/*** DEFINES ***/
+#define FNV_OFFSET_BASIS          2166136261UL
+#define FNV_PRIME                 16777619UL
+
+/*** FORWARD DECLARATIONS ***/
+static void GoldenFrames_Begin(void);
+static void GoldenFrames_End(void);
+static CLEDProgram *GoldenFrames_StartProgram(uint8_t inIndex);
+static void GoldenFrames_RenderFrame(CLEDProgram *inProgram, GoldenFrame *outFrame);
+static uint16_t GoldenFrames_SegmentLength(void);
+static uint32_t GoldenFrames_Fnv(uint32_t inHash, const uint8_t *inData, uint16_t inLength);
+static const GoldenProgramData *GoldenFrames_Find(uint32_t inNameHash);
+static void GoldenFrames_PrintHex(uint32_t inValue, uint8_t inDigits);
+
+/*** PRIVATE VARIABLES ***/
+static GlobalSettings s_SavedSettings;
+static uint16_t s_SavedNumLeds;
+static uint16_t s_SavedSeed;
+static uint32_t s_SavedRandomSeed;
+
+/*** PUBLIC FUNCTIONS ***/
+
+// Print the frame hashes of all programs as the contents of GoldenFrames_<strip>.h, see GoldenFrames_Data.h
+void GoldenFrames_Record()
+{
+  GoldenFrame lvFrame;
+  uint32_t lvStarted = 0;
+  uint8_t lvNumStarted = 0;
+
+  GoldenFrames_Begin();
+  // the programs that start, before the file: the table gets their count and what Start() prints stays out of it
+  for (uint8_t i = 0; i < min(g_NumPrograms, (uint8_t)GOLDEN_MAX_PROGRAMS); i++)
+  {
+    if (GoldenFrames_StartProgram(i) != NULL)
+    {
+      Registry_Release(i);
+      lvStarted |= (1UL << i);
+      lvNumStarted++;
+    }
+  }
+  Serial.println(F("#ifndef GOLDENFRAMES_RECORDED_H"));
+  Serial.println(F("#define GOLDENFRAMES_RECORDED_H"));
+  Serial.println();
+  Serial.println(F("// Output of GoldenFrames_Record() ('g' on the serial console) of a trusted build."));
+  Serial.println(F("// Only valid for the strip configuration it was recorded with, selected by GoldenFrames_Data.h."));
+  Serial.println();
+  Serial.print(F("#define GOLDEN_DATA_NUM_LEDS      "));
+  Serial.println(DEFAULT_NUM_LEDS);
+  Serial.print(F("#define GOLDEN_DATA_FRAMES        "));
+  Serial.println(GOLDEN_FRAMES);
+  Serial.print(F("#define GOLDEN_DATA_NUM_PROGRAMS  "));
+  Serial.println(lvNumStarted);
+  Serial.println();
+  Serial.println(F("#if GOLDEN_DATA_NUM_PROGRAMS > 0"));
+  Serial.println(F("static const GoldenProgramData c_GoldenData[GOLDEN_DATA_NUM_PROGRAMS] PROGMEM ="));
+  Serial.println(F("{"));
+  for (uint8_t i = 0; i < g_NumPrograms; i++)
+  {
+    if ((i >= GOLDEN_MAX_PROGRAMS) || ((lvStarted & (1UL << i)) == 0))
+    {
+      continue;
+    }
+    CLEDProgram *lvProgram = GoldenFrames_StartProgram(i);
+    if (lvProgram == NULL)
+    {
+      continue;
+    }
+
+    Serial.print(F("  { "));
+    GoldenFrames_PrintHex(g_ProgramRegistry[i].NameHash, 8);
+    Serial.print(F(", {   // "));
+    Serial.println(g_ProgramRegistry[i].Name);
+    for (uint16_t f = 0; f < GOLDEN_FRAMES; f++)
+    {
+      GoldenFrames_RenderFrame(lvProgram, &lvFrame);
+      Serial.print(F("    { "));
+      GoldenFrames_PrintHex(lvFrame.Hash, 8);
+      Serial.print(F(", { "));
+      for (uint8_t s = 0; s < GOLDEN_NUM_SEGMENTS; s++)
+      {
+        GoldenFrames_PrintHex(lvFrame.Segments[s], 2);
+        Serial.print((s < (GOLDEN_NUM_SEGMENTS - 1)) ? F(",") : F(" } },"));
+      }
+      Serial.println();
+    }
+    Registry_Release(i);
+    Serial.println(F("  } },"));
+    yield();
+  }
+  Serial.println(F("};"));
+  Serial.println(F("#endif"));
+  Serial.println();
+  Serial.println(F("#endif //GOLDENFRAMES_RECORDED_H"));
+  GoldenFrames_End();
+}
+
+// Render all programs and compare against GoldenFrames_Data.h.
+// Reports the first diverging frame of each program and the part of the strip that differs.
+bool GoldenFrames_Compare()
+{
+  GoldenFrame lvFrame;
+  GoldenFrame lvGolden;
+  uint8_t lvFailed = 0;
+  uint8_t lvMissing = 0;
+  uint8_t lvSkipped = 0;
+
+  if ((GOLDEN_DATA_NUM_LEDS != DEFAULT_NUM_LEDS) || (GOLDEN_DATA_FRAMES != GOLDEN_FRAMES))
+  {
+    Serial.print(F("Golden: no data for "));
+    Serial.print(DEFAULT_NUM_LEDS);
+    Serial.println(F(" LEDs, record with 'g'"));
+    return false;
+  }
+
+  GoldenFrames_Begin();
+  for (uint8_t i = 0; i < g_NumPrograms; i++)
+  {
+    const GoldenProgramData *lvData = GoldenFrames_Find(g_ProgramRegistry[i].NameHash);
+
+    CLEDProgram *lvProgram = GoldenFrames_StartProgram(i);
+
+    Serial.print(g_ProgramRegistry[i].Name);
+    if (lvProgram == NULL)
+    {
+      if (lvData != NULL)
+      {
+        // recorded, so it started on the recording build
+        Serial.println(F(": not started"));
+        lvFailed++;
+      }
+      else
+      {
+        Serial.println(F(": skipped, not started"));
+        lvSkipped++;
+      }
+      continue;
+    }
+    if (lvData == NULL)
+    {
+      Serial.println(F(": missing"));
+      Registry_Release(i);
+      lvMissing++;
+      continue;
+    }
+    uint16_t f;
+    for (f = 0; f < GOLDEN_FRAMES; f++)
+    {
+      GoldenFrames_RenderFrame(lvProgram, &lvFrame);
+      memcpy_P(&lvGolden, &lvData->Frames[f], sizeof(GoldenFrame));
+      if (lvFrame.Hash != lvGolden.Hash)
+      {
+        break;
+      }
+    }
+
+    if (f >= GOLDEN_FRAMES)
+    {
+      Serial.println(F(": OK"));
+    }
+    else
+    {
+      uint16_t lvSegmentLength = GoldenFrames_SegmentLength();
+      uint8_t s = 0;
+      while ((s < (GOLDEN_NUM_SEGMENTS - 1)) && (lvFrame.Segments[s] == lvGolden.Segments[s]))
+      {
+        s++;
+      }
+      uint16_t lvStart = s * lvSegmentLength;
+      uint16_t lvEnd = min((uint16_t)(lvStart + lvSegmentLength), (uint16_t)DEFAULT_NUM_LEDS) - 1;
+
+      Serial.print(F(": frame "));
+      Serial.print(f);
+      Serial.print(F(" differs in LEDs "));
+      Serial.print(lvStart);
+      Serial.print(F(".."));
+      Serial.print(lvEnd);
+      Serial.print(F(":"));
+      for (uint16_t j = lvStart; j <= lvEnd; j++)
+      {
+        Serial.print(F(" "));
+        GoldenFrames_PrintHex(((uint32_t)g_LEDBuffer[j].r << 16) | ((uint32_t)g_LEDBuffer[j].g << 8) | g_LEDBuffer[j].b, 6);
+      }
+      Serial.println();
+      lvFailed++;
+    }
+    Registry_Release(i);
+    yield();
+  }
+  GoldenFrames_End();
+
+  Serial.print(F("Golden: "));
+  Serial.print(g_NumPrograms - lvFailed - lvMissing - lvSkipped);
+  Serial.print(F(" OK, "));
+  Serial.print(lvFailed);
+  Serial.print(F(" failed, "));
+  Serial.print(lvMissing);
+  Serial.print(F(" missing, "));
+  Serial.print(lvSkipped);
+  Serial.println(F(" skipped"));
+  return (lvFailed == 0) && (lvMissing == 0);
+}
+
+/*** PRIVATE FUNCTIONS ***/
+
+// Fixed settings for every run, the user settings are restored afterwards
+static void GoldenFrames_Begin()
+{
+  s_SavedSettings = g_GlobalSettings;
+  s_SavedNumLeds = NUM_LEDS;
+  s_SavedSeed = random16_get_seed();
+  s_SavedRandomSeed = Random_GetSeed();
+
+  g_GlobalSettings.Speed = GOLDEN_SPEED;
+  g_GlobalSettings.Hue = GOLDEN_HUE;
+  g_GlobalSettings.Saturation = DEFAULT_SATURATION;
+  NUM_LEDS = DEFAULT_NUM_LEDS;
+}
+
+static void GoldenFrames_End()
+{
+  Clock_StopVirtual();
+  random16_set_seed(s_SavedSeed);
+  Random_Seed(s_SavedRandomSeed);
+  g_GlobalSettings = s_SavedSettings;
+  NUM_LEDS = s_SavedNumLeds;
+  g_LEDS = g_LEDBuffer;
+  fill_solid(g_LEDBuffer, DEFAULT_NUM_LEDS, CRGB(0,0,0));
+}
+
+// Construct and start a program on its part of the strip. NULL if no program slot is free or Start() failed, e.g.
+// Realtime without a network.
+static CLEDProgram *GoldenFrames_StartProgram(uint8_t inIndex)
+{
+  fill_solid(g_LEDBuffer, DEFAULT_NUM_LEDS, CRGB(0,0,0));
+  g_LEDS = &g_LEDBuffer[g_ProgramRegistry[inIndex].StartLED];
+  NUM_LEDS = DEFAULT_NUM_LEDS - g_ProgramRegistry[inIndex].StartLED;
+  random16_set_seed(GOLDEN_SEED);
+  Random_Seed(GOLDEN_SEED);               // the program stream is seeded by Registry_Acquire()
+  Clock_StartVirtual(0);
+  CLEDProgram *lvProgram = Registry_Acquire(inIndex);
+  if ((lvProgram != NULL) && !lvProgram->Start())
+  {
+    Registry_Release(inIndex);
+    lvProgram = NULL;
+  }
+  return lvProgram;
+}
+
+static void GoldenFrames_RenderFrame(CLEDProgram *inProgram, GoldenFrame *outFrame)
+{
+  uint16_t lvSegmentLength = GoldenFrames_SegmentLength();
+
+  Clock_Advance(GOLDEN_FRAME_US);
+  inProgram->Update(GOLDEN_FRAME_US);
+
+  // the complete strip: LEDs before the program's StartLED have to stay dark
+  outFrame->Hash = GoldenFrames_Fnv(FNV_OFFSET_BASIS, (const uint8_t *)g_LEDBuffer, DEFAULT_NUM_LEDS * sizeof(CRGB));
+  for (uint8_t s = 0; s < GOLDEN_NUM_SEGMENTS; s++)
+  {
+    uint16_t lvStart = min((uint16_t)(s * lvSegmentLength), (uint16_t)DEFAULT_NUM_LEDS);
+    uint16_t lvEnd = min((uint16_t)(lvStart + lvSegmentLength), (uint16_t)DEFAULT_NUM_LEDS);
+    uint32_t lvHash = GoldenFrames_Fnv(FNV_OFFSET_BASIS, (const uint8_t *)&g_LEDBuffer[lvStart], (lvEnd - lvStart) * sizeof(CRGB));
+    outFrame->Segments[s] = lvHash ^ (lvHash >> 8) ^ (lvHash >> 16) ^ (lvHash >> 24);
+  }
+}
+
+static uint16_t GoldenFrames_SegmentLength()
+{
+  return (DEFAULT_NUM_LEDS + GOLDEN_NUM_SEGMENTS - 1) / GOLDEN_NUM_SEGMENTS;
+}
+
+static uint32_t GoldenFrames_Fnv(uint32_t inHash, const uint8_t *inData, uint16_t inLength)
+{
+  while (inLength-- > 0)
+  {
+    inHash = (inHash ^ *inData++) * FNV_PRIME;
+  }
+  return inHash;
+}
+
+static const GoldenProgramData *GoldenFrames_Find(uint32_t inNameHash)
+{
+#if GOLDEN_DATA_NUM_PROGRAMS > 0
+  for (uint8_t i = 0; i < GOLDEN_DATA_NUM_PROGRAMS; i++)
+  {
+    if (pgm_read_dword(&c_GoldenData[i].NameHash) == inNameHash)
+    {
+      return &c_GoldenData[i];
+    }
+  }
+#else
+  (void)inNameHash;
+#endif
+  return NULL;
+}
+
+static void GoldenFrames_PrintHex(uint32_t inValue, uint8_t inDigits)
+{
+  char lvBuffer[11];
+  snprintf(lvBuffer, sizeof(lvBuffer), "0x%0*lX", inDigits, (unsigned long)inValue);
+  Serial.print(lvBuffer);
+}
+
+#endif //ENABLE_GOLDEN_FRAMES
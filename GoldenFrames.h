@@ -0,0 +1,36 @@
+#ifndef GOLDENFRAMES_H
+#define GOLDENFRAMES_H
+
+/*** INCLUDES ***/
+#include "Settings.h"
+
+/*** DEFINES ***/
+#define GOLDEN_FRAMES             64                    // frames hashed per program
+#define GOLDEN_NUM_SEGMENTS       16                    // per frame, a short hash of each part of the strip locates a difference
+#define GOLDEN_FRAME_US           FRAME_PERIOD_MIN_US   // virtual time between frames
+#define GOLDEN_SEED               0x5EED                // random16 seed at the start of every program
+#define GOLDEN_SPEED              200
+#define GOLDEN_HUE                0
+#define GOLDEN_MAX_PROGRAMS       32                    // at most recorded per strip
+
+/*** TYPE DEFINITIONS ***/
+typedef struct
+{
+  uint32_t Hash;                                        // FNV-1a hash of all pixels
+  uint8_t Segments[GOLDEN_NUM_SEGMENTS];                // folded FNV-1a hash of each segment
+} GoldenFrame;
+
+typedef struct
+{
+  uint32_t NameHash;                                    // ProgramEntry::NameHash
+  GoldenFrame Frames[GOLDEN_FRAMES];
+} GoldenProgramData;
+
+/*** PUBLIC FUNCTIONS ***/
+// Both render every program from a fixed seed, clock and settings.
+// Record prints the data of the current strip configuration, Compare checks the current build against the data
+// GoldenFrames_Data.h selects for it.
+void GoldenFrames_Record(void);
+bool GoldenFrames_Compare(void);
+
+#endif //GOLDENFRAMES_H
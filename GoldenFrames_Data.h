@@ -0,0 +1,37 @@
+#ifndef GOLDENFRAMES_DATA_H
+#define GOLDENFRAMES_DATA_H
+
+// Golden frames of the strip configurations that have them, each file is the output of 'g' on that configuration.
+// Both are checked by "make -C host check".
+//
+// LEDSTRIP2 registers every program. Its table was recorded from the kernels of 574b0e1, the first tree with the
+// golden harness and before any optimisation, for the programs whose output the optimisations kept:
+//   Solid, Solid2, Chase, Breathe, Strobe, ColorWipe, Rainbow, Christmas
+// The other programs were re-recorded after the change that intentionally altered their output:
+//   Solid3, Chase2, Chase3  user-011: own offset per instance instead of one static shared by the class;
+//                           user-017: no 8 bit offset wrap in Chase
+//   Gradient                user-018: the ring wraps the hue at the strip length, baseline wrapped at 256 LEDs
+//   Twinkle                 user-013, user-014: per-LED twinkle state, program random streams
+//   Fire                    user-012, user-014: per-LED heat field
+//   Glitter, Meteor,        user-014, user-016: program random streams, sub-pixel particles, particle pool
+//   Confetti, Juggle,       scaled with the strip
+//   Bubble
+//   Magnets                 user-014, user-015: rebuilt simulation
+//   Twinkle2                new program
+// Sound and Realtime do not start without a capture or a network, so the host does not record them and 'G' skips
+// them. The kick tracks of "make -C host check" cover the audio path of Sound.
+//
+// LEDSTRIP4 starts most programs at LED 1. Since user-008 they render into their own window of the strip, so the
+// pattern phase of Solid2a, Solid3a, Solid6a, Chase2, Chase3 and the ColorWipe cycle count from the window start.
+// Gradient wraps as on LEDSTRIP2. The other programs match 574b0e1.
+#if defined(LEDSTRIP2)
+  #include "GoldenFrames_LEDSTRIP2.h"
+#elif defined(LEDSTRIP4)
+  #include "GoldenFrames_LEDSTRIP4.h"
+#else
+  #define GOLDEN_DATA_NUM_LEDS      0
+  #define GOLDEN_DATA_FRAMES        0
+  #define GOLDEN_DATA_NUM_PROGRAMS  0
+#endif
+
+#endif //GOLDENFRAMES_DATA_H
@@ -0,0 +1,1403 @@
+#ifndef GOLDENFRAMES_RECORDED_H
+#define GOLDENFRAMES_RECORDED_H
+
+// Output of GoldenFrames_Record() ('g' on the serial console) of a trusted build.
+// Only valid for the strip configuration it was recorded with, selected by GoldenFrames_Data.h.
+
+#define GOLDEN_DATA_NUM_LEDS      300
+#define GOLDEN_DATA_FRAMES        64
+#define GOLDEN_DATA_NUM_PROGRAMS  21
+
+#if GOLDEN_DATA_NUM_PROGRAMS > 0
+static const GoldenProgramData c_GoldenData[GOLDEN_DATA_NUM_PROGRAMS] PROGMEM =
+{
+  { 0x56FBEC94, {   // Solid
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+  } },
+  { 0x94958952, {   // Solid2
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xC2753B75, { 0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60 } },
+    { 0xC2753B75, { 0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60 } },
+    { 0xC2753B75, { 0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60 } },
+    { 0xC2753B75, { 0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xC2753B75, { 0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60 } },
+    { 0xC2753B75, { 0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60 } },
+    { 0xC2753B75, { 0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60 } },
+    { 0xC2753B75, { 0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xC2753B75, { 0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60 } },
+    { 0xC2753B75, { 0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60 } },
+    { 0xC2753B75, { 0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60 } },
+    { 0xC2753B75, { 0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60 } },
+    { 0xC2753B75, { 0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xC2753B75, { 0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60 } },
+    { 0xC2753B75, { 0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60 } },
+    { 0xC2753B75, { 0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60 } },
+    { 0xC2753B75, { 0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xC2753B75, { 0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60 } },
+    { 0xC2753B75, { 0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60 } },
+    { 0xC2753B75, { 0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60 } },
+    { 0xC2753B75, { 0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xC2753B75, { 0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60 } },
+    { 0xC2753B75, { 0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60 } },
+    { 0xC2753B75, { 0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60 } },
+    { 0xC2753B75, { 0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60 } },
+    { 0xC2753B75, { 0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xC2753B75, { 0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60 } },
+    { 0xC2753B75, { 0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60 } },
+    { 0xC2753B75, { 0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60 } },
+    { 0xC2753B75, { 0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+    { 0xD707FBC5, { 0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x96,0x60,0x25 } },
+  } },
+  { 0x95958AE5, {   // Solid3
+    { 0x4C2C8841, { 0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x62 } },
+    { 0x4C2C8841, { 0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x62 } },
+    { 0x4C2C8841, { 0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x62 } },
+    { 0x4C2C8841, { 0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x62 } },
+    { 0x4C2C8841, { 0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x62 } },
+    { 0x8D0B2C99, { 0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0x99 } },
+    { 0x8D0B2C99, { 0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0x99 } },
+    { 0x8D0B2C99, { 0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0x99 } },
+    { 0x8D0B2C99, { 0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0x99 } },
+    { 0xD48D3209, { 0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0xD8 } },
+    { 0xD48D3209, { 0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0xD8 } },
+    { 0xD48D3209, { 0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0xD8 } },
+    { 0xD48D3209, { 0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0xD8 } },
+    { 0xD48D3209, { 0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0xD8 } },
+    { 0x4C2C8841, { 0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x62 } },
+    { 0x4C2C8841, { 0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x62 } },
+    { 0x4C2C8841, { 0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x62 } },
+    { 0x4C2C8841, { 0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x62 } },
+    { 0x8D0B2C99, { 0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0x99 } },
+    { 0x8D0B2C99, { 0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0x99 } },
+    { 0x8D0B2C99, { 0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0x99 } },
+    { 0x8D0B2C99, { 0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0x99 } },
+    { 0xD48D3209, { 0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0xD8 } },
+    { 0xD48D3209, { 0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0xD8 } },
+    { 0xD48D3209, { 0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0xD8 } },
+    { 0xD48D3209, { 0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0xD8 } },
+    { 0xD48D3209, { 0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0xD8 } },
+    { 0x4C2C8841, { 0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x62 } },
+    { 0x4C2C8841, { 0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x62 } },
+    { 0x4C2C8841, { 0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x62 } },
+    { 0x4C2C8841, { 0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x62 } },
+    { 0x8D0B2C99, { 0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0x99 } },
+    { 0x8D0B2C99, { 0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0x99 } },
+    { 0x8D0B2C99, { 0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0x99 } },
+    { 0x8D0B2C99, { 0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0x99 } },
+    { 0xD48D3209, { 0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0xD8 } },
+    { 0xD48D3209, { 0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0xD8 } },
+    { 0xD48D3209, { 0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0xD8 } },
+    { 0xD48D3209, { 0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0xD8 } },
+    { 0xD48D3209, { 0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0xD8 } },
+    { 0x4C2C8841, { 0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x62 } },
+    { 0x4C2C8841, { 0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x62 } },
+    { 0x4C2C8841, { 0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x62 } },
+    { 0x4C2C8841, { 0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x62 } },
+    { 0x8D0B2C99, { 0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0x99 } },
+    { 0x8D0B2C99, { 0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0x99 } },
+    { 0x8D0B2C99, { 0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0x99 } },
+    { 0x8D0B2C99, { 0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0x99 } },
+    { 0xD48D3209, { 0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0xD8 } },
+    { 0xD48D3209, { 0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0xD8 } },
+    { 0xD48D3209, { 0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0xD8 } },
+    { 0xD48D3209, { 0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0xD8 } },
+    { 0xD48D3209, { 0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0xD8 } },
+    { 0x4C2C8841, { 0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x62 } },
+    { 0x4C2C8841, { 0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x62 } },
+    { 0x4C2C8841, { 0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x62 } },
+    { 0x4C2C8841, { 0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x62 } },
+    { 0x8D0B2C99, { 0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0x99 } },
+    { 0x8D0B2C99, { 0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0x99 } },
+    { 0x8D0B2C99, { 0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0x99 } },
+    { 0x8D0B2C99, { 0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0x99 } },
+    { 0xD48D3209, { 0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0xD8 } },
+    { 0xD48D3209, { 0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0xD8 } },
+    { 0xD48D3209, { 0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0x2D,0x90,0xEA,0xD8 } },
+  } },
+  { 0xF3DCE5DD, {   // Chase
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x42CB8BCD, { 0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x9D } },
+    { 0x42CB8BCD, { 0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x9D } },
+    { 0x42CB8BCD, { 0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x9D } },
+    { 0x42CB8BCD, { 0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x9D } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x42CB8BCD, { 0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x9D } },
+    { 0x42CB8BCD, { 0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x9D } },
+    { 0x42CB8BCD, { 0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x9D } },
+    { 0x42CB8BCD, { 0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x9D } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x42CB8BCD, { 0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x9D } },
+    { 0x42CB8BCD, { 0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x9D } },
+    { 0x42CB8BCD, { 0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x9D } },
+    { 0x42CB8BCD, { 0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x9D } },
+    { 0x42CB8BCD, { 0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x9D } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x42CB8BCD, { 0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x9D } },
+    { 0x42CB8BCD, { 0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x9D } },
+    { 0x42CB8BCD, { 0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x9D } },
+    { 0x42CB8BCD, { 0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x9D } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x42CB8BCD, { 0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x9D } },
+    { 0x42CB8BCD, { 0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x9D } },
+    { 0x42CB8BCD, { 0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x9D } },
+    { 0x42CB8BCD, { 0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x9D } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x42CB8BCD, { 0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x9D } },
+    { 0x42CB8BCD, { 0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x9D } },
+    { 0x42CB8BCD, { 0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x9D } },
+    { 0x42CB8BCD, { 0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x9D } },
+    { 0x42CB8BCD, { 0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x9D } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x42CB8BCD, { 0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x9D } },
+    { 0x42CB8BCD, { 0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x9D } },
+    { 0x42CB8BCD, { 0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x9D } },
+    { 0x42CB8BCD, { 0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x9D } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+    { 0x0D4906FD, { 0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x4E,0x5D,0x86 } },
+  } },
+  { 0xD3BDF73D, {   // Chase2
+    { 0xB72443BD, { 0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xB6 } },
+    { 0xB72443BD, { 0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xB6 } },
+    { 0xB72443BD, { 0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xB6 } },
+    { 0xB72443BD, { 0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xB6 } },
+    { 0xB72443BD, { 0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xB6 } },
+    { 0x1AFF2C0D, { 0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0xDA } },
+    { 0x1AFF2C0D, { 0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0xDA } },
+    { 0x1AFF2C0D, { 0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0xDA } },
+    { 0x1AFF2C0D, { 0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0xDA } },
+    { 0x67332EFD, { 0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x7D } },
+    { 0x67332EFD, { 0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x7D } },
+    { 0x67332EFD, { 0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x7D } },
+    { 0x67332EFD, { 0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x7D } },
+    { 0x67332EFD, { 0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x7D } },
+    { 0xD44199CD, { 0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x62 } },
+    { 0xD44199CD, { 0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x62 } },
+    { 0xD44199CD, { 0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x62 } },
+    { 0xD44199CD, { 0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x62 } },
+    { 0x33C1983D, { 0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0xBB } },
+    { 0x33C1983D, { 0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0xBB } },
+    { 0x33C1983D, { 0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0xBB } },
+    { 0x33C1983D, { 0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0xBB } },
+    { 0x1219B58D, { 0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0x71 } },
+    { 0x1219B58D, { 0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0x71 } },
+    { 0x1219B58D, { 0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0x71 } },
+    { 0x1219B58D, { 0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0x71 } },
+    { 0x1219B58D, { 0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0x71 } },
+    { 0xB72443BD, { 0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xB6 } },
+    { 0xB72443BD, { 0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xB6 } },
+    { 0xB72443BD, { 0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xB6 } },
+    { 0xB72443BD, { 0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xB6 } },
+    { 0x1AFF2C0D, { 0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0xDA } },
+    { 0x1AFF2C0D, { 0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0xDA } },
+    { 0x1AFF2C0D, { 0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0xDA } },
+    { 0x1AFF2C0D, { 0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0xDA } },
+    { 0x67332EFD, { 0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x7D } },
+    { 0x67332EFD, { 0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x7D } },
+    { 0x67332EFD, { 0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x7D } },
+    { 0x67332EFD, { 0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x7D } },
+    { 0x67332EFD, { 0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x7D } },
+    { 0xD44199CD, { 0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x62 } },
+    { 0xD44199CD, { 0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x62 } },
+    { 0xD44199CD, { 0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x62 } },
+    { 0xD44199CD, { 0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x62 } },
+    { 0x33C1983D, { 0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0xBB } },
+    { 0x33C1983D, { 0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0xBB } },
+    { 0x33C1983D, { 0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0xBB } },
+    { 0x33C1983D, { 0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0xBB } },
+    { 0x1219B58D, { 0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0x71 } },
+    { 0x1219B58D, { 0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0x71 } },
+    { 0x1219B58D, { 0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0x71 } },
+    { 0x1219B58D, { 0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0x71 } },
+    { 0x1219B58D, { 0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0x71 } },
+    { 0xB72443BD, { 0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xB6 } },
+    { 0xB72443BD, { 0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xB6 } },
+    { 0xB72443BD, { 0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xB6 } },
+    { 0xB72443BD, { 0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xB6 } },
+    { 0x1AFF2C0D, { 0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0xDA } },
+    { 0x1AFF2C0D, { 0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0xDA } },
+    { 0x1AFF2C0D, { 0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0xDA } },
+    { 0x1AFF2C0D, { 0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0xDA } },
+    { 0x67332EFD, { 0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x7D } },
+    { 0x67332EFD, { 0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x7D } },
+    { 0x67332EFD, { 0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x45,0x4C,0xD7,0xC5,0x4A,0x34,0x7D } },
+  } },
+  { 0xD2BDF5AA, {   // Chase3
+    { 0xC941DD99, { 0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xC6 } },
+    { 0xC941DD99, { 0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xC6 } },
+    { 0xC941DD99, { 0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xC6 } },
+    { 0xC941DD99, { 0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xC6 } },
+    { 0xC941DD99, { 0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xC6 } },
+    { 0x165AFA21, { 0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x84 } },
+    { 0x165AFA21, { 0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x84 } },
+    { 0x165AFA21, { 0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x84 } },
+    { 0x165AFA21, { 0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x84 } },
+    { 0xDA33BEB9, { 0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0xE3 } },
+    { 0xDA33BEB9, { 0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0xE3 } },
+    { 0xDA33BEB9, { 0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0xE3 } },
+    { 0xDA33BEB9, { 0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0xE3 } },
+    { 0xDA33BEB9, { 0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0xE3 } },
+    { 0x72E1BB7E, { 0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x40 } },
+    { 0x72E1BB7E, { 0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x40 } },
+    { 0x72E1BB7E, { 0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x40 } },
+    { 0x72E1BB7E, { 0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x40 } },
+    { 0x62D641C4, { 0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x2D } },
+    { 0x62D641C4, { 0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x2D } },
+    { 0x62D641C4, { 0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x2D } },
+    { 0x62D641C4, { 0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x2D } },
+    { 0xED8FE4D6, { 0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0x24 } },
+    { 0xED8FE4D6, { 0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0x24 } },
+    { 0xED8FE4D6, { 0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0x24 } },
+    { 0xED8FE4D6, { 0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0x24 } },
+    { 0xED8FE4D6, { 0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0x24 } },
+    { 0x948012CC, { 0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xA3 } },
+    { 0x948012CC, { 0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xA3 } },
+    { 0x948012CC, { 0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xA3 } },
+    { 0x948012CC, { 0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xA3 } },
+    { 0xB60BFEEE, { 0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0xFC } },
+    { 0xB60BFEEE, { 0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0xFC } },
+    { 0xB60BFEEE, { 0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0xFC } },
+    { 0xB60BFEEE, { 0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0xFC } },
+    { 0xF6700A14, { 0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x22 } },
+    { 0xF6700A14, { 0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x22 } },
+    { 0xF6700A14, { 0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x22 } },
+    { 0xF6700A14, { 0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x22 } },
+    { 0xF6700A14, { 0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x22 } },
+    { 0x43E0E3C6, { 0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xE4 } },
+    { 0x43E0E3C6, { 0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xE4 } },
+    { 0x43E0E3C6, { 0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xE4 } },
+    { 0x43E0E3C6, { 0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xE4 } },
+    { 0xF5A7239C, { 0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC7 } },
+    { 0xF5A7239C, { 0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC7 } },
+    { 0xF5A7239C, { 0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC7 } },
+    { 0xF5A7239C, { 0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC7 } },
+    { 0xC941DD99, { 0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xC6 } },
+    { 0xC941DD99, { 0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xC6 } },
+    { 0xC941DD99, { 0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xC6 } },
+    { 0xC941DD99, { 0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xC6 } },
+    { 0xC941DD99, { 0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xC6 } },
+    { 0x165AFA21, { 0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x84 } },
+    { 0x165AFA21, { 0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x84 } },
+    { 0x165AFA21, { 0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x84 } },
+    { 0x165AFA21, { 0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x84 } },
+    { 0xDA33BEB9, { 0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0xE3 } },
+    { 0xDA33BEB9, { 0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0xE3 } },
+    { 0xDA33BEB9, { 0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0xE3 } },
+    { 0xDA33BEB9, { 0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0xE3 } },
+    { 0x72E1BB7E, { 0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x40 } },
+    { 0x72E1BB7E, { 0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x40 } },
+    { 0x72E1BB7E, { 0x35,0xDA,0x73,0xB7,0x55,0xD2,0xD4,0x8E,0x4B,0x16,0xC0,0x35,0xDA,0x73,0xB7,0x40 } },
+  } },
+  { 0x014231A6, {   // Breathe
+    { 0xFA108F55, { 0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0x94 } },
+    { 0x0B1E4545, { 0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x49 } },
+    { 0x719813F9, { 0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x55 } },
+    { 0x79B55C51, { 0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x20 } },
+    { 0x8E5B8655, { 0xA1,0xA1,0xA1,0xA1,0xA1,0xA1,0xA1,0xA1,0xA1,0xA1,0xA1,0xA1,0xA1,0xA1,0xA1,0xDB } },
+    { 0x1724FB41, { 0x1D,0x1D,0x1D,0x1D,0x1D,0x1D,0x1D,0x1D,0x1D,0x1D,0x1D,0x1D,0x1D,0x1D,0x1D,0xEC } },
+    { 0xBFA9FCE9, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0x31 } },
+    { 0xD22ADAA1, { 0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0xC2 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xD22ADAA1, { 0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0xC2 } },
+    { 0x77387259, { 0xE1,0xE1,0xE1,0xE1,0xE1,0xE1,0xE1,0xE1,0xE1,0xE1,0xE1,0xE1,0xE1,0xE1,0xE1,0x57 } },
+    { 0x11A7E079, { 0x7D,0x7D,0x7D,0x7D,0x7D,0x7D,0x7D,0x7D,0x7D,0x7D,0x7D,0x7D,0x7D,0x7D,0x7D,0x47 } },
+    { 0x57CA6B85, { 0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x13 } },
+    { 0x5ACC25E9, { 0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x52 } },
+    { 0xEEB53729, { 0x8D,0x8D,0x8D,0x8D,0x8D,0x8D,0x8D,0x8D,0x8D,0x8D,0x8D,0x8D,0x8D,0x8D,0x8D,0x93 } },
+    { 0xABBCBE91, { 0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x77 } },
+    { 0x41B46DD1, { 0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,0xC2,0x7A } },
+    { 0x5CB91245, { 0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x6B } },
+    { 0x0D997E15, { 0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x1C } },
+    { 0xF829C091, { 0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0xC1 } },
+    { 0xDBD83DB5, { 0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0xD0 } },
+    { 0x82B6ACA1, { 0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0xFA } },
+    { 0x1DDDF345, { 0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0x85 } },
+    { 0x68CAE745, { 0x8A,0x8A,0x8A,0x8A,0x8A,0x8A,0x8A,0x8A,0x8A,0x8A,0x8A,0x8A,0x8A,0x8A,0x8A,0x3D } },
+    { 0x6011F6F5, { 0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x3A } },
+    { 0x50322F05, { 0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xF3 } },
+    { 0x0FB96A85, { 0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0xBE } },
+    { 0x50322F05, { 0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xF3 } },
+    { 0x6011F6F5, { 0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x3A } },
+    { 0x15365581, { 0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0xAE } },
+    { 0x1DDDF345, { 0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0x85 } },
+    { 0x42420085, { 0xC6,0xC6,0xC6,0xC6,0xC6,0xC6,0xC6,0xC6,0xC6,0xC6,0xC6,0xC6,0xC6,0xC6,0xC6,0x06 } },
+    { 0x4D6E2FA9, { 0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0x86 } },
+    { 0x6C24CAF5, { 0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x6A,0x79 } },
+    { 0x0D997E15, { 0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x1C } },
+    { 0xE0C8C8F5, { 0xCA,0xCA,0xCA,0xCA,0xCA,0xCA,0xCA,0xCA,0xCA,0xCA,0xCA,0xCA,0xCA,0xCA,0xCA,0xB3 } },
+    { 0xFF6A1155, { 0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x09 } },
+    { 0x0B1E4545, { 0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x49 } },
+    { 0x995CBEB1, { 0xCA,0xCA,0xCA,0xCA,0xCA,0xCA,0xCA,0xCA,0xCA,0xCA,0xCA,0xCA,0xCA,0xCA,0xCA,0x10 } },
+    { 0x79B55C51, { 0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x20 } },
+    { 0x8E5B8655, { 0xA1,0xA1,0xA1,0xA1,0xA1,0xA1,0xA1,0xA1,0xA1,0xA1,0xA1,0xA1,0xA1,0xA1,0xA1,0xDB } },
+    { 0x1724FB41, { 0x1D,0x1D,0x1D,0x1D,0x1D,0x1D,0x1D,0x1D,0x1D,0x1D,0x1D,0x1D,0x1D,0x1D,0x1D,0xEC } },
+    { 0xBFA9FCE9, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0x31 } },
+    { 0xD22ADAA1, { 0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0xC2 } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xD22ADAA1, { 0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0x88,0xC2 } },
+    { 0x77387259, { 0xE1,0xE1,0xE1,0xE1,0xE1,0xE1,0xE1,0xE1,0xE1,0xE1,0xE1,0xE1,0xE1,0xE1,0xE1,0x57 } },
+    { 0x11A7E079, { 0x7D,0x7D,0x7D,0x7D,0x7D,0x7D,0x7D,0x7D,0x7D,0x7D,0x7D,0x7D,0x7D,0x7D,0x7D,0x47 } },
+    { 0x57CA6B85, { 0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x13 } },
+    { 0x5ACC25E9, { 0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x52 } },
+    { 0xEEB53729, { 0x8D,0x8D,0x8D,0x8D,0x8D,0x8D,0x8D,0x8D,0x8D,0x8D,0x8D,0x8D,0x8D,0x8D,0x8D,0x93 } },
+    { 0xABBCBE91, { 0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x77 } },
+    { 0xFF6A1155, { 0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x09 } },
+    { 0x27C8CC51, { 0xB5,0xB5,0xB5,0xB5,0xB5,0xB5,0xB5,0xB5,0xB5,0xB5,0xB5,0xB5,0xB5,0xB5,0xB5,0x94 } },
+    { 0x0D997E15, { 0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x84,0x1C } },
+    { 0xF829C091, { 0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0xC1 } },
+    { 0xDBD83DB5, { 0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0xD0 } },
+    { 0x82B6ACA1, { 0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0xFA } },
+    { 0x1DDDF345, { 0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0x85 } },
+    { 0x68CAE745, { 0x8A,0x8A,0x8A,0x8A,0x8A,0x8A,0x8A,0x8A,0x8A,0x8A,0x8A,0x8A,0x8A,0x8A,0x8A,0x3D } },
+    { 0x6011F6F5, { 0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x64,0x3A } },
+    { 0x50322F05, { 0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xF3 } },
+    { 0x97FA1DB1, { 0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x23 } },
+    { 0x50322F05, { 0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xF3 } },
+  } },
+  { 0x0BCB5288, {   // Strobe
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7CE910F9, { 0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+  } },
+  { 0xE9456513, {   // ColorWipe
+    { 0xC02171A7, { 0x84,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xAA0D6A30, { 0xD6,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x2239D516, { 0xC6,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x299209F9, { 0x4D,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x365269D1, { 0xD3,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xFF13C33C, { 0x29,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x9BF3194C, { 0x82,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x2C4B8679, { 0xDA,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xF307A193, { 0x71,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xB02838BA, { 0x2A,0x5E,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x5EEDD1E4, { 0x2A,0xCC,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x650583AB, { 0x2A,0x7E,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x9048B243, { 0x2A,0x7F,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x72CBCDC2, { 0x2A,0x07,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x6D0EB79D, { 0x2A,0xF2,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7D5ED1D9, { 0x2A,0x55,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xDEE2F7D0, { 0x2A,0xA0,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x143A50DA, { 0x2A,0x2A,0xB7,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x12F0B9F5, { 0x2A,0x2A,0xE9,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xBFDFD59D, { 0x2A,0x2A,0x10,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x97F4B67C, { 0x2A,0x2A,0x6A,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xC592C87E, { 0x2A,0x2A,0x32,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x9F5687D3, { 0x2A,0x2A,0x97,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x38D01B67, { 0x2A,0x2A,0x51,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xF5A55C4C, { 0x2A,0x2A,0xF3,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x02216480, { 0x2A,0x2A,0x2A,0x94,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x22FB5083, { 0x2A,0x2A,0x2A,0xFA,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x3BD022F1, { 0x2A,0x2A,0x2A,0x7C,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xA51D8CA2, { 0x2A,0x2A,0x2A,0x02,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xB660D604, { 0x2A,0x2A,0x2A,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x383753D5, { 0x2A,0x2A,0x2A,0xD4,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x6A889C91, { 0x2A,0x2A,0x2A,0xB3,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x74CC229E, { 0x2A,0x2A,0x2A,0xEA,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xF9A07210, { 0x2A,0x2A,0x2A,0x2A,0x3C,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xD8099205, { 0x2A,0x2A,0x2A,0x2A,0xE6,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xBE1229AD, { 0x2A,0x2A,0x2A,0x2A,0xA8,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7B691962, { 0x2A,0x2A,0x2A,0x2A,0xA0,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x2A3F1466, { 0x2A,0x2A,0x2A,0x2A,0xFA,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x29FDEA11, { 0x2A,0x2A,0x2A,0x2A,0xA6,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x7BFD8D87, { 0x2A,0x2A,0x2A,0x2A,0x53,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x3CA3034A, { 0x2A,0x2A,0x2A,0x2A,0x86,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x402BC1AE, { 0x2A,0x2A,0x2A,0x2A,0xF0,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x2DD3CE3F, { 0x2A,0x2A,0x2A,0x2A,0x2A,0x72,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x38771F31, { 0x2A,0x2A,0x2A,0x2A,0x2A,0xC6,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xBE43B794, { 0x2A,0x2A,0x2A,0x2A,0x2A,0xA9,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xE243F1DA, { 0x2A,0x2A,0x2A,0x2A,0x2A,0x51,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xA4843ABD, { 0x2A,0x2A,0x2A,0x2A,0x2A,0x24,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xDC9D40B1, { 0x2A,0x2A,0x2A,0x2A,0x2A,0xA6,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x4C3DDC18, { 0x2A,0x2A,0x2A,0x2A,0x2A,0xE4,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xBE10FFEE, { 0x2A,0x2A,0x2A,0x2A,0x2A,0x2E,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x8F890035, { 0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0xC1,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xB43C7FC5, { 0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0xBE,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xC453C230, { 0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0x13,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x29EA8914, { 0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0x61,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x43133BA1, { 0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0x13,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xECBCF573, { 0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0x6F,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x48FCD36E, { 0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0x47,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xDAD19354, { 0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0xC7,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x8B982E1F, { 0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0xC3,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x6858B039, { 0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0xDA,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0xD6F549CA, { 0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0x28,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x428123D4, { 0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0x83,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x167D34AD, { 0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0x6A,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+    { 0x22187721, { 0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0x2A,0xEA,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xD7 } },
+  } },
+  { 0x5C15BE49, {   // Rainbow
+    { 0xD156AF11, { 0x40,0x80,0xF3,0x38,0x1C,0x51,0xA4,0x83,0x0E,0x60,0x70,0x94,0x63,0x22,0x16,0x38 } },
+    { 0x7DC9627A, { 0xF3,0xA9,0x21,0xA6,0x8E,0xE0,0x7A,0x8E,0x05,0xDA,0xBC,0xF3,0xAB,0x71,0xE2,0x14 } },
+    { 0x37BA25E7, { 0xA1,0xAB,0x48,0xB5,0xBD,0x19,0x32,0x61,0xF2,0xBB,0x9F,0xE3,0x4B,0x5A,0xE6,0x83 } },
+    { 0xCB6B5FB8, { 0x31,0x72,0x37,0x46,0xA2,0xEB,0x72,0x82,0x5A,0x66,0x03,0x00,0x05,0x3A,0xE5,0x4B } },
+    { 0xE181C3FA, { 0xAA,0xE6,0x32,0x7C,0x72,0x14,0x59,0xBC,0x40,0x80,0xF3,0x38,0x1C,0x51,0xA4,0x98 } },
+    { 0xC34C0D12, { 0x6D,0x74,0xD0,0x7B,0x6E,0x49,0x8E,0xCA,0xF3,0xA9,0x21,0xA6,0x8E,0xE0,0x7A,0x3D } },
+    { 0x1A83A0A5, { 0x3B,0x6C,0xA0,0xAF,0x85,0x56,0x19,0xCA,0xA1,0xAB,0x48,0xB5,0xBD,0x19,0x32,0xAE } },
+    { 0xF5D1DBD7, { 0x90,0xA0,0xC8,0x78,0x67,0x3D,0x2C,0x40,0x31,0x72,0x37,0x46,0xA2,0xEB,0x72,0x13 } },
+    { 0x3E971928, { 0x08,0xF7,0xC1,0x78,0xA9,0x89,0x0C,0x05,0xAA,0xE6,0x32,0x7C,0x72,0x14,0x59,0x04 } },
+    { 0xC5FAEB22, { 0x9D,0x98,0x68,0x6D,0x89,0xF4,0x84,0xE3,0x6D,0x74,0xD0,0x7B,0x6E,0x49,0x8E,0xF1 } },
+    { 0x21E0E388, { 0x9D,0xDD,0x78,0xFB,0xE3,0xDA,0x9E,0xC5,0x3B,0x6C,0xA0,0xAF,0x85,0x56,0x19,0x09 } },
+    { 0x5AF725F0, { 0xAE,0x2A,0x53,0x1B,0xA6,0x36,0xCE,0x7D,0x90,0xA0,0xC8,0x78,0x67,0x3D,0x2C,0x54 } },
+    { 0xC3784B47, { 0x58,0x22,0xC5,0xE8,0xCE,0x18,0x7B,0x4C,0x08,0xF7,0xC1,0x78,0xA9,0x89,0x0C,0x39 } },
+    { 0x6D680651, { 0x1B,0xED,0x85,0x07,0x01,0xC8,0x5E,0x6F,0x9D,0x98,0x68,0x6D,0x89,0xF4,0x84,0x73 } },
+    { 0x485CBDE5, { 0xB1,0x63,0x35,0xF1,0x3D,0x53,0x07,0x3B,0x9D,0xDD,0x78,0xFB,0xE3,0xDA,0x9E,0x66 } },
+    { 0xB7B56B20, { 0xD0,0x5B,0x80,0x33,0x7B,0x3F,0xE6,0x02,0xAE,0x2A,0x53,0x1B,0xA6,0x36,0xCE,0x1D } },
+    { 0xAC0CE51D, { 0x6D,0x10,0x57,0x7C,0x7A,0x95,0x84,0xD2,0x58,0x22,0xC5,0xE8,0xCE,0x18,0x7B,0x89 } },
+    { 0x695F08B3, { 0x20,0xEB,0x42,0x8E,0x80,0x59,0xF4,0x38,0x1B,0xED,0x85,0x07,0x01,0xC8,0x5E,0xC7 } },
+    { 0x83BC9A1A, { 0xDC,0xE3,0xFB,0x0D,0xFC,0x1C,0x52,0x20,0xB1,0x63,0x35,0xF1,0x3D,0x53,0x07,0x73 } },
+    { 0xA1E89954, { 0xCF,0x6D,0x17,0x11,0xC6,0xB5,0x64,0xC9,0xD0,0x5B,0x80,0x33,0x7B,0x3F,0xE6,0x7E } },
+    { 0x837320BD, { 0x95,0x24,0xCE,0x28,0xB3,0x31,0xB4,0xAF,0x6D,0x10,0x57,0x7C,0x7A,0x95,0x84,0xA4 } },
+    { 0x1540029B, { 0x2C,0xED,0xC3,0xED,0xD9,0x5C,0x60,0x6F,0x20,0xEB,0x42,0x8E,0x80,0x59,0xF4,0x24 } },
+    { 0xDA7952A9, { 0x14,0x60,0xA2,0x9F,0xE3,0x75,0x6C,0x8F,0xDC,0xE3,0xFB,0x0D,0xFC,0x1C,0x52,0x43 } },
+    { 0x86450C9C, { 0x8D,0x52,0x07,0xD0,0x71,0xC8,0xCF,0xDA,0xCF,0x6D,0x17,0x11,0xC6,0xB5,0x64,0x6E } },
+    { 0x7A2FF9A0, { 0x87,0x0D,0x4F,0x67,0xAD,0x99,0x2E,0xF1,0x95,0x24,0xCE,0x28,0xB3,0x31,0xB4,0x01 } },
+    { 0xEAA077D7, { 0x16,0x8B,0xBB,0x1A,0x03,0x30,0x57,0x74,0x2C,0xED,0xC3,0xED,0xD9,0x5C,0x60,0xF0 } },
+    { 0x83370D30, { 0xE2,0xC7,0xB7,0x42,0x2A,0x13,0x22,0xE0,0x14,0x60,0xA2,0x9F,0xE3,0x75,0x6C,0x3C } },
+    { 0xB648AB1E, { 0xE6,0xDF,0xAD,0xFE,0x97,0xC0,0xC4,0xBC,0x8D,0x52,0x07,0xD0,0x71,0xC8,0xCF,0x3A } },
+    { 0x752A09B2, { 0xE5,0xA3,0xB8,0xAD,0xE4,0xD3,0xFC,0xFA,0x87,0x0D,0x4F,0x67,0xAD,0x99,0x2E,0x3F } },
+    { 0x3FE80896, { 0xA4,0x83,0x0E,0x60,0x70,0x94,0x63,0x22,0x16,0x8B,0xBB,0x1A,0x03,0x30,0x57,0xE1 } },
+    { 0x65F83FA1, { 0x7A,0x8E,0x05,0xDA,0xBC,0xF3,0xAB,0x71,0xE2,0xC7,0xB7,0x42,0x2A,0x13,0x22,0x7B } },
+    { 0x8E334E94, { 0x32,0x61,0xF2,0xBB,0x9F,0xE3,0x4B,0x5A,0xE6,0xDF,0xAD,0xFE,0x97,0xC0,0xC4,0xDA } },
+    { 0x99008B5C, { 0x8E,0x80,0x59,0xF4,0x38,0x1B,0xED,0x85,0x07,0x01,0xC8,0x5E,0x6F,0x9D,0x98,0xAA } },
+    { 0x755E45A6, { 0x0D,0xFC,0x1C,0x52,0x20,0xB1,0x63,0x35,0xF1,0x3D,0x53,0x07,0x3B,0x9D,0xDD,0x4F } },
+    { 0x1829A207, { 0x11,0xC6,0xB5,0x64,0xC9,0xD0,0x5B,0x80,0x33,0x7B,0x3F,0xE6,0x02,0xAE,0x2A,0x6D } },
+    { 0xF612708C, { 0x28,0xB3,0x31,0xB4,0xAF,0x6D,0x10,0x57,0x7C,0x7A,0x95,0x84,0xD2,0x58,0x22,0xBE } },
+    { 0xF21A0ED1, { 0xED,0xD9,0x5C,0x60,0x6F,0x20,0xEB,0x42,0x8E,0x80,0x59,0xF4,0x38,0x1B,0xED,0xEF } },
+    { 0x8BC91BAE, { 0x9F,0xE3,0x75,0x6C,0x8F,0xDC,0xE3,0xFB,0x0D,0xFC,0x1C,0x52,0x20,0xB1,0x63,0xD3 } },
+    { 0xB1A0A365, { 0xD0,0x71,0xC8,0xCF,0xDA,0xCF,0x6D,0x17,0x11,0xC6,0xB5,0x64,0xC9,0xD0,0x5B,0x59 } },
+    { 0x0E209262, { 0x67,0xAD,0x99,0x2E,0xF1,0x95,0x24,0xCE,0x28,0xB3,0x31,0xB4,0xAF,0x6D,0x10,0x80 } },
+    { 0x3341A50E, { 0x1A,0x03,0x30,0x57,0x74,0x2C,0xED,0xC3,0xED,0xD9,0x5C,0x60,0x6F,0x20,0xEB,0x89 } },
+    { 0x7F8551E8, { 0x42,0x2A,0x13,0x22,0xE0,0x14,0x60,0xA2,0x9F,0xE3,0x75,0x6C,0x8F,0xDC,0xE3,0x98 } },
+    { 0xA71C0E99, { 0xFE,0x97,0xC0,0xC4,0xBC,0x8D,0x52,0x07,0xD0,0x71,0xC8,0xCF,0xDA,0xCF,0x6D,0x29 } },
+    { 0x70A0F068, { 0xAD,0xE4,0xD3,0xFC,0xFA,0x87,0x0D,0x4F,0x67,0xAD,0x99,0x2E,0xF1,0x95,0x24,0x09 } },
+    { 0x09D39FC1, { 0x60,0x70,0x94,0x63,0x22,0x16,0x8B,0xBB,0x1A,0x03,0x30,0x57,0x74,0x2C,0xED,0x9A } },
+    { 0xE10056B7, { 0xDA,0xBC,0xF3,0xAB,0x71,0xE2,0xC7,0xB7,0x42,0x2A,0x13,0x22,0xE0,0x14,0x60,0x05 } },
+    { 0x1FAA7588, { 0xBB,0x9F,0xE3,0x4B,0x5A,0xE6,0xDF,0xAD,0xFE,0x97,0xC0,0xC4,0xBC,0x8D,0x52,0x16 } },
+    { 0x40942699, { 0x66,0x03,0x00,0x05,0x3A,0xE5,0xA3,0xB8,0xAD,0xE4,0xD3,0xFC,0xFA,0x87,0x0D,0x3D } },
+    { 0x99E32ABD, { 0x80,0xF3,0x38,0x1C,0x51,0xA4,0x83,0x0E,0x60,0x70,0x94,0x63,0x22,0x16,0x8B,0x45 } },
+    { 0x18C3E3D5, { 0xA9,0x21,0xA6,0x8E,0xE0,0x7A,0x8E,0x05,0xDA,0xBC,0xF3,0xAB,0x71,0xE2,0xC7,0x91 } },
+    { 0x6943437B, { 0xAB,0x48,0xB5,0xBD,0x19,0x32,0x61,0xF2,0xBB,0x9F,0xE3,0x4B,0x5A,0xE6,0xDF,0x45 } },
+    { 0xDD04C423, { 0x72,0x37,0x46,0xA2,0xEB,0x72,0x82,0x5A,0x66,0x03,0x00,0x05,0x3A,0xE5,0xA3,0x56 } },
+    { 0xBD05E615, { 0xE6,0x32,0x7C,0x72,0x14,0x59,0xBC,0x40,0x80,0xF3,0x38,0x1C,0x51,0xA4,0x83,0xE1 } },
+    { 0xFB5B3241, { 0x74,0xD0,0x7B,0x6E,0x49,0x8E,0xCA,0xF3,0xA9,0x21,0xA6,0x8E,0xE0,0x7A,0x8E,0xC2 } },
+    { 0x49661F2A, { 0x6C,0xA0,0xAF,0x85,0x56,0x19,0xCA,0xA1,0xAB,0x48,0xB5,0xBD,0x19,0x32,0x61,0xF5 } },
+    { 0x9F230767, { 0xA0,0xC8,0x78,0x67,0x3D,0x2C,0x40,0x31,0x72,0x37,0x46,0xA2,0xEB,0x72,0x82,0xFD } },
+    { 0xD63FBCD0, { 0xF7,0xC1,0x78,0xA9,0x89,0x0C,0x05,0xAA,0xE6,0x32,0x7C,0x72,0x14,0x59,0xBC,0x60 } },
+    { 0x7BC96A1F, { 0x98,0x68,0x6D,0x89,0xF4,0x84,0xE3,0x6D,0x74,0xD0,0x7B,0x6E,0x49,0x8E,0xCA,0x1B } },
+    { 0x822B9403, { 0xDD,0x78,0xFB,0xE3,0xDA,0x9E,0xC5,0x3B,0x6C,0xA0,0xAF,0x85,0x56,0x19,0xCA,0xE7 } },
+    { 0x9AE2DBF0, { 0x2A,0x53,0x1B,0xA6,0x36,0xCE,0x7D,0x90,0xA0,0xC8,0x78,0x67,0x3D,0x2C,0x40,0x3E } },
+    { 0x1961D2D7, { 0x22,0xC5,0xE8,0xCE,0x18,0x7B,0x4C,0x08,0xF7,0xC1,0x78,0xA9,0x89,0x0C,0x05,0x9F } },
+    { 0x2A498DEA, { 0xED,0x85,0x07,0x01,0xC8,0x5E,0x6F,0x9D,0x98,0x68,0x6D,0x89,0xF4,0x84,0xE3,0x18 } },
+    { 0x621FFD13, { 0x63,0x35,0xF1,0x3D,0x53,0x07,0x3B,0x9D,0xDD,0x78,0xFB,0xE3,0xDA,0x9E,0xC5,0xBF } },
+    { 0xBE0391B8, { 0x5B,0x80,0x33,0x7B,0x3F,0xE6,0x02,0xAE,0x2A,0x53,0x1B,0xA6,0x36,0xCE,0x7D,0x77 } },
+  } },
+  { 0x993C73C5, {   // Gradient
+    { 0xC695130A, { 0xA8,0x3B,0xE8,0xB2,0x75,0xA4,0xB9,0xCE,0xB3,0x65,0x3D,0x9A,0x52,0xED,0x06,0x8D } },
+    { 0xDE4CC1E6, { 0xC4,0x1D,0x30,0x17,0xE0,0xEF,0x7D,0xF1,0xE2,0x74,0x99,0xBE,0x5A,0xDA,0xC7,0x67 } },
+    { 0xAA313B52, { 0x78,0x28,0x02,0xDC,0x74,0xB1,0x7F,0x7E,0x94,0x89,0xA2,0x55,0x10,0x7F,0x90,0x34 } },
+    { 0x6651D9EA, { 0x94,0x9E,0x1F,0x06,0xF2,0x90,0xCA,0x19,0xD5,0xE6,0x64,0x26,0xFC,0x00,0x76,0x96 } },
+    { 0xE1146A7C, { 0xFF,0x48,0x4C,0xD3,0x2B,0xF5,0x71,0x87,0xAB,0x6D,0x3C,0x98,0x5B,0x56,0xF9,0x2B } },
+    { 0x14D20CC0, { 0x67,0x4E,0x02,0x86,0x7D,0x3D,0xCB,0x57,0xDB,0x0A,0x5A,0xC1,0x22,0xAD,0x82,0x98 } },
+    { 0xDD4163E8, { 0x33,0x95,0x9D,0x1A,0x28,0xD1,0xFC,0xC9,0x8A,0x04,0x8C,0x78,0x47,0xB2,0xB7,0x7D } },
+    { 0x4D85A35A, { 0x84,0xE1,0xC6,0xD8,0xD9,0x35,0xB4,0xED,0xE3,0xA3,0x13,0x79,0xFB,0x30,0xEC,0xEE } },
+    { 0xFF5DD3AE, { 0x49,0x4A,0xBE,0x5A,0xB7,0x40,0xFF,0x7B,0xC2,0x82,0x2B,0x34,0x20,0x9D,0xF9,0xCC } },
+    { 0x6753AF76, { 0xCF,0xA1,0xA9,0x67,0xD1,0x29,0xD3,0x69,0x90,0x75,0x5C,0x4C,0xE4,0x40,0x57,0x54 } },
+    { 0x74023788, { 0x28,0x02,0xDC,0x74,0xB1,0x7F,0x7E,0x94,0x89,0xA2,0x55,0x10,0x7F,0x90,0x56,0x76 } },
+    { 0xB86EEBD4, { 0x9E,0x1F,0x06,0xF2,0x90,0xCA,0x19,0xD5,0xE6,0x64,0x26,0xFC,0x00,0x76,0x39,0x0F } },
+    { 0xD931D32C, { 0x98,0xD3,0xB3,0xCE,0xCA,0x90,0xA9,0x71,0x49,0xDB,0x99,0x48,0x2A,0xB4,0x27,0x1D } },
+    { 0xBA5FCE36, { 0x4E,0x02,0x86,0x7D,0x3D,0xCB,0x57,0xDB,0x0A,0x5A,0xC1,0x22,0xAD,0x82,0x50,0xE0 } },
+    { 0x94A3AD12, { 0x95,0x9D,0x1A,0x28,0xD1,0xFC,0xC9,0x8A,0x04,0x8C,0x78,0x47,0xB2,0xB7,0x68,0xB3 } },
+    { 0xBEF3722A, { 0x59,0xD6,0x52,0xCF,0x01,0xE0,0x49,0x06,0x1A,0x4B,0x3C,0xF8,0x33,0xEC,0xA8,0xDF } },
+    { 0xDE4B845C, { 0x4A,0xBE,0x5A,0xB7,0x40,0xFF,0x7B,0xC2,0x82,0x2B,0x34,0x20,0x9D,0xF9,0xAF,0xDB } },
+    { 0x8AE69CEC, { 0xA1,0xA9,0x67,0xD1,0x29,0xD3,0x69,0x90,0x75,0x5C,0x4C,0xE4,0x40,0x57,0x21,0x75 } },
+    { 0x1746FDE4, { 0xA8,0x46,0xA2,0xEB,0xB6,0xEE,0x89,0x7C,0xFA,0xAB,0xE4,0x12,0xBB,0xB9,0x35,0x86 } },
+    { 0x559E435E, { 0x1F,0x06,0xF2,0x90,0xCA,0x19,0xD5,0xE6,0x64,0x26,0xFC,0x00,0x76,0x39,0x6F,0xC1 } },
+    { 0xC6109CCE, { 0xD3,0xB3,0xCE,0xCA,0x90,0xA9,0x71,0x49,0xDB,0x99,0x48,0x2A,0xB4,0x27,0x85,0xE0 } },
+    { 0xBF65731E, { 0xDE,0x47,0x18,0x66,0x36,0xD6,0x80,0x26,0x9C,0x92,0x61,0xDE,0xBF,0xF0,0x07,0x9E } },
+    { 0x62B44372, { 0x74,0x17,0x6A,0xA9,0x99,0xD2,0xD6,0xF8,0xA4,0x60,0xDA,0x84,0x33,0x9C,0x84,0x82 } },
+    { 0xFFAD5110, { 0xD6,0x52,0xCF,0x01,0xE0,0x49,0x06,0x1A,0x4B,0x3C,0xF8,0x33,0xEC,0xA8,0x3B,0xE7 } },
+    { 0x060E0860, { 0xA8,0x41,0xA9,0x8F,0x82,0x97,0x42,0x42,0xFE,0xBB,0xD1,0x4F,0x7D,0xC4,0x1D,0x8A } },
+    { 0xF89C5D2C, { 0xB2,0x75,0xA4,0xB9,0xCE,0xB3,0x65,0x3D,0x9A,0x52,0xED,0x06,0x18,0x78,0x28,0xA3 } },
+    { 0x855FEE42, { 0x46,0xA2,0xEB,0xB6,0xEE,0x89,0x7C,0xFA,0xAB,0xE4,0x12,0xBB,0xB9,0x35,0x3E,0x87 } },
+    { 0x10DA6CBA, { 0x34,0x90,0xD4,0x76,0x7D,0xB7,0x45,0xA1,0xC5,0x68,0x5B,0x99,0xE5,0xFF,0x48,0x20 } },
+    { 0x19D366FE, { 0x92,0x2F,0x42,0xC5,0x6C,0x18,0x04,0x5A,0xAA,0xE1,0x78,0x4A,0xB2,0x67,0x4E,0xEE } },
+    { 0x5E7ED19C, { 0x47,0x18,0x66,0x36,0xD6,0x80,0x26,0x9C,0x92,0x61,0xDE,0xBF,0xF0,0x07,0xBE,0x7A } },
+    { 0x0C417CA4, { 0x17,0x6A,0xA9,0x99,0xD2,0xD6,0xF8,0xA4,0x60,0xDA,0x84,0x33,0x9C,0x84,0xE1,0x62 } },
+    { 0x9FA66D50, { 0x3B,0x80,0x19,0xE2,0xC2,0x15,0x9B,0x1D,0xB7,0xA7,0x3C,0x3A,0x6E,0x49,0x4A,0xB5 } },
+    { 0x0D0A2BDE, { 0x41,0xA9,0x8F,0x82,0x97,0x42,0x42,0xFE,0xBB,0xD1,0x4F,0x7D,0xC4,0x1D,0x30,0x02 } },
+    { 0xADA6EBEE, { 0x75,0xA4,0xB9,0xCE,0xB3,0x65,0x3D,0x9A,0x52,0xED,0x06,0x18,0x78,0x28,0x02,0xB9 } },
+    { 0x83854E02, { 0xE0,0xEF,0x7D,0xF1,0xE2,0x74,0x99,0xBE,0x5A,0xDA,0xC7,0xB3,0x94,0x9E,0x1F,0xC4 } },
+    { 0xA2FD5E4C, { 0x90,0xD4,0x76,0x7D,0xB7,0x45,0xA1,0xC5,0x68,0x5B,0x99,0xE5,0xFF,0x48,0x4C,0x90 } },
+    { 0x99528760, { 0x2F,0x42,0xC5,0x6C,0x18,0x04,0x5A,0xAA,0xE1,0x78,0x4A,0xB2,0x67,0x4E,0x02,0xC1 } },
+    { 0xC6DCF414, { 0x2B,0xF5,0x71,0x87,0xAB,0x6D,0x3C,0x98,0x5B,0x56,0xF9,0x9C,0x33,0x95,0x9D,0x9B } },
+    { 0xE7F1506A, { 0x6A,0xA9,0x99,0xD2,0xD6,0xF8,0xA4,0x60,0xDA,0x84,0x33,0x9C,0x84,0xE1,0xC6,0x45 } },
+    { 0x7769C462, { 0x80,0x19,0xE2,0xC2,0x15,0x9B,0x1D,0xB7,0xA7,0x3C,0x3A,0x6E,0x49,0x4A,0xBE,0xA2 } },
+    { 0x8339FA26, { 0xD9,0x35,0xB4,0xED,0xE3,0xA3,0x13,0x79,0xFB,0x30,0xEC,0xE2,0xCF,0xA1,0xA9,0x5D } },
+    { 0x5D538276, { 0xB7,0x40,0xFF,0x7B,0xC2,0x82,0x2B,0x34,0x20,0x9D,0xF9,0xAF,0x55,0xA8,0x46,0xC7 } },
+    { 0x3E6121D4, { 0xEF,0x7D,0xF1,0xE2,0x74,0x99,0xBE,0x5A,0xDA,0xC7,0xB3,0x94,0x9E,0x1F,0x06,0xC2 } },
+    { 0xC2F355F8, { 0xB1,0x7F,0x7E,0x94,0x89,0xA2,0x55,0x10,0x7F,0x90,0x56,0xE9,0x98,0xD3,0xB3,0xE7 } },
+    { 0x7AC3D808, { 0x90,0xCA,0x19,0xD5,0xE6,0x64,0x26,0xFC,0x00,0x76,0x39,0x6F,0x23,0xDE,0x47,0xA4 } },
+    { 0x3C231D66, { 0xF5,0x71,0x87,0xAB,0x6D,0x3C,0x98,0x5B,0x56,0xF9,0x9C,0x33,0x95,0x9D,0x1A,0xC8 } },
+    { 0x600A502A, { 0x3D,0xCB,0x57,0xDB,0x0A,0x5A,0xC1,0x22,0xAD,0x82,0x50,0xE9,0x59,0xD6,0x52,0x49 } },
+    { 0x614E581A, { 0xD1,0xFC,0xC9,0x8A,0x04,0x8C,0x78,0x47,0xB2,0xB7,0x68,0xD9,0x27,0xA8,0x41,0x0E } },
+    { 0xF4429F18, { 0x35,0xB4,0xED,0xE3,0xA3,0x13,0x79,0xFB,0x30,0xEC,0xE2,0xCF,0xA1,0xA9,0x67,0x7D } },
+    { 0xCF19DB3C, { 0x40,0xFF,0x7B,0xC2,0x82,0x2B,0x34,0x20,0x9D,0xF9,0xAF,0x55,0xA8,0x46,0xA2,0x01 } },
+    { 0xBFA1B358, { 0x29,0xD3,0x69,0x90,0x75,0x5C,0x4C,0xE4,0x40,0x57,0x21,0x83,0x83,0x34,0x90,0xA6 } },
+    { 0xA2029DC6, { 0x7F,0x7E,0x94,0x89,0xA2,0x55,0x10,0x7F,0x90,0x56,0xE9,0x98,0xD3,0xB3,0xCE,0x76 } },
+    { 0x71BC11EA, { 0xCA,0x19,0xD5,0xE6,0x64,0x26,0xFC,0x00,0x76,0x39,0x6F,0x23,0xDE,0x47,0x18,0xF2 } },
+    { 0x1AA9482E, { 0x90,0xA9,0x71,0x49,0xDB,0x99,0x48,0x2A,0xB4,0x27,0x85,0x42,0x74,0x17,0x6A,0xE1 } },
+    { 0xA8E2C8A0, { 0xCB,0x57,0xDB,0x0A,0x5A,0xC1,0x22,0xAD,0x82,0x50,0xE9,0x59,0xD6,0x52,0xCF,0xAA } },
+    { 0xF95449E4, { 0xFC,0xC9,0x8A,0x04,0x8C,0x78,0x47,0xB2,0xB7,0x68,0xD9,0x27,0xA8,0x41,0xA9,0x4B } },
+    { 0x7B1DFA88, { 0xE0,0x49,0x06,0x1A,0x4B,0x3C,0xF8,0x33,0xEC,0xA8,0x3B,0xE8,0xB2,0x75,0xA4,0xB6 } },
+    { 0xA114FD46, { 0xFF,0x7B,0xC2,0x82,0x2B,0x34,0x20,0x9D,0xF9,0xAF,0x55,0xA8,0x46,0xA2,0xEB,0x90 } },
+    { 0x5DCD84AA, { 0xD3,0x69,0x90,0x75,0x5C,0x4C,0xE4,0x40,0x57,0x21,0x83,0x83,0x34,0x90,0xD4,0x81 } },
+    { 0x138851D6, { 0xEE,0x89,0x7C,0xFA,0xAB,0xE4,0x12,0xBB,0xB9,0x35,0x3E,0xF0,0x92,0x2F,0x42,0x41 } },
+    { 0xBF7B8D86, { 0x7D,0xB7,0x45,0xA1,0xC5,0x68,0x5B,0x99,0xE5,0xFF,0x48,0x4C,0xD3,0x2B,0xF5,0xED } },
+    { 0xB2050054, { 0xA9,0x71,0x49,0xDB,0x99,0x48,0x2A,0xB4,0x27,0x85,0x42,0x74,0x17,0x6A,0xA9,0x65 } },
+    { 0xF039B5A0, { 0xD6,0x80,0x26,0x9C,0x92,0x61,0xDE,0xBF,0xF0,0x07,0xBE,0x77,0x3B,0x80,0x19,0x2B } },
+    { 0xE9FC6298, { 0xD2,0xD6,0xF8,0xA4,0x60,0xDA,0x84,0x33,0x9C,0x84,0xE1,0xC6,0xD8,0xD9,0x35,0x4E } },
+  } },
+  { 0x7A57BE0B, {   // Twinkle
+    { 0xC4258B92, { 0x2B,0x2B,0x2B,0x2B,0x2B,0x38,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0xD4 } },
+    { 0xAB7605C7, { 0x92,0x2B,0x2B,0x2B,0x2B,0x8A,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0xA4 } },
+    { 0xD605FF6A, { 0xB6,0x2B,0x2B,0x2B,0xEF,0x23,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0xAC } },
+    { 0x845E2088, { 0x03,0x2B,0x2B,0x2B,0x35,0xCF,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x0A,0x2B,0x8B } },
+    { 0x4A87F869, { 0x20,0x2B,0x2B,0x92,0xE8,0x1E,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x81,0x2B,0xEB } },
+    { 0xAA971FC0, { 0x8A,0x2B,0x2B,0xB6,0x2A,0x90,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0xA3,0x2B,0x94 } },
+    { 0x27FDFAFE, { 0x63,0x2B,0x2B,0x03,0x91,0x97,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x9D,0x2B,0xE1 } },
+    { 0x966EF5EB, { 0xC8,0x00,0x2B,0x20,0x52,0x4F,0x2B,0x2B,0x2B,0x6B,0x2B,0x2B,0x2B,0xBE,0x2B,0xE4 } },
+    { 0x20B372E7, { 0x3D,0x66,0x2B,0x8A,0x3A,0x8E,0x2B,0x2B,0x2B,0x6D,0x2B,0x2B,0x2B,0x36,0x2B,0x8F } },
+    { 0xCD5095D2, { 0x9B,0xF9,0x2B,0x37,0xC6,0x58,0x2B,0x2B,0x2B,0xB2,0x2B,0x2B,0x2B,0x54,0x2B,0x4C } },
+    { 0x0F4C4409, { 0x63,0x78,0x2B,0xB3,0x8B,0x90,0x2B,0x2B,0x2B,0x6E,0x2B,0x2B,0x2B,0x4F,0x2B,0x32 } },
+    { 0x0FF90BC0, { 0x96,0xDE,0x2B,0x7E,0x84,0xDA,0x2B,0x2B,0x2B,0xE6,0x2B,0x2B,0x2B,0x4C,0x2B,0x72 } },
+    { 0xAA94A0FB, { 0xE2,0x7E,0x2B,0x5C,0x99,0x2F,0x2B,0x2B,0x2B,0xEA,0x2B,0x2B,0x2B,0xF9,0x2B,0xF1 } },
+    { 0x58A5CD09, { 0x98,0xA9,0x2B,0xDB,0x56,0xF5,0x2B,0x2B,0x2B,0xE1,0x2B,0x2B,0x2B,0x36,0x4D,0xEB } },
+    { 0x5FFA4872, { 0x19,0xEF,0x2B,0x82,0x7C,0xAA,0x2B,0x2B,0x2B,0x9C,0x2B,0x2B,0x2B,0xC6,0xA1,0x7A } },
+    { 0x0262ACBE, { 0xAD,0x25,0x2B,0x73,0xDD,0x61,0x2B,0x2B,0x2B,0x32,0x2B,0x2B,0xA1,0x7E,0x53,0x39 } },
+    { 0xA0C465A0, { 0xA2,0x6E,0x2B,0x2C,0x94,0x23,0x2B,0x2B,0x2B,0xB4,0x2B,0x2B,0xD6,0x66,0xCF,0xCD } },
+    { 0xF35BFF13, { 0x61,0x2E,0x2B,0x35,0xEF,0xA0,0x2B,0x2B,0x2B,0xCA,0x2B,0x2B,0xE5,0x50,0x79,0xC9 } },
+    { 0x205E7988, { 0x4C,0x43,0x2B,0x01,0xEE,0x9C,0x04,0x2B,0x2B,0xC7,0x2B,0x2B,0x79,0xC8,0xAA,0xE9 } },
+    { 0x665861CA, { 0x12,0x53,0x2B,0x21,0x67,0xA7,0xED,0x2B,0x2B,0x77,0x2B,0x2B,0xA2,0xA3,0xE9,0x72 } },
+    { 0xE793ADBC, { 0x94,0x86,0x2B,0xA6,0xF8,0xF9,0xC8,0x2B,0x2B,0x22,0x2B,0x2B,0x39,0x6E,0xA9,0x36 } },
+    { 0x7C1A5AF5, { 0xAB,0x3C,0x2B,0xD9,0xE4,0x2B,0x9D,0x2B,0x2B,0xDC,0x2B,0xA9,0xC2,0xEF,0xD6,0xD4 } },
+    { 0x007B5F9A, { 0x06,0x42,0x2B,0xE1,0x97,0x2B,0xC6,0x2B,0x28,0xFC,0x2B,0x88,0xD6,0xD4,0xAA,0xD4 } },
+    { 0x7EF600EE, { 0x17,0x60,0x2B,0xEF,0x7F,0x2B,0xF9,0x64,0xCC,0x96,0x2B,0x3D,0x23,0x3E,0xA2,0xD4 } },
+    { 0xCF69F43A, { 0x56,0x71,0x2B,0x67,0xE1,0x2B,0x54,0x4E,0x35,0x11,0x2B,0xAF,0xE5,0x2B,0x06,0xD4 } },
+    { 0xBD2FC22D, { 0xF9,0x67,0x2B,0x5F,0x4F,0x2B,0x54,0xBC,0x3B,0x53,0x2B,0xD2,0x43,0x2B,0xAE,0xD4 } },
+    { 0x35DC165B, { 0x6E,0xB2,0x2B,0x3F,0xB9,0x2B,0x22,0x99,0x52,0x1E,0x2B,0xB2,0x41,0x2B,0x7B,0xD4 } },
+    { 0xE52CEDA8, { 0x11,0x65,0x2B,0xE6,0x6C,0x2B,0xF9,0x87,0x6C,0x77,0x2B,0x9B,0x27,0x2B,0xE7,0xC4 } },
+    { 0x12D2B249, { 0x44,0x20,0x2B,0xA1,0x35,0x2B,0x5F,0xDD,0xA5,0x5F,0x59,0x9B,0x9D,0x2B,0x53,0x42 } },
+    { 0x800DEABE, { 0xBA,0x09,0x2B,0x2B,0x15,0x2B,0x5D,0x31,0x2F,0x1B,0x2F,0xA5,0x4E,0x2B,0xD6,0x58 } },
+    { 0x11CAA310, { 0x10,0x6E,0x2B,0x2B,0x5C,0x2B,0x7E,0xE7,0xF2,0x51,0x35,0x9E,0xD2,0x2B,0x63,0xF7 } },
+    { 0xCDE5A17E, { 0xC2,0x7D,0x81,0x2B,0xC8,0x2B,0x9D,0x42,0x76,0x49,0xC4,0x7B,0xDB,0x2B,0xAB,0x7D } },
+    { 0x3C2C9421, { 0x5C,0x58,0xA3,0x2B,0xF8,0x2B,0x9E,0xC2,0xA2,0xDF,0x34,0xE7,0xE8,0x2B,0x0D,0xB6 } },
+    { 0x2FAB9138, { 0xEB,0x60,0x9E,0xEF,0x00,0x2B,0xC8,0x9F,0x1E,0x56,0xE2,0x1C,0x73,0x2B,0xF4,0x6D } },
+    { 0xA957559D, { 0xD7,0x9E,0xBE,0x23,0x00,0x2B,0x6C,0xB9,0x95,0x3A,0x1B,0x84,0x37,0x2B,0x2B,0xCC } },
+    { 0x398E53EA, { 0x99,0x5C,0x36,0xED,0x67,0x2B,0xED,0x69,0x07,0x93,0x51,0xC0,0xEB,0x2B,0x2B,0xA2 } },
+    { 0xA1479FCC, { 0xD1,0xEB,0x29,0xA8,0xF8,0x2B,0x14,0x7F,0x29,0xE7,0x9E,0xDE,0x1F,0x2B,0x2B,0x23 } },
+    { 0xDC5FB1A6, { 0xE6,0xD7,0x43,0x90,0xBF,0xEF,0x0A,0xE6,0x91,0x7D,0xC0,0x78,0xA8,0x2B,0x2B,0x10 } },
+    { 0x75CA25BC, { 0x1E,0x99,0x7A,0x88,0xD7,0x15,0x2B,0xDD,0xDA,0x94,0x4E,0x6A,0x1F,0x2B,0x2B,0xE3 } },
+    { 0xA66D2273, { 0x2B,0xD1,0xA9,0x60,0xD8,0x81,0x2B,0xFF,0x44,0x7B,0xCA,0xC9,0x16,0x2B,0x2B,0xF7 } },
+    { 0x69E0CAA1, { 0x2B,0x6A,0x5B,0x97,0x22,0xD3,0x2B,0xE3,0x0D,0xEC,0x17,0x16,0x46,0x2B,0x2B,0xA2 } },
+    { 0x346C2A49, { 0x2B,0x1E,0x36,0xB2,0xD8,0x6E,0x2B,0x04,0x9E,0x8D,0x4F,0x70,0x63,0x2B,0x2B,0x8E } },
+    { 0xCAA04920, { 0x2B,0x2B,0xD6,0x2D,0xD7,0xFF,0x2B,0xBB,0x6D,0x8A,0x02,0x4E,0x06,0x2B,0x2B,0x99 } },
+    { 0x6972D9A1, { 0x2B,0x28,0x8F,0x96,0x52,0xA7,0x2B,0xC3,0xFF,0x3F,0xAD,0x89,0x9C,0x2B,0x2B,0xBF } },
+    { 0x1097DE6D, { 0x2B,0xC9,0xEE,0x1E,0x03,0x3A,0x2B,0x66,0x11,0xFB,0x1C,0x34,0xD8,0xA1,0x2B,0xB0 } },
+    { 0xA58FF045, { 0x2B,0xD6,0x8D,0xA8,0x6F,0x78,0x2B,0xE9,0x38,0xE2,0xD9,0x03,0x27,0xD6,0x2B,0x62 } },
+    { 0x972C5804, { 0x2B,0x3B,0x8B,0xCF,0x75,0x62,0x2B,0x77,0xDC,0x99,0x38,0x6A,0x53,0xAB,0x2B,0x46 } },
+    { 0x10A60EF0, { 0x2B,0xE9,0x50,0xE6,0x6E,0xFF,0x2B,0xFE,0x9B,0xEF,0x8A,0xE2,0xE3,0x55,0x2B,0xB8 } },
+    { 0x43D16A0B, { 0x2B,0x1D,0xB2,0x33,0xCC,0x45,0x2B,0x07,0xC8,0x15,0x0D,0xB5,0x4D,0x41,0x2B,0xAF } },
+    { 0x5128F201, { 0x2B,0x4F,0x07,0xF1,0x81,0x6E,0x2B,0xE4,0x9B,0x6A,0x08,0x5E,0xAA,0x77,0x2B,0xAF } },
+    { 0x3ECF2B2A, { 0x2B,0x98,0x60,0x35,0x08,0xA5,0x2B,0x46,0xBA,0x51,0x2B,0x03,0xCB,0x43,0x2B,0xF5 } },
+    { 0x5CB0C179, { 0x2B,0x67,0xB0,0x9A,0x91,0x26,0x2B,0xD2,0x47,0x09,0x2B,0x09,0x16,0xE3,0x2B,0xF3 } },
+    { 0xD57E21E4, { 0x2B,0x9E,0x60,0x38,0x78,0xC2,0x2B,0xEA,0xB9,0x7C,0x2B,0x13,0x16,0xF4,0x00,0x7B } },
+    { 0x1A921E0A, { 0x2B,0x5A,0xD4,0x2B,0xA8,0x81,0x2B,0x04,0x48,0x6D,0x2B,0x3E,0x12,0x4B,0xE3,0xCB } },
+    { 0x7702DFA2, { 0x2B,0x78,0xA5,0x81,0xE1,0x54,0x2B,0x2B,0x5D,0x78,0x00,0x96,0x63,0x1E,0xEB,0xF5 } },
+    { 0x64B5064D, { 0x2B,0xD8,0x83,0x86,0x33,0x7A,0x2B,0x2E,0xF8,0x68,0x66,0xFB,0xE8,0xB3,0x9E,0xB3 } },
+    { 0xD0BE22F5, { 0x2B,0x64,0x31,0xE0,0x0F,0x0D,0x2B,0x4E,0x45,0xEB,0xF9,0xA6,0xB6,0x76,0x18,0x12 } },
+    { 0x3E8D6582, { 0x2B,0x97,0x47,0x38,0xBF,0x08,0x2B,0x88,0x11,0x40,0x78,0x40,0x9F,0x69,0x67,0x73 } },
+    { 0x49666D87, { 0x2B,0xF1,0x49,0x7F,0x03,0x2B,0x2B,0xAA,0x9A,0x10,0x12,0x79,0xE3,0x72,0x42,0x84 } },
+    { 0x1BBC1528, { 0x2B,0x52,0xB8,0xA1,0x60,0x2B,0x2B,0x84,0xFB,0xB8,0xAF,0x9D,0x2C,0xF2,0x00,0xBA } },
+    { 0xBF0962A0, { 0x2B,0xB6,0xCC,0xE4,0x74,0x2B,0x2B,0x7C,0x45,0x18,0xD0,0x85,0x89,0x7C,0xB5,0xCC } },
+    { 0xD6F1A6BB, { 0x2B,0x66,0x81,0x26,0x34,0x2B,0x2B,0x2B,0x4F,0xD0,0xB6,0x3D,0xCC,0x22,0x7D,0x0F } },
+    { 0x7DF1922B, { 0x2B,0x3E,0xC8,0x50,0xA6,0x2B,0x2B,0x2B,0x29,0x40,0x5D,0x1A,0xCF,0xD2,0x58,0xD9 } },
+    { 0xB0048260, { 0x2B,0x66,0x1F,0x3E,0x76,0x2B,0x2B,0x2B,0x22,0x29,0x94,0x5D,0x28,0xC9,0x20,0xA7 } },
+  } },
+  { 0xD12073BB, {   // Twinkle2
+    { 0x82963D63, { 0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x90,0x2B,0x6C } },
+    { 0x6156859A, { 0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x00,0xCC } },
+    { 0x93DFBBC8, { 0x4D,0x2B,0x2B,0x29,0x2B,0x2B,0x2B,0x2B,0xCA,0x81,0x2B,0x2B,0x2B,0x7E,0x87,0x53 } },
+    { 0x3DCECD54, { 0x53,0x2B,0x2B,0xFD,0x2B,0x2B,0xD3,0xDA,0x99,0xD3,0x2B,0x2B,0x2B,0xBC,0xEB,0x0E } },
+    { 0x53656AFA, { 0x55,0x2B,0x2B,0x75,0x2B,0xB8,0x71,0x88,0x6D,0xE0,0x2B,0x2C,0x2B,0x21,0x9E,0x23 } },
+    { 0x29A7D4F5, { 0x2A,0x2B,0x2B,0x4A,0x38,0xA7,0xCD,0x3D,0xA6,0x38,0x2B,0xF4,0x2B,0xF8,0xC8,0xCE } },
+    { 0x34B6569D, { 0x67,0x2B,0x2B,0xC3,0x7A,0xAF,0x44,0xC6,0x7C,0xD7,0x90,0x34,0x2B,0x87,0x67,0x04 } },
+    { 0xAB8DB100, { 0x0D,0x2B,0x64,0xEA,0x71,0x91,0x7B,0xD2,0x6F,0x50,0x36,0x33,0x2B,0x6F,0x42,0x1F } },
+    { 0xECD420AE, { 0xB8,0x97,0x4E,0xE0,0xAC,0x9C,0x78,0xB2,0x75,0xE4,0x36,0x87,0x2B,0xD6,0x00,0xC9 } },
+    { 0xE62536AB, { 0x7B,0x45,0xBC,0x86,0x95,0xFA,0x19,0xB1,0xA7,0x8A,0xFF,0x9B,0x2B,0x33,0xB5,0x26 } },
+    { 0xB7D1F4BD, { 0x4E,0xA7,0x5F,0xFE,0x5A,0x16,0x70,0x68,0x0C,0x70,0x31,0xC1,0x2B,0x6C,0x7D,0x54 } },
+    { 0xA72AAB1F, { 0x23,0x59,0x2A,0x81,0x4A,0x41,0x58,0x56,0x56,0x55,0x96,0xC8,0x2B,0xDA,0x58,0xC6 } },
+    { 0x3351EA69, { 0xFA,0x85,0x1E,0xFC,0x5C,0x3F,0x36,0x8A,0x4F,0xA2,0x0D,0x5F,0x2B,0x6F,0x20,0xAC } },
+    { 0x9F764F5F, { 0x3D,0x0B,0x3E,0x53,0xCF,0x73,0x98,0xAF,0x93,0xFB,0x4F,0x62,0x2B,0x82,0x9E,0x3F } },
+    { 0xD3F2BE17, { 0x63,0x33,0x95,0xA7,0x1D,0xC7,0x7D,0x5F,0x4D,0x7B,0x5B,0xEF,0x2B,0x5D,0x5C,0x63 } },
+    { 0xD9EC6145, { 0xC3,0x45,0x3E,0x97,0x05,0x5A,0xA9,0xEA,0xB2,0xEF,0x88,0x8A,0x2B,0xD0,0x90,0xC5 } },
+    { 0xEC1C960C, { 0x0D,0x33,0xC7,0x19,0x41,0x7C,0xC3,0x90,0x8A,0xB3,0x1B,0x33,0x2B,0x7F,0x6C,0x79 } },
+    { 0x4BDF6A41, { 0xD7,0x55,0x59,0xD0,0x0A,0xA3,0xA3,0x1F,0x9C,0xEC,0x3C,0xCC,0x44,0xD4,0xC0,0xBB } },
+    { 0x708E966E, { 0x62,0xFF,0x65,0x73,0xA5,0xEB,0x03,0xA2,0x07,0xC8,0x8C,0xFD,0xA2,0xEF,0x24,0x77 } },
+    { 0x425ED57D, { 0x8D,0xB7,0xD0,0x1D,0xF7,0xF1,0x1F,0x54,0x7A,0x20,0xA3,0x83,0x20,0x51,0x05,0xD4 } },
+    { 0xDBD9C924, { 0xDB,0x39,0xE8,0xE4,0x58,0x04,0x98,0x42,0x20,0xCB,0x2F,0x62,0xE0,0x25,0x46,0xD8 } },
+    { 0x53CDA1C4, { 0x0C,0x75,0x35,0xB0,0xAD,0x5B,0x24,0x03,0x6D,0x79,0x40,0x89,0x6C,0x72,0x2A,0x05 } },
+    { 0x2020042F, { 0xAA,0xDE,0x47,0xAD,0xB2,0x57,0xB8,0xED,0x25,0xAC,0xDE,0x99,0xB8,0x28,0x77,0x92 } },
+    { 0x11C34319, { 0x77,0x8C,0x39,0xDB,0x8A,0x90,0xD1,0x77,0x0B,0x3A,0xD3,0x7E,0xE4,0x8F,0xAA,0xC2 } },
+    { 0x398E19C4, { 0xFC,0xEE,0x90,0xD9,0x26,0x65,0x17,0x8F,0xC7,0xBA,0x9B,0x6E,0x4D,0xB1,0x56,0xE5 } },
+    { 0xD8269B68, { 0x2E,0x92,0x3A,0xD9,0x3D,0xAB,0x61,0xC6,0x2B,0x1C,0xE5,0x41,0x43,0x68,0xFA,0x45 } },
+    { 0x83BB5EB2, { 0x23,0xD0,0x94,0x69,0xE6,0x35,0xF7,0x37,0x2B,0xEC,0x0D,0xA8,0x45,0xE3,0xF2,0x2C } },
+    { 0xFC775B32, { 0x5B,0xBD,0x96,0xA2,0x82,0xD4,0x3E,0xB9,0x2B,0x34,0x4C,0xC7,0x6B,0x99,0xFF,0x1B } },
+    { 0xEE9098B7, { 0xAD,0x45,0xFA,0x6F,0x0D,0xF5,0xE0,0xC7,0x2B,0xDD,0xF0,0xB0,0x6A,0xC5,0x0B,0xDB } },
+    { 0x8E0F5D5F, { 0x75,0x94,0xCC,0x63,0x1D,0x6C,0x48,0x02,0x2B,0x92,0x97,0x53,0x36,0x4E,0x65,0xE4 } },
+    { 0x14FC9205, { 0x01,0x5D,0xF3,0x54,0x24,0x3A,0x11,0x1C,0x9E,0x65,0x5D,0x03,0xFA,0x61,0x05,0x97 } },
+    { 0x031A8952, { 0x70,0x6F,0x64,0xDC,0x86,0x16,0x73,0x1D,0x34,0x98,0x61,0x87,0x0E,0xD9,0x66,0xA8 } },
+    { 0x7044FD0F, { 0xE2,0xC5,0xC2,0x08,0x66,0x8A,0xD1,0x77,0x0C,0xA5,0xDE,0x0E,0xEF,0x8E,0xEF,0xF5 } },
+    { 0x0E92DB80, { 0x3A,0xC4,0xE7,0xA9,0xA3,0xD5,0xB6,0xF4,0x44,0x10,0x80,0xD1,0x16,0xBE,0xB2,0xE0 } },
+    { 0x4A1E73BB, { 0xBE,0x8F,0xEC,0xF3,0xD6,0x53,0x92,0xDA,0x1E,0xAC,0xEB,0x57,0x8A,0x7A,0x78,0xBD } },
+    { 0x8CC5C035, { 0x19,0x4E,0xF1,0x96,0x08,0x5C,0x41,0x7A,0x0E,0xCD,0x15,0xA0,0xC8,0xC8,0x82,0xB7 } },
+    { 0xE93886BB, { 0xDA,0x92,0xCE,0x11,0x7D,0x4E,0xF8,0xD4,0x39,0x10,0xE3,0x01,0xF2,0x4A,0x46,0x5A } },
+    { 0xCF203FFE, { 0x7E,0x06,0x5E,0xA0,0xBD,0x55,0x4A,0x0F,0x43,0xC6,0xD1,0x4A,0x48,0xB9,0x6D,0x69 } },
+    { 0xF745A346, { 0x3C,0x43,0x6D,0x64,0x8E,0xB4,0xA5,0xDF,0xE3,0x55,0x6A,0xFB,0x05,0xE3,0xF4,0x04 } },
+    { 0x7F8A793A, { 0xE1,0x56,0x7E,0x22,0x13,0x93,0x68,0x75,0x08,0x40,0xF5,0xAA,0xF2,0x57,0x4D,0x18 } },
+    { 0xCAB68ADF, { 0xCC,0x09,0x1A,0x83,0xD0,0x90,0xFB,0xF2,0xD0,0x0C,0xA1,0xDA,0x4A,0xF4,0x45,0xAF } },
+    { 0x300128CF, { 0x44,0x15,0x52,0xEB,0x73,0xBD,0x32,0x8C,0xF9,0x6A,0x2B,0x28,0x01,0x5D,0x3B,0x09 } },
+    { 0x1949D969, { 0xEA,0xE7,0x3B,0xAB,0x0B,0x20,0xF9,0x4E,0xEE,0x6D,0xEF,0x60,0x8F,0x08,0x07,0x90 } },
+    { 0x31ABA8BE, { 0x01,0x4E,0x63,0x90,0x18,0x03,0xD8,0xB4,0x04,0xF1,0xC9,0xF4,0x4A,0xA6,0x61,0x0C } },
+    { 0x2E9A8E93, { 0x95,0x10,0xEE,0x16,0x02,0x3D,0x9E,0x6B,0xF7,0x07,0xE8,0x46,0x73,0xE5,0xD7,0xBD } },
+    { 0x5703AD18, { 0x22,0x2B,0x0B,0x4B,0x63,0xB9,0x1F,0xA5,0x7D,0xAC,0x2A,0xD8,0x7F,0x88,0x4F,0x88 } },
+    { 0x7C971C57, { 0xB5,0x38,0x89,0x7F,0xA9,0x24,0xE6,0x09,0xC6,0x4F,0xE9,0xD0,0x80,0xED,0x36,0x5D } },
+    { 0x3CC735D1, { 0xD3,0xA9,0xBE,0xE5,0xDE,0x81,0xE1,0x9E,0xBB,0x32,0x4E,0x6E,0x78,0xA8,0xEB,0xBF } },
+    { 0xA5BCA398, { 0x2B,0x61,0x1A,0x91,0x04,0xF3,0xA6,0x35,0xAD,0x32,0x5B,0x0C,0xA6,0xFA,0x4B,0xD4 } },
+    { 0x9FD1B628, { 0x2B,0xCF,0x80,0xF6,0x72,0xDA,0xD6,0x1C,0xA5,0xD5,0x4F,0x54,0xBD,0xA8,0x68,0xD4 } },
+    { 0x492A754E, { 0xB3,0xDA,0x54,0x38,0x0B,0x14,0x26,0x6D,0xE5,0x9F,0xD7,0x7D,0x74,0xF3,0xFF,0xD4 } },
+    { 0xAA4B9760, { 0xA5,0x58,0x0D,0x53,0x2A,0x44,0x1D,0xDD,0x79,0x42,0x8D,0x04,0x30,0x4F,0xAE,0x72 } },
+    { 0x6FAFA5C4, { 0xA7,0x97,0x14,0x79,0xF9,0x19,0x2D,0x97,0xD6,0x8A,0xD5,0x83,0xAA,0x81,0x8A,0x1F } },
+    { 0x1E9C0200, { 0x94,0x97,0xF7,0xA6,0x25,0x77,0xAA,0xD0,0xC5,0xDB,0x17,0x2A,0x07,0x6C,0x5D,0xD8 } },
+    { 0x27BAC946, { 0xA7,0x88,0x0F,0x1A,0xE4,0x28,0xD0,0xEA,0x66,0xCA,0x37,0xB4,0xB1,0x8F,0xE0,0xBE } },
+    { 0x94B9D1F0, { 0xBE,0x58,0x4F,0xD7,0x55,0xCD,0x51,0x20,0x0C,0x6F,0x45,0x06,0xAC,0x8F,0x52,0x89 } },
+    { 0x70C01582, { 0xA8,0xEE,0xEF,0xFB,0x06,0xD9,0x68,0xFB,0x89,0xE4,0xBC,0x2B,0x51,0x44,0xBE,0xF1 } },
+    { 0x12851950, { 0x8E,0xB8,0x2E,0x50,0x2C,0xE0,0x2C,0xEA,0x2B,0x6E,0xA8,0x56,0x02,0x03,0xEA,0xC2 } },
+    { 0xAB42E506, { 0xCE,0x9B,0x2B,0x27,0x8A,0xA9,0x63,0xCD,0x3D,0xBA,0xB8,0xF8,0x1A,0xC1,0xC0,0xBC } },
+    { 0x12BE9B32, { 0x2E,0x08,0x2B,0x31,0x2C,0x5B,0xC1,0xC9,0x48,0xFF,0x97,0x1C,0x57,0xA6,0xA2,0x18 } },
+    { 0x2FDBA020, { 0x22,0x7F,0x2B,0x5E,0x7C,0xD5,0x4B,0xD0,0x6E,0xF9,0xC9,0xC0,0x0E,0x98,0x3D,0xDD } },
+    { 0xF7C8BDA4, { 0x3F,0xB8,0x2B,0x17,0xDC,0xBD,0x3A,0x62,0x5B,0x2B,0xA3,0x55,0x84,0x71,0x57,0xB4 } },
+    { 0xB1ADF717, { 0x57,0xCB,0x2B,0x5C,0xF4,0xB2,0x41,0x21,0x69,0x2B,0x0D,0xC8,0x49,0x19,0xB7,0x56 } },
+    { 0x165D6435, { 0xED,0x0C,0x2B,0xFA,0x05,0x6A,0xB2,0xD3,0xFC,0x2B,0xDA,0x43,0x96,0x97,0x68,0x30 } },
+  } },
+  { 0x080EB1F6, {   // Glitter
+    { 0x2F701642, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x31,0x1C,0x1C,0xAB } },
+    { 0x33CFEE1D, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xCA,0x1C,0x1C,0xAB } },
+    { 0x789CE2A3, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x76,0x1C,0x1C,0x40 } },
+    { 0x3ED2FC3E, { 0x1C,0x1C,0x16,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x7D,0x1C,0x1C,0xDD } },
+    { 0xBBD6671E, { 0x1C,0x1C,0xCD,0x1C,0x1C,0x1C,0x48,0x1C,0x1C,0x1C,0x1C,0x1C,0xD3,0x1C,0x1C,0x8A } },
+    { 0x873946CA, { 0x1C,0x1C,0xC0,0x1C,0x1C,0x1C,0x39,0x1C,0x1C,0x1C,0x1C,0x1C,0x38,0x1C,0x1C,0xA6 } },
+    { 0x2D3B63F2, { 0x7A,0x1C,0x64,0x1C,0x1C,0x1C,0x44,0x1C,0x8A,0x1C,0x1C,0x1C,0xED,0x1C,0x1C,0x4E } },
+    { 0xD141A6E5, { 0x9B,0x1C,0x5F,0x1C,0x1C,0x1C,0xDE,0x1C,0x99,0x1C,0x1C,0x1C,0xD2,0x1C,0x1C,0x90 } },
+    { 0x060781A7, { 0x63,0x1C,0x6C,0x1C,0x1C,0x1C,0x3A,0x1C,0x51,0x1C,0x1C,0x1C,0x5A,0x6A,0x1C,0x6D } },
+    { 0x1F20E5EF, { 0x1E,0x1C,0x6B,0x1C,0x1C,0x1C,0x26,0x1C,0xD6,0x1C,0x1C,0x6A,0xBC,0x4C,0x1C,0x10 } },
+    { 0x4D5A360D, { 0x7A,0x1C,0x95,0x1C,0x1C,0x1C,0xD8,0x16,0x8D,0x1C,0x1C,0x74,0xAA,0x4B,0x1C,0x27 } },
+    { 0xB0024F64, { 0x9F,0x1C,0x7D,0x1C,0x1C,0x1C,0x4D,0xCD,0x85,0x1C,0x1C,0x34,0x76,0x45,0x9C,0xA0 } },
+    { 0x7AAEDDEC, { 0x3E,0x1C,0xA1,0x1C,0x1C,0x1C,0xE4,0x50,0x9B,0x1C,0x1C,0x45,0xEB,0x1C,0x43,0x4F } },
+    { 0xA0BDDEEA, { 0x46,0x1C,0x65,0x1C,0x1C,0x1C,0xCF,0x64,0x3C,0x1C,0x1C,0xE6,0x62,0x0A,0x9B,0x21 } },
+    { 0xA8BF63CB, { 0x76,0x1C,0x2D,0x1C,0x1C,0x1C,0xB9,0x5F,0xA7,0x1C,0x1C,0x08,0x73,0x18,0x94,0xE2 } },
+    { 0x301DC4C1, { 0x4A,0x1C,0x3C,0x1C,0x1C,0x1C,0x04,0x92,0x68,0x1C,0x1C,0xA9,0x9B,0x24,0x95,0xDE } },
+    { 0x784100F3, { 0x58,0x1C,0xFC,0x73,0x1C,0x1C,0x45,0x6B,0x8A,0x1C,0x1C,0x2E,0x1C,0xA9,0xF3,0xCD } },
+    { 0x704E12E8, { 0x3B,0x1C,0x44,0xB4,0x1C,0x1C,0xF2,0x95,0x43,0x1C,0x1C,0xE8,0x44,0x5C,0xB4,0xDE } },
+    { 0x6BDA5DE3, { 0x7E,0x1C,0xD8,0xA2,0x1C,0x1C,0xE6,0x0A,0x6C,0x1C,0x1C,0xC0,0x60,0x25,0x9B,0x1A } },
+    { 0x3D5653F8, { 0xB9,0x1C,0xF3,0x16,0x1C,0x1C,0xE7,0xA1,0xF8,0x1C,0x1C,0xDF,0x1C,0xEE,0x03,0xCB } },
+    { 0x515A4484, { 0x8C,0x1C,0xAD,0xE6,0x1C,0x1C,0x92,0x65,0x0C,0x1C,0x1C,0x54,0x1C,0x56,0xA4,0x5A } },
+    { 0x83D1BECE, { 0x49,0x1C,0xE8,0xD6,0x1C,0x1C,0xF3,0x2D,0x69,0x63,0x1C,0x67,0x1C,0x4E,0x67,0x30 } },
+    { 0x8DDA5C7F, { 0x98,0x1C,0x43,0x22,0x1C,0x1C,0x0B,0xCE,0xED,0x4A,0x1C,0xEF,0x1C,0x1A,0x96,0x04 } },
+    { 0xA0F75D19, { 0xDF,0x1C,0xB2,0x93,0x1C,0x1C,0x0F,0x3E,0xD8,0x3D,0x1C,0x92,0x1C,0x84,0x68,0x2F } },
+    { 0x55520943, { 0x3B,0x1C,0xA2,0xC7,0x1C,0x1C,0x9F,0x39,0x19,0x35,0x1C,0xDF,0x1C,0xEE,0x5A,0x30 } },
+    { 0xE34CFFAA, { 0x04,0x1C,0xFE,0x81,0x7E,0x1C,0xCF,0x8F,0xEE,0xBE,0x1C,0xE1,0x1C,0xE8,0x4D,0x96 } },
+    { 0x1BC859C7, { 0x45,0x1C,0x72,0x31,0x5E,0x1C,0xED,0xF9,0xE4,0xC2,0x1C,0x6F,0x1C,0x24,0xA6,0x34 } },
+    { 0x04410C6E, { 0xF2,0x31,0xC3,0x70,0xAF,0x1C,0x20,0xEE,0x3A,0x02,0x1C,0xA7,0x1C,0x1C,0x03,0x3A } },
+    { 0x52CA13F7, { 0x44,0x09,0x2D,0x5E,0x17,0x1C,0xF1,0xF5,0x1C,0xF0,0x1C,0x0E,0x1C,0x1C,0x19,0x56 } },
+    { 0x398D3A93, { 0xA1,0x1D,0x02,0x4D,0x9C,0x1C,0xAE,0xAE,0x1C,0xC6,0x1C,0x5D,0x1C,0x1C,0xAA,0xAE } },
+    { 0xE8FF4F41, { 0x25,0x7D,0xCE,0xAC,0x4A,0x1C,0x11,0xDF,0x1C,0x36,0x1C,0xD3,0x1C,0x1C,0x62,0x89 } },
+    { 0xA125B1F8, { 0xAD,0x57,0xC1,0x15,0xCC,0x1C,0xA5,0xD9,0x1C,0x42,0x1C,0xED,0x1C,0x1C,0x28,0xB7 } },
+    { 0x0B7F5062, { 0x4E,0xEB,0xEF,0x7C,0xB6,0x1C,0xE9,0x16,0x1C,0xB3,0x5A,0x1C,0x1C,0x1C,0x25,0xAE } },
+    { 0xB8C45677, { 0x1C,0xED,0x85,0x36,0x07,0x1C,0x20,0xA9,0x1C,0xC0,0x06,0x16,0x1C,0x1C,0x63,0x24 } },
+    { 0x76CD3560, { 0x1C,0xC4,0xB2,0x1B,0x92,0x1C,0x5A,0xB3,0x1C,0x16,0x38,0xD6,0x1C,0x1C,0x9E,0x31 } },
+    { 0xA02D4C95, { 0x1C,0xE5,0x6B,0x49,0xE8,0x1C,0x8E,0x2A,0x1C,0x06,0xA0,0x50,0x1C,0x1C,0xFD,0x57 } },
+    { 0x6586C681, { 0x1C,0xBC,0x95,0x33,0xE8,0x1C,0x32,0xE6,0x1C,0xBA,0xE2,0x64,0x1C,0x1C,0xA0,0x75 } },
+    { 0xFED10DDB, { 0x1C,0x73,0x0A,0xCD,0xBB,0x1C,0x89,0x56,0x1C,0x2D,0xB4,0x34,0x1C,0x1C,0x78,0x82 } },
+    { 0xEAC76F27, { 0x1C,0x5B,0xA1,0xEB,0x59,0x1C,0x01,0x1A,0x1C,0xA8,0xAA,0x92,0x1C,0x1C,0xAA,0x8F } },
+    { 0xB50FBF3A, { 0x1C,0xEB,0x65,0xBF,0xAE,0x1C,0x8F,0x03,0x1C,0x7C,0x88,0x6B,0x1C,0x1C,0xDD,0xF4 } },
+    { 0xBADCCE6F, { 0x1C,0x62,0xA8,0x1C,0x4D,0x1C,0x46,0x09,0x1C,0xE7,0x32,0x95,0x1C,0x1C,0xE2,0x0A } },
+    { 0xD0DA615F, { 0x1C,0x27,0xF7,0x1C,0x04,0x1C,0x10,0x86,0x1C,0x11,0x3D,0x0A,0x1C,0x1C,0xB6,0x78 } },
+    { 0x128C047B, { 0x1C,0x9B,0x68,0x1C,0x3E,0x1C,0x04,0xD2,0x1C,0xAF,0xA9,0xA1,0x1C,0x1C,0x7F,0xE7 } },
+    { 0xCB6F82FE, { 0x1C,0x1C,0x38,0x1C,0xF7,0x1C,0xC6,0x12,0x1C,0x24,0x2D,0x65,0x1C,0x1C,0xE2,0x42 } },
+    { 0x2B6D1A04, { 0x1C,0x58,0xF6,0x1C,0xC4,0x1C,0x80,0xE0,0x1C,0xDA,0xB1,0x9B,0x1C,0x1C,0x33,0xFC } },
+    { 0x01FCB285, { 0x1C,0x60,0x42,0x1C,0xD9,0x1C,0x76,0x1C,0x1C,0xBA,0x0B,0x3C,0x1C,0x1C,0x58,0x80 } },
+    { 0x88858533, { 0x1C,0x1C,0x41,0x1C,0xE6,0x1C,0x16,0x1C,0x1C,0x30,0x2A,0xEB,0x1C,0x1C,0xFC,0x65 } },
+    { 0xD3C051B8, { 0x1C,0x1C,0x6E,0x1C,0xB3,0x1C,0xD1,0x1C,0x1C,0xB2,0xA6,0x05,0x1C,0x1C,0x73,0xC9 } },
+    { 0x798B7D8A, { 0x1C,0x1C,0xD3,0x1C,0xF1,0x73,0x6C,0x1C,0x1C,0x55,0xA7,0x33,0x1C,0x14,0xB4,0x69 } },
+    { 0x7EBF8DC3, { 0x1C,0x1C,0x6E,0x1C,0x1A,0xB4,0x12,0x1C,0x1C,0xAC,0x61,0x79,0x1C,0xBF,0xD4,0x80 } },
+    { 0xEB50D7D3, { 0x1C,0x1C,0x6D,0x1C,0xFB,0xA2,0xFB,0x1C,0x1C,0x8F,0xBC,0xB0,0x1C,0xBE,0x81,0x36 } },
+    { 0xCB339F05, { 0x1C,0x1C,0xA5,0x1C,0x6B,0xDA,0xD0,0x1C,0x1C,0x23,0x87,0x52,0x1C,0x2E,0xDD,0xCB } },
+    { 0x7CFF8FA6, { 0x1C,0x1C,0x35,0x1C,0x00,0xBF,0x6B,0x1C,0x1C,0x7C,0x5F,0x1A,0x1C,0x78,0x99,0x6A } },
+    { 0xF12089C7, { 0x1C,0x1C,0xE4,0x1C,0x13,0xFE,0x41,0x1C,0x1C,0x89,0x62,0xFB,0x1C,0x4A,0x11,0xE7 } },
+    { 0x3B64608D, { 0x1C,0x1C,0xF5,0x9B,0x52,0x00,0x46,0x1C,0x1C,0xFA,0xB0,0x6B,0x1C,0xDD,0xDA,0x30 } },
+    { 0x6FD1BCFE, { 0x1C,0x1C,0x67,0x04,0x89,0x04,0xF1,0x1C,0x1C,0xB1,0x3B,0x00,0x1C,0xB2,0x1C,0xB6 } },
+    { 0xCEBB5C98, { 0x1C,0x1C,0xB0,0xB7,0x65,0x9F,0x19,0xAE,0x1C,0xED,0xE2,0x13,0x1C,0x81,0x1C,0x67 } },
+    { 0x0EA7B4FE, { 0x1C,0x1C,0x61,0xB2,0x51,0x40,0xC8,0x43,0x1C,0x1C,0x92,0xD4,0x1C,0xE1,0x1C,0x1B } },
+    { 0xAB8C85A9, { 0x1C,0xAE,0xA5,0xE2,0x15,0x36,0xC3,0x16,0x1C,0x1C,0x92,0xC7,0x1C,0x09,0x1C,0xC8 } },
+    { 0xE952BA94, { 0x1C,0x43,0x40,0x57,0x83,0xDC,0xED,0xB0,0xC8,0x1C,0x24,0x63,0x1C,0x66,0x1C,0x7C } },
+    { 0x2B00AC74, { 0x1C,0xFC,0x57,0x98,0x9D,0x39,0xE9,0x48,0xBB,0x1C,0x14,0x72,0xDC,0xDB,0x1C,0xD8 } },
+    { 0x77DE90BD, { 0x1C,0xB7,0x06,0x20,0xC6,0xC0,0xC7,0xAD,0x81,0x1C,0x07,0xE2,0xBF,0xAD,0x1C,0xCD } },
+    { 0xAD87ADF7, { 0x1C,0x48,0xBF,0xEF,0x1C,0x2E,0x2B,0x06,0x7C,0x1C,0x45,0x25,0x78,0x38,0x1C,0x32 } },
+    { 0x6871F6B9, { 0x1C,0xCE,0x45,0xDA,0x1C,0xE1,0xAC,0x5B,0xBB,0x1C,0x58,0xF9,0x19,0x71,0x1C,0xAB } },
+  } },
+  { 0x0ED762F9, {   // Fire
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x5B0DF043, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x34,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x5B0DF043, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x34,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x5B0DF043, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x34,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x546D0508, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x03,0x1C,0x0A,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x546D0508, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x03,0x1C,0x0A,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x39E96FCA, { 0x89,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x84,0x1C,0x0B,0x92,0x1C,0x1C,0x1C,0xAB } },
+    { 0x39E96FCA, { 0x89,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x84,0x1C,0x0B,0x92,0x1C,0x1C,0x1C,0xAB } },
+    { 0x39E96FCA, { 0x89,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x84,0x1C,0x0B,0x92,0x1C,0x1C,0x1C,0xAB } },
+    { 0x2D15E9F9, { 0xE0,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x95,0x1C,0x49,0x0B,0x1C,0x1C,0x1C,0xAB } },
+    { 0x2D15E9F9, { 0xE0,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x95,0x1C,0x49,0x0B,0x1C,0x1C,0x1C,0xAB } },
+    { 0x2D15E9F9, { 0xE0,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x95,0x1C,0x49,0x0B,0x1C,0x1C,0x1C,0xAB } },
+    { 0x341F976E, { 0x71,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x20,0x1C,0xF1,0x9F,0x1C,0x28,0x1C,0xAB } },
+    { 0x341F976E, { 0x71,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x20,0x1C,0xF1,0x9F,0x1C,0x28,0x1C,0xAB } },
+    { 0xA1AF73E8, { 0x55,0x1C,0x90,0x1C,0x1C,0x1C,0x1C,0x1C,0xE9,0x1C,0x76,0x21,0x1C,0xD7,0x1C,0xAB } },
+    { 0xA1AF73E8, { 0x55,0x1C,0x90,0x1C,0x1C,0x1C,0x1C,0x1C,0xE9,0x1C,0x76,0x21,0x1C,0xD7,0x1C,0xAB } },
+    { 0xA1AF73E8, { 0x55,0x1C,0x90,0x1C,0x1C,0x1C,0x1C,0x1C,0xE9,0x1C,0x76,0x21,0x1C,0xD7,0x1C,0xAB } },
+    { 0x0F7802A7, { 0xDC,0x1C,0x19,0x1C,0x1C,0x1C,0x1C,0x1C,0x81,0x1C,0x7D,0x52,0x1C,0x96,0x1C,0xAB } },
+    { 0x0F7802A7, { 0xDC,0x1C,0x19,0x1C,0x1C,0x1C,0x1C,0x1C,0x81,0x1C,0x7D,0x52,0x1C,0x96,0x1C,0xAB } },
+    { 0xF65887F1, { 0x02,0x1C,0x60,0x0A,0x1C,0x1C,0x1C,0x1C,0xF0,0x1C,0xDC,0x94,0x1C,0x44,0x1C,0xAB } },
+    { 0xF65887F1, { 0x02,0x1C,0x60,0x0A,0x1C,0x1C,0x1C,0x1C,0xF0,0x1C,0xDC,0x94,0x1C,0x44,0x1C,0xAB } },
+    { 0xF65887F1, { 0x02,0x1C,0x60,0x0A,0x1C,0x1C,0x1C,0x1C,0xF0,0x1C,0xDC,0x94,0x1C,0x44,0x1C,0xAB } },
+    { 0x468387EC, { 0xC6,0x1C,0xBB,0xF4,0x1C,0x1C,0x1C,0x1C,0xA6,0x1C,0x0F,0x12,0x1C,0xEE,0x1C,0xAB } },
+    { 0x468387EC, { 0xC6,0x1C,0xBB,0xF4,0x1C,0x1C,0x1C,0x1C,0xA6,0x1C,0x0F,0x12,0x1C,0xEE,0x1C,0xAB } },
+    { 0x468387EC, { 0xC6,0x1C,0xBB,0xF4,0x1C,0x1C,0x1C,0x1C,0xA6,0x1C,0x0F,0x12,0x1C,0xEE,0x1C,0xAB } },
+    { 0xC425CB00, { 0xDA,0x1C,0x1C,0x72,0x1C,0x7E,0x1C,0x1C,0x9D,0x1C,0x2E,0xCB,0x1C,0x85,0x1C,0xAB } },
+    { 0xC425CB00, { 0xDA,0x1C,0x1C,0x72,0x1C,0x7E,0x1C,0x1C,0x9D,0x1C,0x2E,0xCB,0x1C,0x85,0x1C,0xAB } },
+    { 0x3E4D1A56, { 0xDD,0x1C,0x6E,0x4E,0x1C,0xB6,0x1C,0x1C,0x75,0x1C,0x56,0x62,0x1C,0x5B,0x1C,0xAB } },
+    { 0x3E4D1A56, { 0xDD,0x1C,0x6E,0x4E,0x1C,0xB6,0x1C,0x1C,0x75,0x1C,0x56,0x62,0x1C,0x5B,0x1C,0xAB } },
+    { 0x3E4D1A56, { 0xDD,0x1C,0x6E,0x4E,0x1C,0xB6,0x1C,0x1C,0x75,0x1C,0x56,0x62,0x1C,0x5B,0x1C,0xAB } },
+    { 0x6C5B4E13, { 0xEC,0x1C,0x4C,0x2D,0x1C,0xEC,0x1C,0x1C,0x8E,0xBB,0x04,0x8C,0x1C,0xA1,0xF1,0xAB } },
+    { 0x6C5B4E13, { 0xEC,0x1C,0x4C,0x2D,0x1C,0xEC,0x1C,0x1C,0x8E,0xBB,0x04,0x8C,0x1C,0xA1,0xF1,0xAB } },
+    { 0x83C2110C, { 0x27,0xBB,0xAC,0xCB,0x1C,0xAA,0x1C,0x1C,0xC6,0x2C,0xA9,0x56,0x20,0x10,0xC5,0xAB } },
+    { 0x83C2110C, { 0x27,0xBB,0xAC,0xCB,0x1C,0xAA,0x1C,0x1C,0xC6,0x2C,0xA9,0x56,0x20,0x10,0xC5,0xAB } },
+    { 0x83C2110C, { 0x27,0xBB,0xAC,0xCB,0x1C,0xAA,0x1C,0x1C,0xC6,0x2C,0xA9,0x56,0x20,0x10,0xC5,0xAB } },
+    { 0x409ABEC8, { 0xBF,0x0F,0xD8,0x60,0x1C,0xD8,0x1C,0x1C,0x5D,0xD9,0xD8,0x79,0x2D,0x8B,0xDF,0xAB } },
+    { 0x409ABEC8, { 0xBF,0x0F,0xD8,0x60,0x1C,0xD8,0x1C,0x1C,0x5D,0xD9,0xD8,0x79,0x2D,0x8B,0xDF,0xAB } },
+    { 0x409ABEC8, { 0xBF,0x0F,0xD8,0x60,0x1C,0xD8,0x1C,0x1C,0x5D,0xD9,0xD8,0x79,0x2D,0x8B,0xDF,0xAB } },
+    { 0xED0872FA, { 0xAB,0xDC,0x54,0x29,0x1C,0x7E,0x1C,0x1C,0x5E,0x81,0x4E,0x88,0xE3,0x3C,0xD5,0xAB } },
+    { 0xED0872FA, { 0xAB,0xDC,0x54,0x29,0x1C,0x7E,0x1C,0x1C,0x5E,0x81,0x4E,0x88,0xE3,0x3C,0xD5,0xAB } },
+    { 0x4F0E1F8E, { 0x1B,0xBD,0x95,0x29,0x1C,0x3A,0x32,0x1C,0xF1,0x40,0x3A,0x2D,0xB3,0xC1,0x5B,0xAB } },
+    { 0x4F0E1F8E, { 0x1B,0xBD,0x95,0x29,0x1C,0x3A,0x32,0x1C,0xF1,0x40,0x3A,0x2D,0xB3,0xC1,0x5B,0xAB } },
+    { 0x4F0E1F8E, { 0x1B,0xBD,0x95,0x29,0x1C,0x3A,0x32,0x1C,0xF1,0x40,0x3A,0x2D,0xB3,0xC1,0x5B,0xAB } },
+    { 0x847721AE, { 0x23,0x1A,0x61,0xBD,0x1C,0x3A,0xF7,0x1C,0xF4,0x40,0xD7,0xD5,0xD6,0xF6,0x44,0xAB } },
+    { 0x847721AE, { 0x23,0x1A,0x61,0xBD,0x1C,0x3A,0xF7,0x1C,0xF4,0x40,0xD7,0xD5,0xD6,0xF6,0x44,0xAB } },
+    { 0x847721AE, { 0x23,0x1A,0x61,0xBD,0x1C,0x3A,0xF7,0x1C,0xF4,0x40,0xD7,0xD5,0xD6,0xF6,0x44,0xAB } },
+    { 0x6AE2E0DD, { 0xFD,0xA6,0x37,0xF0,0x46,0x56,0xA4,0x1C,0x2F,0x27,0x57,0x0C,0x32,0x09,0xEB,0xAB } },
+    { 0x6AE2E0DD, { 0xFD,0xA6,0x37,0xF0,0x46,0x56,0xA4,0x1C,0x2F,0x27,0x57,0x0C,0x32,0x09,0xEB,0xAB } },
+    { 0xD7D3F078, { 0xD4,0x06,0x03,0x49,0xC9,0x1C,0x1E,0x2E,0xA2,0x32,0xC0,0x57,0xC6,0xD9,0xC6,0xAB } },
+    { 0xD7D3F078, { 0xD4,0x06,0x03,0x49,0xC9,0x1C,0x1E,0x2E,0xA2,0x32,0xC0,0x57,0xC6,0xD9,0xC6,0xAB } },
+    { 0xD7D3F078, { 0xD4,0x06,0x03,0x49,0xC9,0x1C,0x1E,0x2E,0xA2,0x32,0xC0,0x57,0xC6,0xD9,0xC6,0xAB } },
+    { 0x3AC4E5A7, { 0x09,0xF6,0xFC,0xB4,0x6D,0x1C,0x84,0x9A,0x17,0x5A,0x7C,0x70,0xAE,0x8B,0xF7,0xAB } },
+    { 0x3AC4E5A7, { 0x09,0xF6,0xFC,0xB4,0x6D,0x1C,0x84,0x9A,0x17,0x5A,0x7C,0x70,0xAE,0x8B,0xF7,0xAB } },
+    { 0x200A47C5, { 0x2B,0xA3,0xA9,0x4D,0x41,0x1C,0x5A,0x70,0x3C,0x8A,0x43,0x27,0x4A,0xB4,0xA5,0xAB } },
+    { 0x200A47C5, { 0x2B,0xA3,0xA9,0x4D,0x41,0x1C,0x5A,0x70,0x3C,0x8A,0x43,0x27,0x4A,0xB4,0xA5,0xAB } },
+    { 0x200A47C5, { 0x2B,0xA3,0xA9,0x4D,0x41,0x1C,0x5A,0x70,0x3C,0x8A,0x43,0x27,0x4A,0xB4,0xA5,0xAB } },
+    { 0xB88244AE, { 0x0B,0xBF,0x3E,0x6E,0xAF,0x1C,0xCB,0xCC,0x92,0xE1,0x3B,0xBA,0x60,0xEC,0xA0,0xAB } },
+    { 0xB88244AE, { 0x0B,0xBF,0x3E,0x6E,0xAF,0x1C,0xCB,0xCC,0x92,0xE1,0x3B,0xBA,0x60,0xEC,0xA0,0xAB } },
+    { 0xB88244AE, { 0x0B,0xBF,0x3E,0x6E,0xAF,0x1C,0xCB,0xCC,0x92,0xE1,0x3B,0xBA,0x60,0xEC,0xA0,0xAB } },
+    { 0x2D3CA758, { 0x45,0x40,0xD4,0x9E,0x1F,0x60,0x64,0xE3,0x2C,0x1C,0x02,0x1D,0xAC,0xC8,0xA2,0xD2 } },
+    { 0x2D3CA758, { 0x45,0x40,0xD4,0x9E,0x1F,0x60,0x64,0xE3,0x2C,0x1C,0x02,0x1D,0xAC,0xC8,0xA2,0xD2 } },
+    { 0xAF2A6730, { 0x2C,0x4A,0xDB,0x94,0x1D,0xFB,0x0F,0xE3,0x2C,0xA7,0xB9,0xA1,0x62,0x3A,0xAF,0x24 } },
+    { 0xAF2A6730, { 0x2C,0x4A,0xDB,0x94,0x1D,0xFB,0x0F,0xE3,0x2C,0xA7,0xB9,0xA1,0x62,0x3A,0xAF,0x24 } },
+  } },
+  { 0x3725AC79, {   // Meteor
+    { 0x90C654C9, { 0xC8,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xBE871CC4, { 0xF5,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x955CF5A8, { 0x36,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x32083AF0, { 0x15,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x506E1FC2, { 0x89,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x68951514, { 0x9E,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x5539B728, { 0x63,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xA68755BB, { 0xE0,0xE9,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x83D8843F, { 0xDF,0x8E,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x1B900BFA, { 0x8D,0xF6,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x01F67D53, { 0x3A,0x41,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xAB77ED31, { 0x20,0x01,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xC220856A, { 0xD2,0xF7,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x8D07629E, { 0x12,0x77,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xBC3179A8, { 0xAF,0x1F,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x1C941B78, { 0x5B,0x4C,0x14,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x9F3B5676, { 0xE9,0x68,0x17,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xB2A1F43F, { 0x31,0xBE,0xF0,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x480ED319, { 0x54,0x01,0x71,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7CAFA032, { 0x8B,0x21,0x1B,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x5F511A1C, { 0x64,0x2F,0xE1,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x56BC3289, { 0x1C,0x8B,0x3F,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xC25F70E7, { 0x1C,0x69,0x4A,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x526C8C43, { 0x1C,0xF3,0x16,0x99,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x67F5BC3B, { 0x1C,0xDA,0xB3,0x96,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x5AE9881C, { 0x1C,0xCE,0x85,0x0C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x5E1600C9, { 0x1C,0xBA,0xE4,0x41,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xCA931AB0, { 0x1C,0x98,0x52,0xD6,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x2F2CA5B8, { 0x1C,0x5E,0x06,0xDA,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xEBF09037, { 0x1C,0x8B,0x65,0xB3,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x1A311D20, { 0x1C,0x1C,0xC2,0x33,0xC9,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xD548691B, { 0x1C,0x1C,0x35,0x15,0x97,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x1594B464, { 0x1C,0x1C,0x42,0xC2,0xE8,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x706FFE6D, { 0x1C,0x1C,0x9E,0x4B,0xFB,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x1E1C7B63, { 0x1C,0x1C,0x80,0x96,0xDC,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xFA318AFD, { 0x1C,0x1C,0x98,0xA2,0xD6,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x746DE9D2, { 0x1C,0x1C,0xD4,0x58,0xAA,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x6590C897, { 0x1C,0x1C,0xC7,0x83,0x83,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xE31CE056, { 0x1C,0x1C,0x66,0x74,0x86,0x37,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x2EF1C109, { 0x1C,0x1C,0x66,0xCC,0x67,0xB1,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xE9034EEE, { 0x1C,0x1C,0x1C,0xEB,0xF6,0x30,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xA06FBDF3, { 0x1C,0x1C,0x1C,0x6E,0xB9,0xE9,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x85E92EA8, { 0x1C,0x1C,0x1C,0x70,0xB7,0xC6,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xC9604184, { 0x1C,0x1C,0x1C,0x3A,0x27,0x8A,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xF558E738, { 0x1C,0x1C,0x1C,0x65,0x2D,0xE3,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x22D7D49F, { 0x1C,0x1C,0x1C,0x66,0x3E,0xB2,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x155F5E66, { 0x1C,0x1C,0x1C,0x1C,0x54,0x90,0xF8,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x81306C80, { 0x1C,0x1C,0x1C,0x1C,0xF0,0x09,0x74,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x21CEB1F4, { 0x1C,0x1C,0x1C,0x1C,0xFA,0x8D,0x5C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xCD57F181, { 0x1C,0x1C,0x1C,0x1C,0x65,0xBB,0x3F,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xF99477DB, { 0x1C,0x1C,0x1C,0x1C,0xA0,0xDF,0xD0,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x28D2226F, { 0x1C,0x1C,0x1C,0x1C,0xA6,0xE6,0x3E,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x0D7CE279, { 0x1C,0x1C,0x1C,0x1C,0xE3,0xB0,0x15,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x45CB1D43, { 0x1C,0x1C,0x1C,0x1C,0x9D,0xCB,0x2A,0xCE,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x9345DEB3, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x31,0x31,0x81,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x32F0D344, { 0x1C,0x1C,0x1C,0x1C,0x46,0xC2,0x40,0x91,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x09428D49, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x6D,0x70,0x84,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xDA5F4833, { 0x1C,0x1C,0x1C,0x1C,0x1C,0xE4,0x05,0xD9,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x05238FFA, { 0x1C,0x1C,0x1C,0x1C,0x1C,0xCA,0x9E,0x27,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xB1CFE0AB, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x0D,0x7B,0x98,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xCCCD811B, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x4E,0xB0,0xE9,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xCC1C6C52, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x86,0x44,0x30,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x54F53352, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xD9,0xC6,0x58,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xF348EFFC, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x05,0x43,0x95,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+  } },
+  { 0x1C4B8CCD, {   // Confetti
+    { 0xB76E06A3, { 0x1C,0x1C,0x1C,0x19,0xEB,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x1096FDED, { 0x1C,0x1C,0x1C,0x7F,0xEF,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x19,0x5E,0xAB } },
+    { 0x52D59A02, { 0x1C,0x1C,0x1C,0x3D,0x41,0x1C,0x11,0x13,0x1C,0x1C,0x1C,0x1C,0x1C,0x63,0x55,0xAB } },
+    { 0x08D6A85C, { 0x1C,0x1C,0x1C,0x21,0x70,0x1C,0x2F,0x2F,0x1C,0x1C,0xCA,0x1C,0x1C,0x19,0x59,0xAB } },
+    { 0x03CD4C96, { 0x1C,0x42,0x1C,0xEA,0x31,0xC7,0x06,0x62,0x1C,0x1C,0x2D,0x1C,0x1C,0x13,0xD2,0xAB } },
+    { 0xBE2885A3, { 0x1C,0xD5,0x13,0xDE,0x41,0xD7,0x2F,0x3F,0x1C,0x1C,0x06,0x1C,0x1C,0x1D,0x8E,0xAB } },
+    { 0x844D9040, { 0x8E,0x30,0x7C,0x43,0x14,0x3B,0xBA,0xB5,0x1C,0x1C,0x6B,0x1C,0x1C,0x84,0xF8,0xAB } },
+    { 0x16BA2645, { 0xD0,0x0B,0x60,0x6F,0x3C,0x4C,0x84,0x86,0x86,0x1C,0xD6,0x1C,0x1C,0xE1,0xD9,0xAB } },
+    { 0xCBE566B8, { 0xC3,0x44,0x68,0x06,0x64,0x9A,0x8E,0x2B,0x82,0x1C,0x0C,0x82,0x1C,0xDD,0x4F,0xAB } },
+    { 0x439E65CE, { 0xE9,0x73,0x0C,0x62,0x8C,0x4B,0xD8,0x35,0xDB,0x1C,0x1C,0xD4,0x1C,0x73,0x04,0xAB } },
+    { 0x9182C2CD, { 0x3B,0xAF,0x0E,0x3C,0x99,0x2E,0xE4,0x57,0xBC,0x1C,0xDC,0x5E,0x1C,0xED,0x2E,0xAB } },
+    { 0x3AA2BE34, { 0x94,0x94,0x87,0x8A,0x92,0xEE,0x1D,0x84,0x21,0x1C,0xEF,0x28,0xBF,0x6F,0x8A,0xAB } },
+    { 0xE08F9B89, { 0x72,0xE9,0x97,0x39,0x2E,0x98,0xEC,0xC7,0xA9,0x54,0x55,0xBC,0x8B,0x43,0xF9,0xAB } },
+    { 0xBD0CDA6C, { 0xD1,0x12,0x0E,0xDA,0x07,0x42,0xDE,0x5C,0xA1,0xC5,0x87,0x9A,0x8F,0x9E,0x6E,0xA4 } },
+    { 0x10BDF623, { 0xB8,0xAA,0xD5,0x2A,0x8E,0xC9,0xD3,0xA1,0x3F,0xF4,0xA3,0x4F,0x5B,0x26,0x95,0x11 } },
+    { 0x67EB5E8B, { 0xC0,0x5C,0x0B,0x25,0xF0,0x1A,0x94,0x98,0xF1,0x83,0x16,0xCC,0x1C,0x40,0x5E,0x29 } },
+    { 0x9D782D65, { 0x6B,0x40,0xAC,0x8A,0x14,0xE2,0x8E,0x7A,0x71,0x09,0xC0,0xC2,0x39,0x77,0x11,0x44 } },
+    { 0x9254A962, { 0x57,0x8F,0xF0,0x64,0xCA,0xF9,0xD9,0xB0,0x63,0x2F,0xF1,0x9B,0xB5,0x22,0x32,0x05 } },
+    { 0x6D4C3C22, { 0x50,0x85,0x63,0x4B,0x96,0x57,0xE2,0xCA,0xF4,0xC0,0xA4,0x1A,0x57,0x6E,0x6C,0x7F } },
+    { 0x1816566C, { 0x42,0x7E,0x42,0xA8,0xBA,0xC0,0x26,0xE6,0x0F,0x10,0x28,0x37,0x18,0x67,0xBF,0x26 } },
+    { 0x82936341, { 0xA3,0xE9,0x5B,0x79,0xB4,0xFF,0x04,0x1C,0x79,0x1F,0xFC,0x3F,0x4B,0x0C,0x3C,0x30 } },
+    { 0x047CB66C, { 0xFF,0x46,0xBF,0xEA,0x7A,0x15,0xDA,0xCD,0xBD,0x17,0x3D,0x0A,0xFD,0x94,0x8B,0xBD } },
+    { 0x6349A42A, { 0x66,0x59,0x04,0x5F,0x7C,0x58,0xAE,0x2F,0x90,0x76,0x6E,0x70,0xD2,0x02,0xA4,0xFB } },
+    { 0x65536023, { 0xCE,0x4A,0x24,0x59,0x30,0x97,0x06,0x39,0x23,0x46,0xA0,0x94,0x03,0xBF,0xE9,0xDF } },
+    { 0xCA7F8AB0, { 0x2B,0xA4,0xFA,0xFC,0x00,0xE3,0xBB,0x2E,0x82,0x51,0x82,0x27,0x54,0xE3,0x7E,0x1B } },
+    { 0xD9782085, { 0x0C,0x93,0xF7,0x39,0xA9,0x6B,0x64,0x70,0x9B,0x92,0x74,0x8C,0xCF,0x12,0x38,0x48 } },
+    { 0xE99D4290, { 0x17,0x7D,0xBF,0x07,0xAD,0x65,0x36,0x1A,0xE5,0x52,0xE4,0x7C,0xD9,0xE4,0x2D,0x48 } },
+    { 0x307C1844, { 0x4B,0x84,0x37,0x60,0xDB,0x91,0x8C,0x56,0x49,0xC7,0x68,0x8B,0xFB,0x23,0xB9,0x90 } },
+    { 0xFC05CEC5, { 0x62,0x5D,0x47,0xA5,0x8E,0xBF,0xD0,0xB3,0x55,0x95,0xF1,0x38,0xDE,0x19,0x2D,0xA8 } },
+    { 0x4A20CD1B, { 0xB2,0x42,0x57,0xB4,0x0E,0x22,0xC4,0xD6,0x88,0x1C,0x81,0xD0,0x7E,0xD7,0x8B,0x19 } },
+    { 0x25AF6893, { 0x95,0xF0,0xE8,0xC6,0x77,0x3A,0x25,0x30,0x2A,0x7C,0x58,0x53,0x49,0xA4,0xC2,0x45 } },
+    { 0xD9F9BEFE, { 0xF4,0xEE,0x29,0x0F,0xFA,0x74,0x44,0x36,0xB3,0x94,0xB9,0xB4,0xCB,0xCF,0x6F,0xFB } },
+    { 0x117478DC, { 0xB3,0x64,0xFD,0x60,0x79,0x63,0xC5,0xF3,0x30,0x31,0x49,0x2F,0x3F,0x79,0x80,0x35 } },
+    { 0x56E0054E, { 0xA0,0x0C,0x01,0x19,0xBE,0x37,0x52,0x2B,0x3A,0xC6,0x6C,0xFD,0xA8,0x85,0xEF,0xA4 } },
+    { 0xFC98331E, { 0x27,0x7D,0xCC,0xCA,0x45,0x95,0x27,0xF8,0xF0,0x62,0x7B,0xB2,0xC9,0x97,0x87,0x7D } },
+    { 0x04980FE6, { 0x6F,0x30,0x5A,0x97,0x86,0x25,0xDC,0xE7,0xDD,0xD2,0xAD,0x0E,0x4E,0x53,0x5F,0xC9 } },
+    { 0x1F3F170C, { 0x4A,0x1A,0xBD,0xBF,0xD5,0x85,0x08,0xF7,0x74,0xD4,0x5F,0xDB,0xD5,0x5F,0x66,0xAD } },
+    { 0xCEF59F93, { 0x2C,0x8A,0xE7,0x58,0xC8,0xCB,0xFF,0x5A,0xC0,0xED,0xE3,0x88,0x0D,0xBE,0x57,0x37 } },
+    { 0xEA70A789, { 0x86,0xC4,0xD7,0xA1,0x03,0xCB,0x31,0x25,0xF9,0x9B,0xC0,0x32,0xB7,0x0E,0x96,0x45 } },
+    { 0x96CEEB58, { 0x1D,0x5B,0x27,0x6E,0xE4,0x5F,0x05,0xF7,0xB3,0xC1,0x6D,0x6C,0x99,0x78,0xAB,0x4D } },
+    { 0x7B5B1CFC, { 0xB3,0xA9,0x8E,0x2F,0xCD,0x8C,0x7D,0x18,0xDA,0xA1,0xEC,0xE9,0xA6,0x4A,0xC2,0xF7 } },
+    { 0xBE51ECC0, { 0x19,0xA9,0x5E,0x06,0x4C,0x3A,0x0F,0xB1,0x89,0x17,0x42,0x2F,0xF2,0x41,0xA3,0x89 } },
+    { 0xC81536C5, { 0x10,0x91,0xCF,0x14,0xA2,0x4F,0x0D,0xA6,0x74,0x5F,0x26,0xDC,0x70,0xA4,0x03,0xF3 } },
+    { 0xF747A916, { 0x19,0x23,0xE4,0x0D,0x7E,0xEC,0x59,0x29,0x5C,0x18,0x67,0x9F,0xA3,0xFA,0x98,0x07 } },
+    { 0x0B1FDCB8, { 0x89,0xC3,0x4A,0xB2,0x2C,0x44,0x7C,0x8B,0x29,0x18,0x84,0xCF,0x55,0x60,0x0C,0xF0 } },
+    { 0x33F1F99E, { 0x9B,0xB5,0xF3,0x30,0x90,0xA2,0xA2,0x87,0xFE,0x8C,0x16,0x90,0xD2,0x2C,0x2B,0xB5 } },
+    { 0xAADE6F39, { 0xB8,0xA7,0x42,0xC4,0x81,0x15,0x9B,0xAA,0xA7,0xE7,0xFE,0xD9,0x2B,0xD9,0xFE,0x24 } },
+    { 0x0F41CB26, { 0x12,0x3B,0x7F,0x0D,0x71,0x86,0x39,0xC8,0x91,0x59,0x4A,0xA9,0xF2,0x3A,0xB6,0xB8 } },
+    { 0x1217744F, { 0x6C,0xAE,0xEF,0xD0,0xC4,0x90,0x13,0x8D,0x9B,0x1D,0x81,0xA6,0xFD,0x42,0xA7,0x86 } },
+    { 0x223D5CAD, { 0x02,0x69,0xAC,0x92,0x81,0xAB,0xC0,0x85,0x71,0x48,0x29,0x70,0xC4,0x57,0xE0,0x1B } },
+    { 0x744A0FBF, { 0x18,0x1E,0xA2,0x82,0xB0,0x0E,0x73,0xEC,0xB2,0xB2,0x02,0xD5,0xE2,0x98,0x60,0x35 } },
+    { 0x7F8C33B1, { 0x7D,0xBC,0xBE,0x90,0x75,0x86,0x1A,0xCE,0x21,0x54,0x6B,0xC3,0x58,0xF3,0x24,0x6A } },
+    { 0xBF790C32, { 0xBE,0x28,0x4A,0xC7,0xA7,0xAB,0x6B,0xCD,0xE6,0x25,0x06,0x2C,0x7A,0xBB,0x94,0x5A } },
+    { 0x6482FDE1, { 0xEE,0x4C,0xC3,0x50,0xA9,0x11,0xC0,0xA0,0x30,0xE1,0x39,0xE3,0x60,0xCE,0x30,0x23 } },
+    { 0xC742ECB5, { 0x01,0xE1,0x43,0x15,0x47,0xA8,0x08,0xD2,0x30,0x8F,0xD3,0xEF,0x0D,0x1A,0xDD,0x8E } },
+    { 0x35EA9369, { 0x74,0xB7,0xD3,0x53,0x93,0x3B,0xDE,0x60,0x53,0xAE,0x19,0xF2,0x77,0x3F,0x34,0xC2 } },
+    { 0x8535AB89, { 0xA2,0x8A,0x30,0xF6,0x07,0x64,0x14,0x55,0x41,0xC4,0x28,0x75,0x09,0x2C,0x06,0x65 } },
+    { 0x31CA46F9, { 0x6D,0xB8,0x8B,0x26,0xC6,0xDA,0x86,0x5A,0x05,0x04,0x8E,0xFA,0xC2,0x7D,0x21,0xB1 } },
+    { 0x77DE4CAF, { 0x64,0x66,0x70,0xE0,0x85,0xF8,0xB5,0xA1,0x80,0x7F,0x28,0x03,0xDA,0xEC,0x6E,0xC9 } },
+    { 0xAF40D298, { 0x17,0x2C,0x8D,0x21,0x13,0x27,0x25,0xC6,0x9A,0xC1,0xB7,0xB7,0xB4,0x80,0xD1,0xCF } },
+    { 0x1E45193E, { 0x0A,0x9B,0x2F,0x1E,0x23,0xD3,0x3E,0x11,0x9A,0x8C,0xEF,0x5A,0x9F,0x7A,0x61,0x8A } },
+    { 0x587721A5, { 0xD3,0x17,0x4E,0x55,0x7F,0x1B,0x79,0x8D,0x2D,0x8C,0xAF,0x71,0xA2,0xCA,0xAD,0xD4 } },
+    { 0x1A93D735, { 0x3B,0x9C,0xE1,0x54,0x40,0x4A,0x03,0xB4,0x10,0xEC,0xBF,0x69,0x73,0x63,0xBC,0xFB } },
+    { 0xA9D5CA4D, { 0xDB,0x60,0xF4,0x52,0x57,0x80,0x35,0xED,0xA0,0x90,0x5A,0x14,0xC3,0xA1,0x10,0x3B } },
+  } },
+  { 0x9D7720A9, {   // Juggle
+    { 0xA1BB7717, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x0A,0x1D,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x236A79E3, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x0A,0xF1,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xEFF14E87, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x0A,0xDD,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x11F49419, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x0A,0x6E,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x5A595277, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xDD,0x60,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x16F3BBF6, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x20,0x30,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xF2D1795B, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xBC,0xF2,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7EF4537C, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x83,0x02,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x7075F3E0, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x36,0xA3,0x70,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x81FC9863, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x86,0x45,0x06,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xEDE01D7A, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xBC,0x92,0xB2,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xE991FC71, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xC8,0x09,0xF7,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xC6CD0DC2, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x17,0x3F,0x92,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x01D8F4D5, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x40,0x2C,0x91,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xA4E05A45, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x52,0xC1,0x22,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x2CCE70F0, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB,0x3C,0x33,0x05,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x44E7B2DE, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xA5,0x33,0x77,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x4CD58470, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xA0,0x56,0xC8,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xC2EC25C6, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2C,0xCD,0x39,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xEB47A59E, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xC3,0x78,0x6D,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xFD408B7D, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAD,0x0B,0xC8,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x3C08EABB, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x33,0xD2,0xEE,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xA2405394, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x25,0xE8,0xBA,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x3FB676E0, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x34,0x73,0x85,0x14,0x1C,0x1C,0x1C,0xAB } },
+    { 0xDFE03FBE, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xCE,0x4A,0xA1,0x70,0x1C,0x1C,0x1C,0xAB } },
+    { 0x6D5A2000, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x21,0x68,0x53,0xE2,0x1C,0x1C,0x1C,0xAB } },
+    { 0xAE49D4B8, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x7E,0xC5,0xB5,0xEB,0x1C,0x1C,0x1C,0xAB } },
+    { 0x43EB3E78, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x77,0xAE,0x0B,0x1C,0x1C,0x1C,0xAB } },
+    { 0xF0A99C65, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x97,0x55,0x79,0x1C,0x1C,0x1C,0xAB } },
+    { 0x82829A46, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x3E,0xF1,0xB9,0x1C,0x1C,0x1C,0xAB } },
+    { 0xF75E5EC5, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xCF,0x7C,0x51,0x1C,0x1C,0x1C,0xAB } },
+    { 0xECC59233, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xDC,0x16,0xC2,0x27,0x1C,0x1C,0xAB } },
+    { 0x60C85040, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xBD,0x1C,0x1F,0x55,0x1C,0x1C,0xAB } },
+    { 0x118BC18A, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xDC,0x8F,0x7E,0x90,0x1C,0x1C,0xAB } },
+    { 0xE2ED03E4, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x7B,0x0B,0xA9,0xA1,0x1C,0x1C,0xAB } },
+    { 0x2F799602, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x74,0xC3,0xA7,0xAB,0x1C,0x1C,0xAB } },
+    { 0xE17AF6CF, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xB6,0x80,0x9E,0x7E,0x1C,0x1C,0xAB } },
+    { 0x1A7F6BAC, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xA1,0xEC,0x79,0x1C,0x1C,0xAB } },
+    { 0x980F5D69, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x68,0xF3,0x37,0x1C,0x1C,0xAB } },
+    { 0x5DBCE031, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x86,0x81,0x79,0x1C,0x1C,0xAB } },
+    { 0x4FBDA97F, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x92,0x3F,0x10,0x54,0x1C,0xAB } },
+    { 0xE7B92D05, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x08,0x5A,0x64,0x48,0x1C,0xAB } },
+    { 0xAF94B5F4, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x8B,0xB1,0x29,0xD1,0x1C,0xAB } },
+    { 0x7F60E49A, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x81,0xD5,0xF9,0x11,0x1C,0xAB } },
+    { 0x84CFD87C, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xE9,0xB3,0xF3,0xA2,0x1C,0xAB } },
+    { 0xF4E6D4CC, { 0x1E,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x3C,0x76,0x89,0x64,0x1C,0xAB } },
+    { 0xEBCAE069, { 0x7D,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x95,0x22,0xBC,0x2C,0x1C,0xAB } },
+    { 0x658E0B30, { 0x26,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xB6,0xED,0xB6,0x3F,0x1C,0xAB } },
+    { 0x0905B922, { 0x38,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x67,0x60,0xB4,0x1C,0xAB } },
+    { 0xDBC1DE40, { 0x7E,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xF7,0xB1,0xD3,0x1C,0xAB } },
+    { 0xD4447797, { 0x75,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1E,0xD2,0x25,0x1C,0xAB } },
+    { 0xF468F36F, { 0xA8,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x39,0xFE,0xC5,0x1C,0xAB } },
+    { 0x6221034C, { 0xF8,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x83,0x25,0x8A,0x1C,0xAB } },
+    { 0x1E178719, { 0x4E,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x76,0x3F,0xD0,0x1C,0xAB } },
+    { 0xEEC1424A, { 0xDD,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAE,0x48,0x1D,0x1C,0xAB } },
+    { 0x0D1A771B, { 0xD3,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2B,0x08,0x9C,0x1C,0xAB } },
+    { 0x86D0F519, { 0xC1,0x7B,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x8D,0xFA,0x98,0x1C,0xAB } },
+    { 0x494B1B68, { 0x4D,0x77,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x8C,0x41,0x96,0x1C,0xAB } },
+    { 0xA427F7F0, { 0x97,0xC9,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x4C,0x7F,0x2D,0x1C,0xAB } },
+    { 0x7A8256FD, { 0x6D,0x62,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x63,0x1A,0x1B,0x1C,0xAB } },
+    { 0x07BE29B9, { 0xDB,0x22,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x47,0xDE,0x1C,0xAB } },
+    { 0x495C7506, { 0xB5,0xD5,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x4B,0x91,0x1C,0xAB } },
+    { 0xEF687314, { 0xEB,0x5B,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x6C,0x47,0x1C,0xAB } },
+    { 0x33FB0420, { 0xB3,0x0C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x20,0x55,0x1C,0xAB } },
+  } },
+  { 0x819B178F, {   // Bubble
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xA6F38B15, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x0333F2FB, { 0x23,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x92723832, { 0xDD,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x4A6FF28C, { 0xB9,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xAF0CB88D, { 0x25,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x3D9C801F, { 0x2F,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xA91230B7, { 0x0C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x0BFB5059, { 0xE2,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xCF47D1D0, { 0xB8,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x1767A2FE, { 0x4C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xEC5971A4, { 0x95,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x1DBF0290, { 0x1D,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x6B8BB58F, { 0xD6,0x70,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x44BCC70A, { 0x63,0xB5,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xB0FFB52D, { 0xF1,0x76,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xEFC813EE, { 0x9D,0xB3,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xFFEC43B1, { 0x1F,0x50,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xC1D5BB23, { 0x56,0xAE,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xD2DD9D9E, { 0x85,0x4D,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xD4BB1036, { 0x5D,0xB7,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x864D0830, { 0xB6,0x39,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xD0DA0A82, { 0x52,0x13,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x3D0F4E19, { 0x7A,0x48,0xC7,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x293629B5, { 0x79,0x35,0xA8,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x2A7C752F, { 0x9C,0x29,0x81,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xAB2E483F, { 0xD5,0x16,0xDD,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x5E472FB5, { 0xDB,0x7B,0xB0,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x238BC62B, { 0xDB,0x80,0xBC,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x14F9E9C9, { 0x34,0xB6,0x0D,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x511DD395, { 0x78,0x50,0x7E,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xE591E290, { 0x39,0xD5,0xED,0x63,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x05719E04, { 0x08,0x0B,0xE7,0x80,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x00552E69, { 0xE5,0x4C,0xC4,0xD6,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x1DA27B02, { 0x8D,0xA0,0x30,0xAD,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x90B5D436, { 0x5B,0xF9,0x5A,0x48,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x917AA398, { 0x12,0x5D,0xCB,0x96,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xFAB48942, { 0x14,0xF8,0x3C,0xFB,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x05EF60CE, { 0x18,0xAA,0x4C,0xB3,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xB238B004, { 0x68,0xC5,0x2E,0xFA,0x33,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x4FD32291, { 0x5E,0x1C,0xAA,0x73,0x2F,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x97BD8D06, { 0xB5,0x78,0x78,0xF2,0x34,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x35E3D4A2, { 0xC7,0x22,0xA2,0xEC,0x09,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x27D57467, { 0x68,0xE7,0x9E,0x88,0x2B,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x3001D5FA, { 0x15,0x8B,0x6E,0x73,0xB1,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x0129705B, { 0xA2,0xBB,0xDC,0xC0,0x6D,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x3CBD5A52, { 0xFA,0x26,0x27,0x24,0x47,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x6614FC2B, { 0x28,0x5F,0x78,0xE9,0x7C,0xF9,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xE6EBAB8B, { 0xAC,0xD6,0xE7,0x9B,0x72,0x44,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x49277DF5, { 0x69,0x97,0x88,0x61,0xBF,0xC4,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xCBEF667E, { 0x5D,0x23,0x2A,0x5C,0x75,0xB2,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x0B95FB7B, { 0x0B,0x86,0xD6,0x95,0xD5,0xF8,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x07214A5E, { 0x72,0x79,0x44,0xBE,0x8E,0x0F,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x6E425327, { 0x86,0xFA,0x7C,0xAA,0xD4,0x5E,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xB041F99E, { 0xAB,0x38,0xD6,0xF8,0xB0,0x79,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xE99B1FBB, { 0x07,0x6F,0x52,0xB9,0x1B,0x2F,0x39,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xB0989B8A, { 0x28,0xD8,0xE2,0x44,0x67,0x45,0x21,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x8D4EDB50, { 0x40,0x15,0x53,0xE0,0x8A,0xBD,0x90,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x6DE8D74C, { 0x46,0xFA,0x30,0xB7,0xB0,0xC2,0xB6,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xD3E06C33, { 0x44,0x1A,0x7F,0x75,0x12,0x52,0x1D,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0xA2949DCD, { 0xEA,0xCB,0xFF,0xB4,0x78,0x38,0xD7,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+    { 0x50FE6576, { 0xB1,0x79,0xFB,0x4A,0x4D,0x69,0xB2,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0xAB } },
+  } },
+  { 0xC1B6F6C4, {   // Magnets
+    { 0x356C865F, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0x356C865F, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0x356C865F, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0x356C865F, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0x356C865F, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0x356C865F, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0x356C865F, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0x356C865F, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0x356C865F, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0x356C865F, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0xEF6C97D9, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x06,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0xEF6C97D9, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x06,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0xEF6C97D9, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x06,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0xEF6C97D9, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x06,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0xEF6C97D9, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x06,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0xEF6C97D9, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x06,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0xEF6C97D9, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x06,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0xEF6C97D9, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x06,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0xEF6C97D9, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x06,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0xEF6C97D9, { 0x1C,0x1C,0x1C,0x1C,0x1C,0x06,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0x04273147, { 0x1C,0x1C,0x1C,0x1C,0x8A,0x09,0x2D,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0x04273147, { 0x1C,0x1C,0x1C,0x1C,0x8A,0x09,0x2D,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0x04273147, { 0x1C,0x1C,0x1C,0x1C,0x8A,0x09,0x2D,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0x04273147, { 0x1C,0x1C,0x1C,0x1C,0x8A,0x09,0x2D,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0x04273147, { 0x1C,0x1C,0x1C,0x1C,0x8A,0x09,0x2D,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0x04273147, { 0x1C,0x1C,0x1C,0x1C,0x8A,0x09,0x2D,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0x04273147, { 0x1C,0x1C,0x1C,0x1C,0x8A,0x09,0x2D,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0x0FCA25D3, { 0x1C,0x1C,0x1C,0x1C,0xCC,0x1C,0x2D,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0x64FC12C7, { 0x1C,0x1C,0x1C,0x1C,0xCC,0x1C,0xF8,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0x64FC12C7, { 0x1C,0x1C,0x1C,0x1C,0xCC,0x1C,0xF8,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0x64FC12C7, { 0x1C,0x1C,0x1C,0x1C,0xCC,0x1C,0xF8,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0x9A9CD64B, { 0x1C,0x1C,0x1C,0x1C,0xBC,0x1C,0xF8,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0x9BC01927, { 0x1C,0x1C,0x1C,0x1C,0xBC,0x1C,0x3E,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0x4D698313, { 0x1C,0x1C,0x1C,0x1C,0x0C,0x1C,0x3E,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0xAAA84CE7, { 0x1C,0x1C,0x1C,0x1C,0x0C,0x1C,0xAD,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0xAAA84CE7, { 0x1C,0x1C,0x1C,0x1C,0x0C,0x1C,0xAD,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0xC6E2764B, { 0x1C,0x1C,0x1C,0x1C,0xC2,0x1C,0xAD,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x1C,0x2D,0xAB } },
+    { 0x06D633C1, { 0x1C,0x1C,0x1C,0x1C,0x6A,0x1C,0xB5,0x1C,0x1C,0x1C,0x1C,0x1C,0x75,0x1C,0x2D,0xAB } },
+    { 0x06D633C1, { 0x1C,0x1C,0x1C,0x1C,0x6A,0x1C,0xB5,0x1C,0x1C,0x1C,0x1C,0x1C,0x75,0x1C,0x2D,0xAB } },
+    { 0x6E3E77E1, { 0x1C,0x1C,0x1C,0x1C,0x6A,0x1C,0x66,0x1C,0x1C,0x1C,0x1C,0x1C,0x8A,0x1C,0x2D,0xAB } },
+    { 0x4ABBF465, { 0x1C,0x1C,0x1C,0x1C,0x7D,0x1C,0x66,0x1C,0x1C,0x1C,0x1C,0x1C,0x8A,0x1C,0x2D,0xAB } },
+    { 0x264182ED, { 0x1C,0x1C,0x1C,0x1C,0x29,0x1C,0x32,0x1C,0x1C,0x1C,0x1C,0x1C,0x8A,0x1C,0x2D,0xAB } },
+    { 0xDAE6F957, { 0x1C,0x1C,0x1C,0x1C,0x29,0x1C,0x32,0x1C,0x1C,0x75,0x1C,0x1C,0x8A,0x1C,0x2D,0xAB } },
+    { 0xE1477B8F, { 0x1C,0x1C,0x1C,0x1C,0x15,0x1C,0x98,0x1C,0x1C,0x75,0x1C,0x1C,0x8A,0x1C,0x2D,0xAB } },
+    { 0x447CA1CB, { 0x1C,0x1C,0x1C,0x1C,0x15,0x1C,0x51,0x1C,0x1C,0x75,0x1C,0x1C,0x8A,0x1C,0x2D,0xAB } },
+    { 0x0F5EEFD7, { 0x1C,0x1C,0x1C,0x1C,0x4E,0x1C,0x51,0x1C,0x1C,0x75,0x1C,0x1C,0x8A,0x1C,0x2D,0xAB } },
+    { 0xBE61404F, { 0x1C,0x1C,0x1C,0x1C,0x75,0x1C,0x06,0x1C,0x1C,0x75,0x1C,0x1C,0x8A,0x1C,0x2D,0xAB } },
+    { 0x56EC4983, { 0x1C,0x1C,0x1C,0x1C,0x75,0x1C,0x06,0x1C,0x1C,0x75,0x1C,0x1C,0x8A,0x1C,0xF8,0xAB } },
+    { 0x144FA86F, { 0x1C,0x1C,0x1C,0x1C,0x8A,0x1C,0x7D,0x1C,0x1C,0x75,0x1C,0x1C,0x75,0x1C,0xF8,0xAB } },
+    { 0x144FA86F, { 0x1C,0x1C,0x1C,0x1C,0x8A,0x1C,0x7D,0x1C,0x1C,0x75,0x1C,0x1C,0x75,0x1C,0xF8,0xAB } },
+    { 0xB7891643, { 0x1C,0x1C,0x1C,0x1C,0x75,0x1C,0x1C,0xAE,0x1C,0x75,0x1C,0x1C,0x75,0x1C,0x3E,0xAB } },
+    { 0x78895A9B, { 0x1C,0x1C,0x1C,0x1C,0x4B,0x1C,0x1C,0xAE,0x1C,0x75,0x1C,0x1C,0x4B,0x1C,0x3E,0xAB } },
+    { 0xF08FAFD7, { 0x1C,0x1C,0x1C,0x1C,0x4B,0x1C,0x1C,0x14,0x1C,0x75,0x1C,0x1C,0x4B,0x1C,0x3E,0xAB } },
+    { 0x749BAC23, { 0x1C,0x1C,0x1C,0x1C,0x18,0x1C,0x1C,0xA8,0x1C,0x75,0x1C,0x1C,0x4B,0x1C,0xAD,0xAB } },
+    { 0x40F41F53, { 0x1C,0x1C,0x1C,0x1C,0x5E,0x1C,0x1C,0xA8,0x1C,0x75,0x1C,0x1C,0x18,0x1C,0xAD,0xAB } },
+    { 0x40F41F53, { 0x1C,0x1C,0x1C,0x1C,0x5E,0x1C,0x1C,0xA8,0x1C,0x75,0x1C,0x1C,0x18,0x1C,0xAD,0xAB } },
+    { 0xA5E704AF, { 0x1C,0x1C,0x1C,0x1C,0x79,0x1C,0x1C,0x0F,0x1C,0x8A,0x1C,0x1C,0x5E,0x1C,0xB5,0xAB } },
+    { 0x36FDBCCF, { 0x1C,0x1C,0x1C,0x1C,0x8D,0x1C,0x1C,0x31,0x1C,0x8A,0x1C,0x1C,0x5E,0x1C,0xB5,0xAB } },
+    { 0x36FDBCCF, { 0x1C,0x1C,0x1C,0x1C,0x8D,0x1C,0x1C,0x31,0x1C,0x8A,0x1C,0x1C,0x5E,0x1C,0xB5,0xAB } },
+    { 0x24ABB16B, { 0x1C,0x1C,0x1C,0x1C,0x06,0x1C,0x1C,0x31,0x1C,0x8A,0x1C,0x1C,0x79,0x1C,0x66,0xAB } },
+    { 0xF5BD63FB, { 0x1C,0x1C,0x1C,0x8A,0x09,0x1C,0x1C,0x92,0x1C,0x8A,0x1C,0x1C,0x8D,0x1C,0x32,0xAB } },
+    { 0x22E3D957, { 0x1C,0x1C,0x1C,0x8A,0x09,0x1C,0x1C,0x92,0x1C,0x75,0x1C,0x1C,0x8D,0x1C,0x32,0xAB } },
+    { 0xD66BBF71, { 0xB5,0x1C,0x1C,0xCC,0x1C,0x1C,0x1C,0x2F,0x1C,0x75,0x1C,0x1C,0x06,0x1C,0x32,0xAB } },
+    { 0x6D21D92D, { 0xB5,0x1C,0x1C,0xBC,0x1C,0x1C,0x1C,0xB5,0x1C,0x75,0x1C,0x1C,0x06,0x1C,0x98,0xAB } },
+  } },
+  { 0xA9BD7D9B, {   // Christmas
+    { 0x3325DE1A, { 0xE9,0x31,0xBF,0x88,0x61,0x74,0x5D,0x41,0xBF,0x2A,0x0E,0x92,0x66,0xD4,0x4D,0x2E } },
+    { 0x369E579D, { 0xAE,0xE2,0xB6,0xDB,0xF9,0xB0,0x3A,0xDF,0x8F,0xC6,0xE1,0x3D,0xB6,0xE5,0x61,0x42 } },
+    { 0x0192209B, { 0x80,0xB3,0xB7,0xE7,0xBD,0xDF,0x85,0xCB,0x8C,0x31,0x8B,0xFC,0x7D,0xC3,0xDE,0x63 } },
+    { 0x1CC8ABEB, { 0xF0,0x9E,0x07,0x00,0x1A,0x05,0x1D,0xA5,0x61,0x23,0x55,0x5C,0x1D,0xA3,0x47,0xA6 } },
+    { 0x41D2178D, { 0xE0,0x0D,0x77,0x50,0xE7,0xED,0xF7,0x63,0xBC,0x43,0x22,0x23,0xFA,0xA0,0xDC,0x6D } },
+    { 0xEE2CA34C, { 0xD1,0xF6,0x57,0xA2,0x58,0xD6,0x15,0xC0,0x9B,0xC2,0x8E,0x5A,0x00,0xC0,0x64,0x55 } },
+    { 0x2BE85706, { 0x91,0xB7,0x30,0x97,0x00,0xB0,0x3B,0x79,0xCE,0x4E,0x5D,0x76,0x53,0x46,0x40,0xF9 } },
+    { 0xBF2F8414, { 0xF8,0x67,0xAB,0x42,0xCB,0xA7,0x44,0x9D,0xF8,0x30,0x57,0x67,0xD8,0xD5,0x7E,0x7C } },
+    { 0xCFE106C8, { 0xEF,0xE9,0x3D,0xB4,0xE8,0x3C,0xC9,0x0E,0x8F,0xF3,0xB6,0xB7,0x84,0xB6,0xF0,0xC9 } },
+    { 0x1C7BCEF4, { 0x41,0xBF,0x2A,0x0E,0x92,0x66,0xD4,0x4D,0xEA,0xE3,0x56,0x6F,0xA8,0xD9,0xD9,0x9B } },
+    { 0x79F492D5, { 0xF7,0x1E,0x08,0xF0,0x5B,0xC6,0x02,0x6D,0x10,0x30,0x44,0x5F,0xF9,0xA2,0xEE,0x50 } },
+    { 0xBACAC97D, { 0xA3,0xE6,0xE2,0x23,0x15,0x0D,0x06,0xD1,0xB0,0x5D,0xD6,0x63,0xBB,0x85,0x8C,0x2C } },
+    { 0x8178C3DB, { 0x05,0xBA,0x28,0xDE,0x03,0x91,0x57,0xA5,0x86,0x1B,0xE2,0xA2,0x0E,0x0A,0xE4,0x30 } },
+    { 0x10E3B141, { 0xB7,0x73,0x5F,0xAE,0xE2,0xB6,0xDB,0xF9,0xB0,0x3A,0xDF,0x8F,0xC6,0xE1,0x3D,0x4F } },
+    { 0x9F2FDBF3, { 0x13,0x83,0x21,0x80,0xB3,0xB7,0xE7,0xBD,0xDF,0x85,0xCB,0x8C,0x31,0x8B,0xFC,0xED } },
+    { 0x3E4FAA83, { 0x00,0x3E,0x26,0xF0,0x9E,0x07,0x00,0x1A,0x05,0x1D,0xA5,0x61,0x23,0x55,0x5C,0x1C } },
+    { 0xDE368FDE, { 0x44,0x37,0xB7,0xE0,0x0D,0x77,0x50,0xE7,0xED,0xF7,0x63,0xBC,0x43,0x22,0x23,0x96 } },
+    { 0xA39D8272, { 0xB7,0x7C,0x74,0xD1,0xF6,0x57,0xA2,0x58,0xD6,0x15,0xC0,0x9B,0xC2,0x8E,0x5A,0xDA } },
+    { 0xE4C9ABC6, { 0x37,0xB5,0xE7,0x91,0xB7,0x30,0x97,0x00,0xB0,0x3B,0x79,0xCE,0x4E,0x5D,0x76,0x92 } },
+    { 0xF4060BDA, { 0xDE,0x9B,0xB3,0xF8,0x67,0xAB,0x42,0xCB,0xA7,0x44,0x9D,0xF8,0x30,0x57,0x67,0x1C } },
+    { 0x551B9355, { 0x47,0x9E,0x0E,0xEF,0xE9,0x3D,0xB4,0xE8,0x3C,0xC9,0x0E,0x8F,0xF3,0xB6,0xB7,0xEC } },
+    { 0x5F25A8C5, { 0x61,0x74,0x5D,0x41,0xBF,0x2A,0x0E,0x92,0x66,0xD4,0x4D,0xEA,0xE3,0x56,0x6F,0x7A } },
+    { 0x2B3C537E, { 0xF9,0xB0,0x3A,0xDF,0x8F,0xC6,0xE1,0x3D,0xB6,0xE5,0x61,0x8F,0x77,0x8D,0xB9,0xF0 } },
+    { 0xA3B4C381, { 0x40,0x7A,0xD6,0xA3,0xE6,0xE2,0x23,0x15,0x0D,0x06,0xD1,0xB0,0x5D,0xD6,0x63,0x6A } },
+    { 0x4D43BF08, { 0x54,0x2A,0x74,0x05,0xBA,0x28,0xDE,0x03,0x91,0x57,0xA5,0x86,0x1B,0xE2,0xA2,0xED } },
+    { 0x18614793, { 0xE7,0xED,0xF7,0x63,0xBC,0x43,0x22,0x23,0xFA,0xA0,0xDC,0xE8,0x68,0x64,0x9C,0x9F } },
+    { 0xB741E7C2, { 0xD9,0x78,0x55,0x13,0x83,0x21,0x80,0xB3,0xB7,0xE7,0xBD,0xDF,0x85,0xCB,0x8C,0x9A } },
+    { 0x4667CA42, { 0x49,0xF2,0x39,0x00,0x3E,0x26,0xF0,0x9E,0x07,0x00,0x1A,0x05,0x1D,0xA5,0x61,0xFF } },
+    { 0x4F0D546D, { 0xCB,0xA7,0x44,0x9D,0xF8,0x30,0x57,0x67,0xD8,0xD5,0x7E,0x04,0xC1,0x48,0x3C,0x27 } },
+    { 0x5ADB408D, { 0xE4,0x8B,0xE2,0xB7,0x7C,0x74,0xD1,0xF6,0x57,0xA2,0x58,0xD6,0x15,0xC0,0x9B,0x18 } },
+    { 0x25BB489F, { 0x68,0x21,0x04,0x37,0xB5,0xE7,0x91,0xB7,0x30,0x97,0x00,0xB0,0x3B,0x79,0xCE,0xF3 } },
+    { 0x274E6EDF, { 0x5B,0xC6,0x02,0x6D,0x10,0x30,0x44,0x5F,0xF9,0xA2,0xEE,0xC1,0x30,0xBC,0xEE,0x13 } },
+    { 0x69670833, { 0x5C,0x1D,0xA3,0x47,0x9E,0x0E,0xEF,0xE9,0x3D,0xB4,0xE8,0x3C,0xC9,0x0E,0x8F,0x3C } },
+    { 0x2AA999B7, { 0x31,0xBF,0x88,0x61,0x74,0x5D,0x41,0xBF,0x2A,0x0E,0x92,0x66,0xD4,0x4D,0xEA,0xB7 } },
+    { 0xC819CCDA, { 0xE2,0xB6,0xDB,0xF9,0xB0,0x3A,0xDF,0x8F,0xC6,0xE1,0x3D,0xB6,0xE5,0x61,0x8F,0x72 } },
+    { 0x41A110C3, { 0x76,0x53,0x46,0x40,0x7A,0xD6,0xA3,0xE6,0xE2,0x23,0x15,0x0D,0x06,0xD1,0xB0,0xF0 } },
+    { 0xC84F70EB, { 0x75,0xE3,0x1A,0x54,0x2A,0x74,0x05,0xBA,0x28,0xDE,0x03,0x91,0x57,0xA5,0x86,0xE3 } },
+    { 0x7DAF0663, { 0x0D,0x77,0x50,0xE7,0xED,0xF7,0x63,0xBC,0x43,0x22,0x23,0xFA,0xA0,0xDC,0xE8,0x97 } },
+    { 0x980C5854, { 0x6F,0xA8,0xD9,0xD9,0x78,0x55,0x13,0x83,0x21,0x80,0xB3,0xB7,0xE7,0xBD,0xDF,0xDE } },
+    { 0x0DA9740D, { 0xB9,0x3D,0x88,0x49,0xF2,0x39,0x00,0x3E,0x26,0xF0,0x9E,0x07,0x00,0x1A,0x05,0x2B } },
+    { 0xEB3CA257, { 0x67,0xAB,0x42,0xCB,0xA7,0x44,0x9D,0xF8,0x30,0x57,0x67,0xD8,0xD5,0x7E,0x04,0x82 } },
+    { 0x37D366EE, { 0xE9,0x3D,0xB4,0xE8,0x3C,0xC9,0x0E,0x8F,0xF3,0xB6,0xB7,0x84,0xB6,0xF0,0xE4,0x70 } },
+    { 0xC3073506, { 0x9C,0x4C,0x47,0x68,0x21,0x04,0x37,0xB5,0xE7,0x91,0xB7,0x30,0x97,0x00,0xB0,0x8D } },
+    { 0x039A791F, { 0x1E,0x08,0xF0,0x5B,0xC6,0x02,0x6D,0x10,0x30,0x44,0x5F,0xF9,0xA2,0xEE,0xC1,0x24 } },
+    { 0x5F79D9C8, { 0xE6,0xE2,0x23,0x15,0x0D,0x06,0xD1,0xB0,0x5D,0xD6,0x63,0xBB,0x85,0x8C,0x92,0xCD } },
+    { 0x217B3DEE, { 0x3C,0xA1,0xE9,0x31,0xBF,0x88,0x61,0x74,0x5D,0x41,0xBF,0x2A,0x0E,0x92,0x66,0x41 } },
+    { 0x9C3B12A8, { 0x73,0x5F,0xAE,0xE2,0xB6,0xDB,0xF9,0xB0,0x3A,0xDF,0x8F,0xC6,0xE1,0x3D,0xB6,0x8F } },
+    { 0x92BEDCE2, { 0x83,0x21,0x80,0xB3,0xB7,0xE7,0xBD,0xDF,0x85,0xCB,0x8C,0x31,0x8B,0xFC,0x7D,0xED } },
+    { 0xFB9B422E, { 0xEE,0x97,0xBA,0x75,0xE3,0x1A,0x54,0x2A,0x74,0x05,0xBA,0x28,0xDE,0x03,0x91,0x15 } },
+    { 0x4D2C2B60, { 0x37,0xB7,0xE0,0x0D,0x77,0x50,0xE7,0xED,0xF7,0x63,0xBC,0x43,0x22,0x23,0xFA,0x7E } },
+    { 0x55D3D2AD, { 0x7C,0x74,0xD1,0xF6,0x57,0xA2,0x58,0xD6,0x15,0xC0,0x9B,0xC2,0x8E,0x5A,0x00,0x47 } },
+    { 0x319893A9, { 0x8F,0x77,0x8D,0xB9,0x3D,0x88,0x49,0xF2,0x39,0x00,0x3E,0x26,0xF0,0x9E,0x07,0x53 } },
+    { 0xB0FED259, { 0x9B,0xB3,0xF8,0x67,0xAB,0x42,0xCB,0xA7,0x44,0x9D,0xF8,0x30,0x57,0x67,0xD8,0x22 } },
+    { 0x3B43C689, { 0x9E,0x0E,0xEF,0xE9,0x3D,0xB4,0xE8,0x3C,0xC9,0x0E,0x8F,0xF3,0xB6,0xB7,0x84,0x2E } },
+    { 0xDB4B62B8, { 0xE8,0x68,0x64,0x9C,0x4C,0x47,0x68,0x21,0x04,0x37,0xB5,0xE7,0x91,0xB7,0x30,0xC2 } },
+    { 0x05B7770C, { 0xF3,0x57,0xF7,0x1E,0x08,0xF0,0x5B,0xC6,0x02,0x6D,0x10,0x30,0x44,0x5F,0xF9,0x9D } },
+    { 0xD1D54567, { 0x7A,0xD6,0xA3,0xE6,0xE2,0x23,0x15,0x0D,0x06,0xD1,0xB0,0x5D,0xD6,0x63,0xBB,0xC8 } },
+    { 0x199F2959, { 0x04,0xC1,0x48,0x3C,0xA1,0xE9,0x31,0xBF,0x88,0x61,0x74,0x5D,0x41,0xBF,0x2A,0x52 } },
+    { 0x541720D8, { 0xE4,0x74,0xB7,0x73,0x5F,0xAE,0xE2,0xB6,0xDB,0xF9,0xB0,0x3A,0xDF,0x8F,0xC6,0x07 } },
+    { 0x6B7122F4, { 0x78,0x55,0x13,0x83,0x21,0x80,0xB3,0xB7,0xE7,0xBD,0xDF,0x85,0xCB,0x8C,0x31,0xFD } },
+    { 0x1247F1D2, { 0xF2,0x39,0x00,0x3E,0x26,0xF0,0x9E,0x07,0x00,0x1A,0x05,0x1D,0xA5,0x61,0x23,0x95 } },
+    { 0x6B555E1E, { 0x92,0xAE,0x44,0x37,0xB7,0xE0,0x0D,0x77,0x50,0xE7,0xED,0xF7,0x63,0xBC,0x43,0x2A } },
+    { 0xE7EAA76A, { 0x8B,0xE2,0xB7,0x7C,0x74,0xD1,0xF6,0x57,0xA2,0x58,0xD6,0x15,0xC0,0x9B,0xC2,0x6B } },
+    { 0x4821B29A, { 0x21,0x04,0x37,0xB5,0xE7,0x91,0xB7,0x30,0x97,0x00,0xB0,0x3B,0x79,0xCE,0x4E,0x3C } },
+  } },
+};
+#endif
+
+#endif //GOLDENFRAMES_RECORDED_H
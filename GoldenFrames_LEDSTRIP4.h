@@ -0,0 +1,1007 @@
+#ifndef GOLDENFRAMES_RECORDED_H
+#define GOLDENFRAMES_RECORDED_H
+
+// Output of GoldenFrames_Record() ('g' on the serial console) of a trusted build.
+// Only valid for the strip configuration it was recorded with, selected by GoldenFrames_Data.h.
+
+#define GOLDEN_DATA_NUM_LEDS      7
+#define GOLDEN_DATA_FRAMES        64
+#define GOLDEN_DATA_NUM_PROGRAMS  15
+
+#if GOLDEN_DATA_NUM_PROGRAMS > 0
+static const GoldenProgramData c_GoldenData[GOLDEN_DATA_NUM_PROGRAMS] PROGMEM =
+{
+  { 0x56FBEC94, {   // Solid
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+  } },
+  { 0x94958952, {   // Solid2
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BCB6FE, { 0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+  } },
+  { 0x95958AE5, {   // Solid3
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE95C9940, { 0x2D,0xD7,0x57,0x2D,0xD7,0x57,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+  } },
+  { 0x3264E27A, {   // Solid1a
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDB041D09, { 0xBA,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+  } },
+  { 0x1A66FB49, {   // Solid2a
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0912C4A3, { 0xBA,0x2D,0xD7,0x2D,0xD7,0x2D,0xD7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+  } },
+  { 0xFE690DCC, {   // Solid3a
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE19EDBD9, { 0xBA,0x2D,0xD7,0x57,0x2D,0xD7,0x57,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+  } },
+  { 0x025DDB25, {   // Solid6a
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB600389C, { 0xBA,0x2D,0xDF,0xB8,0x42,0x6F,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+  } },
+  { 0xF3DCE5DD, {   // Chase
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCEBC8A9F, { 0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+  } },
+  { 0xD3BDF73D, {   // Chase2
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x19F57985, { 0xBA,0x2D,0xBA,0xBA,0x2D,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+  } },
+  { 0xD2BDF5AA, {   // Chase3
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF0A0C0, { 0xBA,0x2D,0xBA,0x2D,0xBA,0x2D,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+  } },
+  { 0x014231A6, {   // Breathe
+    { 0x376CCB11, { 0x06,0x06,0x06,0x06,0x06,0x06,0x06,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x40D05A9D, { 0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xADA0FF28, { 0x09,0x09,0x09,0x09,0x09,0x09,0x09,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xC37B1336, { 0x3E,0x3E,0x3E,0x3E,0x3E,0x3E,0x3E,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xF1951D6F, { 0x45,0x45,0x45,0x45,0x45,0x45,0x45,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xA4A6D33C, { 0xE1,0xE1,0xE1,0xE1,0xE1,0xE1,0xE1,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x8D88BF52, { 0x49,0x49,0x49,0x49,0x49,0x49,0x49,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BB4F6C, { 0x56,0x56,0x56,0x56,0x56,0x56,0x56,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BB4F6C, { 0x56,0x56,0x56,0x56,0x56,0x56,0x56,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xA3CC0D50, { 0xB1,0xB1,0xB1,0xB1,0xB1,0xB1,0xB1,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB21C937A, { 0x38,0x38,0x38,0x38,0x38,0x38,0x38,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x10F75C4D, { 0x14,0x14,0x14,0x14,0x14,0x14,0x14,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x6014D072, { 0xC6,0xC6,0xC6,0xC6,0xC6,0xC6,0xC6,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xC489A142, { 0x34,0x34,0x34,0x34,0x34,0x34,0x34,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x80470254, { 0xAF,0xAF,0xAF,0xAF,0xAF,0xAF,0xAF,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x1B689D24, { 0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xBDB8BCBD, { 0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xADFA1F4F, { 0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x44503A94, { 0x93,0x93,0x93,0x93,0x93,0x93,0x93,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xF03ECEA9, { 0x1B,0x1B,0x1B,0x1B,0x1B,0x1B,0x1B,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x6120170C, { 0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x2B81F47D, { 0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xBB0F5C63, { 0xC3,0xC3,0xC3,0xC3,0xC3,0xC3,0xC3,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x007BFBC9, { 0xFA,0xFA,0xFA,0xFA,0xFA,0xFA,0xFA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x8826D4EB, { 0x60,0x60,0x60,0x60,0x60,0x60,0x60,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x77448FED, { 0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xD9,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x8826D4EB, { 0x60,0x60,0x60,0x60,0x60,0x60,0x60,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x007BFBC9, { 0xFA,0xFA,0xFA,0xFA,0xFA,0xFA,0xFA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xEE647EDC, { 0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x2B81F47D, { 0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x3801FBF5, { 0x49,0x49,0x49,0x49,0x49,0x49,0x49,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xD6E755A2, { 0x87,0x87,0x87,0x87,0x87,0x87,0x87,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x516E87FF, { 0xDD,0xDD,0xDD,0xDD,0xDD,0xDD,0xDD,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xADFA1F4F, { 0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x59522B01, { 0x93,0x93,0x93,0x93,0x93,0x93,0x93,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x363FA22F, { 0xB5,0xB5,0xB5,0xB5,0xB5,0xB5,0xB5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x40D05A9D, { 0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xCD,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x6C2ECFC6, { 0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xFD,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xC37B1336, { 0x3E,0x3E,0x3E,0x3E,0x3E,0x3E,0x3E,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xF1951D6F, { 0x45,0x45,0x45,0x45,0x45,0x45,0x45,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xA4A6D33C, { 0xE1,0xE1,0xE1,0xE1,0xE1,0xE1,0xE1,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x8D88BF52, { 0x49,0x49,0x49,0x49,0x49,0x49,0x49,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BB4F6C, { 0x56,0x56,0x56,0x56,0x56,0x56,0x56,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x09BB4F6C, { 0x56,0x56,0x56,0x56,0x56,0x56,0x56,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xA3CC0D50, { 0xB1,0xB1,0xB1,0xB1,0xB1,0xB1,0xB1,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB21C937A, { 0x38,0x38,0x38,0x38,0x38,0x38,0x38,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x10F75C4D, { 0x14,0x14,0x14,0x14,0x14,0x14,0x14,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x6014D072, { 0xC6,0xC6,0xC6,0xC6,0xC6,0xC6,0xC6,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xC489A142, { 0x34,0x34,0x34,0x34,0x34,0x34,0x34,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x80470254, { 0xAF,0xAF,0xAF,0xAF,0xAF,0xAF,0xAF,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x363FA22F, { 0xB5,0xB5,0xB5,0xB5,0xB5,0xB5,0xB5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x520A2976, { 0x12,0x12,0x12,0x12,0x12,0x12,0x12,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xADFA1F4F, { 0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xE5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x44503A94, { 0x93,0x93,0x93,0x93,0x93,0x93,0x93,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xF03ECEA9, { 0x1B,0x1B,0x1B,0x1B,0x1B,0x1B,0x1B,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x6120170C, { 0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x2B81F47D, { 0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xBB0F5C63, { 0xC3,0xC3,0xC3,0xC3,0xC3,0xC3,0xC3,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x007BFBC9, { 0xFA,0xFA,0xFA,0xFA,0xFA,0xFA,0xFA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x8826D4EB, { 0x60,0x60,0x60,0x60,0x60,0x60,0x60,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x86040546, { 0x92,0x92,0x92,0x92,0x92,0x92,0x92,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x8826D4EB, { 0x60,0x60,0x60,0x60,0x60,0x60,0x60,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+  } },
+  { 0x0BCB5288, {   // Strobe
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x214171CF, { 0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xBA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFCD6FFE8, { 0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+  } },
+  { 0xE9456513, {   // ColorWipe
+    { 0xEC40A4F0, { 0xBA,0xF9,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x38A9F209, { 0xBA,0xDA,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xD596E383, { 0xBA,0xFF,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xF9783A74, { 0xBA,0xC0,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x525B65AF, { 0xBA,0x1E,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB410A7DD, { 0xBA,0xF8,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xF0FF26A8, { 0xBA,0xD6,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x29E9E19D, { 0xBA,0xE0,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x420147AB, { 0xBA,0x12,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x704C0BB8, { 0xBA,0xE7,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x53462D97, { 0xBA,0x53,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x15F708A3, { 0xBA,0x7C,0x2D,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x3FA58C9A, { 0xBA,0xD7,0x99,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCD994759, { 0xBA,0xD7,0xE6,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x47DC93A4, { 0xBA,0xD7,0x32,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFD31032A, { 0xBA,0xD7,0xA8,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xAD6EE6BF, { 0xBA,0xD7,0x6E,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x82D8EE68, { 0xBA,0xD7,0x34,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7BF76982, { 0xBA,0xD7,0xCE,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xEC666EAF, { 0xBA,0xD7,0xC6,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x53D87D38, { 0xBA,0xD7,0xEC,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0125C6B2, { 0xBA,0xD7,0x87,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB1AD5B77, { 0xBA,0xD7,0x23,0x2D,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x633C855A, { 0xBA,0xD7,0xD7,0x24,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB350A620, { 0xBA,0xD7,0xD7,0x55,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xC20F0A97, { 0xBA,0xD7,0xD7,0x20,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCD4D96DA, { 0xBA,0xD7,0xD7,0x58,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xF16E072B, { 0xBA,0xD7,0xD7,0xDA,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFC180FF9, { 0xBA,0xD7,0xD7,0x95,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x408366D6, { 0xBA,0xD7,0xD7,0xDA,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB61E055D, { 0xBA,0xD7,0xD7,0x61,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x354C01F7, { 0xBA,0xD7,0xD7,0xEE,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xEE26E3DE, { 0xBA,0xD7,0xD7,0xB1,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x507B4839, { 0xBA,0xD7,0xD7,0xAF,0x2D,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x1048B985, { 0xBA,0xD7,0xD7,0xD7,0x0E,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x9FCE89B4, { 0xBA,0xD7,0xD7,0xD7,0xE6,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x474EA325, { 0xBA,0xD7,0xD7,0xD7,0xE7,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xC7019352, { 0xBA,0xD7,0xD7,0xD7,0xB5,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x9C329264, { 0xBA,0xD7,0xD7,0xD7,0xF9,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7981EAD7, { 0xBA,0xD7,0xD7,0xD7,0x39,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x855B445E, { 0xBA,0xD7,0xD7,0xD7,0x88,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xF6F06588, { 0xBA,0xD7,0xD7,0xD7,0x6A,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE155F7DF, { 0xBA,0xD7,0xD7,0xD7,0x56,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x29B6A932, { 0xBA,0xD7,0xD7,0xD7,0xC6,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xAF23C9A6, { 0xBA,0xD7,0xD7,0xD7,0x2B,0x2D,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x92029E39, { 0xBA,0xD7,0xD7,0xD7,0xD7,0x13,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xD69013E4, { 0xBA,0xD7,0xD7,0xD7,0xD7,0x29,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x6DB6082A, { 0xBA,0xD7,0xD7,0xD7,0xD7,0x2E,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xEB3AA9A7, { 0xBA,0xD7,0xD7,0xD7,0xD7,0xD8,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x10BF9E18, { 0xBA,0xD7,0xD7,0xD7,0xD7,0xD1,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xAAA00933, { 0xBA,0xD7,0xD7,0xD7,0xD7,0xC9,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x51391FFD, { 0xBA,0xD7,0xD7,0xD7,0xD7,0xF9,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x01716B14, { 0xBA,0xD7,0xD7,0xD7,0xD7,0x07,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x9510B2DD, { 0xBA,0xD7,0xD7,0xD7,0xD7,0xB2,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE33D08EF, { 0xBA,0xD7,0xD7,0xD7,0xD7,0xCD,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xEA8A48C2, { 0xBA,0xD7,0xD7,0xD7,0xD7,0xE2,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x2A1C0EBB, { 0xBA,0xD7,0xD7,0xD7,0xD7,0xD7,0xBE,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFB981D6D, { 0xBA,0xD7,0xD7,0xD7,0xD7,0xD7,0xEC,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x86C712C6, { 0xBA,0xD7,0xD7,0xD7,0xD7,0xD7,0x9B,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xC32B9511, { 0xBA,0xD7,0xD7,0xD7,0xD7,0xD7,0x7A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x1D2A21F4, { 0xBA,0xD7,0xD7,0xD7,0xD7,0xD7,0x18,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x4580F446, { 0xBA,0xD7,0xD7,0xD7,0xD7,0xD7,0x37,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x3E893393, { 0xBA,0xD7,0xD7,0xD7,0xD7,0xD7,0xEB,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x414B1EE0, { 0xBA,0xD7,0xD7,0xD7,0xD7,0xD7,0x5B,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+  } },
+  { 0x5C15BE49, {   // Rainbow
+    { 0x6C492139, { 0x38,0x57,0xEF,0xC9,0x5C,0xED,0x96,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB943ED4E, { 0xED,0xBE,0xA0,0xD1,0xA8,0x09,0x24,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x07EBF0F5, { 0xE9,0x3F,0xE6,0x11,0xA0,0x17,0x8B,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xA215AE59, { 0x75,0x51,0xC9,0x9E,0x56,0xA1,0x81,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x2B0DE0FD, { 0x8E,0xA4,0x2C,0xD4,0xAF,0x19,0x81,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x5EBDBAC0, { 0x5C,0xED,0x96,0x35,0xD0,0xE2,0x12,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB04AE4F1, { 0xA8,0x09,0x24,0x80,0x0D,0xC0,0x19,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDEBB226D, { 0xA0,0x17,0x8B,0x39,0xD2,0xD9,0xA5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xF445FB58, { 0x56,0xA1,0x81,0x77,0xD9,0xC7,0xAA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xA575F485, { 0xAF,0x19,0x81,0x61,0x1C,0x9D,0x0D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x4346A7AF, { 0xD0,0xE2,0x12,0xFD,0x7F,0x80,0x13,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x413737DF, { 0x0D,0xC0,0x19,0x87,0xB5,0x6D,0x35,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x004101CA, { 0xD2,0xD9,0xA5,0xA4,0x88,0x0E,0x2E,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x167A3C72, { 0xD9,0xC7,0xAA,0xDE,0x6A,0x81,0x00,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x14AC7F79, { 0x1C,0x9D,0x0D,0xDE,0x86,0x3D,0x7D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFA42D916, { 0x7F,0x80,0x13,0x20,0x6C,0xED,0x80,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x1C95C7E2, { 0xB5,0x6D,0x35,0xEC,0x25,0xF8,0xE8,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x3C2E7F75, { 0xDE,0x6A,0x81,0x00,0x4F,0x6B,0x82,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x2F7FD1A7, { 0xDE,0x86,0x3D,0x7D,0xDA,0x3C,0xC7,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xFE59E168, { 0x20,0x6C,0xED,0x80,0x24,0xFE,0xBB,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x5CC444BD, { 0xEC,0x25,0xF8,0xE8,0x19,0x83,0x52,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x3AD0B62A, { 0x4F,0xA1,0xF2,0xC8,0xF8,0xE9,0xA1,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x244CC1B1, { 0x4F,0x6B,0x82,0xD6,0x72,0x64,0xBD,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xC9BEC985, { 0xDA,0x3C,0xC7,0xFC,0xB9,0x6F,0xC0,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x79D98C39, { 0x24,0xFE,0xBB,0x08,0x1F,0x7D,0xD1,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xD0376731, { 0x19,0x83,0x52,0xB7,0x4B,0x7D,0xDE,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x75478CB0, { 0xF8,0xE9,0xA1,0xF7,0x29,0x1A,0x5B,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xDC838B12, { 0x72,0x64,0xBD,0xCE,0x81,0x3E,0x02,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xD528FD66, { 0xB9,0x6F,0xC0,0x73,0x4F,0xD3,0x83,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xCBE25A6D, { 0x1F,0x7D,0xD1,0xE9,0xD5,0x5E,0x54,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x1B4F545D, { 0x4B,0x7D,0xDE,0xA4,0x06,0x90,0x30,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x4AB8A736, { 0x29,0x1A,0x5B,0x6C,0x00,0xE7,0xC3,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE4F086E7, { 0x81,0x3E,0x02,0xFF,0x95,0x58,0x18,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x3707EA7E, { 0x4F,0xD3,0x83,0x59,0x89,0xFB,0x65,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x05DF7429, { 0xA4,0x06,0x90,0x30,0x9A,0x82,0x82,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB2D19384, { 0x6C,0x00,0xE7,0xC3,0x45,0xE6,0x97,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x67043FD0, { 0xFF,0x95,0x58,0x18,0x02,0xAC,0xEF,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x94F34EA6, { 0x59,0x89,0xFB,0x65,0xB6,0x34,0xDA,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xF25133CF, { 0x5D,0x7C,0x3F,0xF3,0xBA,0x68,0x1C,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB349A6D9, { 0x9A,0x82,0x82,0x53,0x32,0x3D,0x96,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xA2FC2AA8, { 0x45,0xE6,0x97,0xB7,0xBF,0xDF,0x91,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE14C4EBB, { 0x02,0xAC,0xEF,0x31,0xA5,0x6F,0xDD,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xE9AB0C5F, { 0xB6,0x34,0xDA,0xCE,0x49,0x73,0xFD,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0B179A04, { 0xBA,0x68,0x1C,0xBD,0x4F,0x64,0xB6,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x1D0BA646, { 0x32,0x3D,0x96,0xBD,0xB5,0x4E,0x84,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x13F96D22, { 0xBF,0xDF,0x91,0x36,0xA7,0x0F,0xAE,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x1AFCEE59, { 0xA5,0x6F,0xDD,0xE1,0x91,0x32,0x73,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x4BED6F4A, { 0x49,0x73,0xFD,0xDD,0x4E,0x5C,0x06,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x5AEB1005, { 0x4F,0x64,0xB6,0xEA,0xE5,0xB4,0x6D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x1F738FCE, { 0xB5,0x4E,0x84,0x8C,0x6A,0x1B,0x58,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x518C2DED, { 0xA7,0x0F,0xAE,0x86,0x80,0x3B,0x0A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x3E3B6F35, { 0xDD,0x4E,0x5C,0x06,0xDE,0xC1,0xAF,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xAB69F3F0, { 0xEA,0xE5,0xB4,0x6D,0xD2,0xF4,0x23,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xA35599EE, { 0x8C,0x6A,0x1B,0x58,0x94,0x2B,0xB2,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x0247EB5A, { 0x86,0x80,0x3B,0x0A,0xDB,0xA0,0xC8,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x1B6BB1AD, { 0x75,0xF4,0x99,0x01,0xE0,0x87,0x3E,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xAC7FB509, { 0xDE,0xC1,0xAF,0x7B,0x02,0x42,0xAF,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x05319A67, { 0xD2,0xF4,0x23,0x58,0x22,0x50,0x51,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x526288E7, { 0x94,0x2B,0xB2,0x76,0xA2,0x39,0x97,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x132E18C9, { 0xDB,0xA0,0xC8,0x96,0x9E,0xD3,0x6A,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x3FA5EC16, { 0xE0,0x87,0x3E,0x86,0x1F,0x02,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x8C77934D, { 0x02,0x42,0xAF,0x38,0x57,0xEF,0xC9,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x47D9F9FE, { 0x22,0x50,0x51,0xED,0xBE,0xA0,0xD1,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x63F57002, { 0xA2,0x39,0x97,0xE9,0x3F,0xE6,0x11,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+  } },
+  { 0x993C73C5, {   // Gradient
+    { 0xB5DEEAA6, { 0x2D,0xB0,0x16,0x4B,0x4B,0x16,0xB0,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB5DEEAA6, { 0x2D,0xB0,0x16,0x4B,0x4B,0x16,0xB0,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB5DEEAA6, { 0x2D,0xB0,0x16,0x4B,0x4B,0x16,0xB0,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB5DEEAA6, { 0x2D,0xB0,0x16,0x4B,0x4B,0x16,0xB0,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB5DEEAA6, { 0x2D,0xB0,0x16,0x4B,0x4B,0x16,0xB0,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB5DEEAA6, { 0x2D,0xB0,0x16,0x4B,0x4B,0x16,0xB0,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB5DEEAA6, { 0x2D,0xB0,0x16,0x4B,0x4B,0x16,0xB0,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB5DEEAA6, { 0x2D,0xB0,0x16,0x4B,0x4B,0x16,0xB0,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB5DEEAA6, { 0x2D,0xB0,0x16,0x4B,0x4B,0x16,0xB0,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB5DEEAA6, { 0x2D,0xB0,0x16,0x4B,0x4B,0x16,0xB0,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x111B3F26, { 0xB0,0x16,0x4B,0x4B,0x16,0xB0,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x111B3F26, { 0xB0,0x16,0x4B,0x4B,0x16,0xB0,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x111B3F26, { 0xB0,0x16,0x4B,0x4B,0x16,0xB0,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x111B3F26, { 0xB0,0x16,0x4B,0x4B,0x16,0xB0,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x111B3F26, { 0xB0,0x16,0x4B,0x4B,0x16,0xB0,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x111B3F26, { 0xB0,0x16,0x4B,0x4B,0x16,0xB0,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x111B3F26, { 0xB0,0x16,0x4B,0x4B,0x16,0xB0,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x111B3F26, { 0xB0,0x16,0x4B,0x4B,0x16,0xB0,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x111B3F26, { 0xB0,0x16,0x4B,0x4B,0x16,0xB0,0x2D,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB01F3EDE, { 0x16,0x4B,0x4B,0x16,0xB0,0x2D,0xB0,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB01F3EDE, { 0x16,0x4B,0x4B,0x16,0xB0,0x2D,0xB0,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB01F3EDE, { 0x16,0x4B,0x4B,0x16,0xB0,0x2D,0xB0,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB01F3EDE, { 0x16,0x4B,0x4B,0x16,0xB0,0x2D,0xB0,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB01F3EDE, { 0x16,0x4B,0x4B,0x16,0xB0,0x2D,0xB0,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB01F3EDE, { 0x16,0x4B,0x4B,0x16,0xB0,0x2D,0xB0,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB01F3EDE, { 0x16,0x4B,0x4B,0x16,0xB0,0x2D,0xB0,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB01F3EDE, { 0x16,0x4B,0x4B,0x16,0xB0,0x2D,0xB0,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB01F3EDE, { 0x16,0x4B,0x4B,0x16,0xB0,0x2D,0xB0,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB01F3EDE, { 0x16,0x4B,0x4B,0x16,0xB0,0x2D,0xB0,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB0697818, { 0x4B,0x4B,0x16,0xB0,0x2D,0xB0,0x16,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB0697818, { 0x4B,0x4B,0x16,0xB0,0x2D,0xB0,0x16,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB0697818, { 0x4B,0x4B,0x16,0xB0,0x2D,0xB0,0x16,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB0697818, { 0x4B,0x4B,0x16,0xB0,0x2D,0xB0,0x16,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB0697818, { 0x4B,0x4B,0x16,0xB0,0x2D,0xB0,0x16,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB0697818, { 0x4B,0x4B,0x16,0xB0,0x2D,0xB0,0x16,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB0697818, { 0x4B,0x4B,0x16,0xB0,0x2D,0xB0,0x16,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB0697818, { 0x4B,0x4B,0x16,0xB0,0x2D,0xB0,0x16,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xB0697818, { 0x4B,0x4B,0x16,0xB0,0x2D,0xB0,0x16,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7E234008, { 0x4B,0x16,0xB0,0x2D,0xB0,0x16,0x4B,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7E234008, { 0x4B,0x16,0xB0,0x2D,0xB0,0x16,0x4B,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7E234008, { 0x4B,0x16,0xB0,0x2D,0xB0,0x16,0x4B,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7E234008, { 0x4B,0x16,0xB0,0x2D,0xB0,0x16,0x4B,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7E234008, { 0x4B,0x16,0xB0,0x2D,0xB0,0x16,0x4B,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7E234008, { 0x4B,0x16,0xB0,0x2D,0xB0,0x16,0x4B,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7E234008, { 0x4B,0x16,0xB0,0x2D,0xB0,0x16,0x4B,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7E234008, { 0x4B,0x16,0xB0,0x2D,0xB0,0x16,0x4B,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7E234008, { 0x4B,0x16,0xB0,0x2D,0xB0,0x16,0x4B,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x7E234008, { 0x4B,0x16,0xB0,0x2D,0xB0,0x16,0x4B,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x44269AF8, { 0x16,0xB0,0x2D,0xB0,0x16,0x4B,0x4B,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x44269AF8, { 0x16,0xB0,0x2D,0xB0,0x16,0x4B,0x4B,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x44269AF8, { 0x16,0xB0,0x2D,0xB0,0x16,0x4B,0x4B,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x44269AF8, { 0x16,0xB0,0x2D,0xB0,0x16,0x4B,0x4B,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x44269AF8, { 0x16,0xB0,0x2D,0xB0,0x16,0x4B,0x4B,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x44269AF8, { 0x16,0xB0,0x2D,0xB0,0x16,0x4B,0x4B,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x44269AF8, { 0x16,0xB0,0x2D,0xB0,0x16,0x4B,0x4B,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x44269AF8, { 0x16,0xB0,0x2D,0xB0,0x16,0x4B,0x4B,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0x44269AF8, { 0x16,0xB0,0x2D,0xB0,0x16,0x4B,0x4B,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xC0B964EE, { 0xB0,0x2D,0xB0,0x16,0x4B,0x4B,0x16,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xC0B964EE, { 0xB0,0x2D,0xB0,0x16,0x4B,0x4B,0x16,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xC0B964EE, { 0xB0,0x2D,0xB0,0x16,0x4B,0x4B,0x16,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xC0B964EE, { 0xB0,0x2D,0xB0,0x16,0x4B,0x4B,0x16,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xC0B964EE, { 0xB0,0x2D,0xB0,0x16,0x4B,0x4B,0x16,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xC0B964EE, { 0xB0,0x2D,0xB0,0x16,0x4B,0x4B,0x16,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+    { 0xC0B964EE, { 0xB0,0x2D,0xB0,0x16,0x4B,0x4B,0x16,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5,0xC5 } },
+  } },
+};
+#endif
+
+#endif //GOLDENFRAMES_RECORDED_H
@@ -0,0 +1,106 @@
+/*** INCLUDES ***/
+#include "Settings.h"
+#include "Hsv.h"
+
+/*** TYPE DEFINITIONS ***/
+// Saturation and value as multipliers: channel = (((channel * SatScale) >> 8) + Floor) * ValScale >> 8
+typedef struct
+{
+  uint16_t SatScale;
+  uint8_t Floor;
+  uint16_t ValScale;
+} HsvScale;
+
+/*** FORWARD DECLARATIONS ***/
+static const CRGB *Hsv_GetTable(void);
+static inline void Hsv_GetScale(uint8_t inSat, uint8_t inVal, HsvScale *outScale);
+static inline CRGB Hsv_Apply(CRGB inColor, const HsvScale *inScale);
+
+/*** PRIVATE VARIABLES ***/
+static CRGB s_HueTable[256];                 // hsv2rgb_rainbow() at full saturation and value
+static bool s_HueTableReady = false;
+
+/*** PUBLIC FUNCTIONS ***/
+
+// Constant saturation and value: at full saturation and value the conversion is a table lookup
+void Hsv_FillHues(CRGB *outColors, const uint8_t *inHues, uint16_t inCount, uint8_t inSat, uint8_t inVal)
+{
+  const CRGB *lvTable = Hsv_GetTable();
+  HsvScale lvScale;
+
+  if ((inSat == 255) && (inVal == 255))
+  {
+    for (uint16_t i = 0; i < inCount; i++)
+    {
+      outColors[i] = lvTable[inHues[i]];
+    }
+    return;
+  }
+  Hsv_GetScale(inSat, inVal, &lvScale);
+  for (uint16_t i = 0; i < inCount; i++)
+  {
+    outColors[i] = Hsv_Apply(lvTable[inHues[i]], &lvScale);
+  }
+}
+
+// outColors[i] gets hue inStartHue + i * inHueStep, like fill_rainbow()
+void Hsv_FillRamp(CRGB *outColors, uint16_t inCount, uint8_t inStartHue, uint8_t inHueStep, uint8_t inSat, uint8_t inVal)
+{
+  const CRGB *lvTable = Hsv_GetTable();
+  uint8_t lvHue = inStartHue;
+  HsvScale lvScale;
+
+  Hsv_GetScale(inSat, inVal, &lvScale);
+  for (uint16_t i = 0; i < inCount; i++)
+  {
+    outColors[i] = Hsv_Apply(lvTable[lvHue], &lvScale);
+    lvHue += inHueStep;
+  }
+}
+
+// Saturation and value per pixel
+void Hsv_Convert(CRGB *outColors, const CHSV *inColors, uint16_t inCount)
+{
+  const CRGB *lvTable = Hsv_GetTable();
+  HsvScale lvScale;
+
+  for (uint16_t i = 0; i < inCount; i++)
+  {
+    Hsv_GetScale(inColors[i].sat, inColors[i].val, &lvScale);
+    outColors[i] = Hsv_Apply(lvTable[inColors[i].hue], &lvScale);
+  }
+}
+
+/*** PRIVATE FUNCTIONS ***/
+
+static const CRGB *Hsv_GetTable()
+{
+  if (!s_HueTableReady)
+  {
+    for (uint16_t h = 0; h < 256; h++)
+    {
+      hsv2rgb_rainbow(CHSV(h, 255, 255), s_HueTable[h]);
+    }
+    s_HueTableReady = true;
+  }
+  return s_HueTable;
+}
+
+// The desaturation floor and the video scaling of the value follow hsv2rgb_rainbow(). Full saturation and value give
+// scales of 256 and a floor of 0, so one formula covers all cases.
+static inline void Hsv_GetScale(uint8_t inSat, uint8_t inVal, HsvScale *outScale)
+{
+  uint8_t lvDesat = 255 - inSat;
+  outScale->SatScale = (uint16_t)inSat + 1;
+  outScale->Floor = scale8(lvDesat, lvDesat);
+  outScale->ValScale = (uint16_t)scale8_video(inVal, inVal) + 1;
+}
+
+static inline CRGB Hsv_Apply(CRGB inColor, const HsvScale *inScale)
+{
+  CRGB lvColor;
+  lvColor.r = (((uint8_t)((inColor.r * inScale->SatScale) >> 8) + inScale->Floor) * inScale->ValScale) >> 8;
+  lvColor.g = (((uint8_t)((inColor.g * inScale->SatScale) >> 8) + inScale->Floor) * inScale->ValScale) >> 8;
+  lvColor.b = (((uint8_t)((inColor.b * inScale->SatScale) >> 8) + inScale->Floor) * inScale->ValScale) >> 8;
+  return lvColor;
+}
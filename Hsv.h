@@ -0,0 +1,15 @@
+#ifndef HSV_H
+#define HSV_H
+
+/*** INCLUDES ***/
+#include "Settings.h"
+
+/*** PUBLIC FUNCTIONS ***/
+// Batched HSV to RGB conversion with the colors of hsv2rgb_rainbow() (the CHSV to CRGB conversion).
+// The hue is looked up in a table of fully saturated colors, saturation and value are applied with branch-free
+// fixed-point scaling, so the loops have no data dependent branches.
+void Hsv_FillHues(CRGB *outColors, const uint8_t *inHues, uint16_t inCount, uint8_t inSat, uint8_t inVal);
+void Hsv_FillRamp(CRGB *outColors, uint16_t inCount, uint8_t inStartHue, uint8_t inHueStep, uint8_t inSat, uint8_t inVal);
+void Hsv_Convert(CRGB *outColors, const CHSV *inColors, uint16_t inCount);
+
+#endif //HSV_H
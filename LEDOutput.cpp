@@ -0,0 +1,223 @@
+/*** INCLUDES ***/
+#include "LEDOutput.h"
+#include "Mapping.h"
+
+/*** DEFINES ***/
+#ifdef ENABLE_DUAL_CORE_OUTPUT
+  #define LEDOUTPUT_BARRIER()     __sync_synchronize()              // the transmit task runs on the other core
+#endif //ENABLE_DUAL_CORE_OUTPUT
+
+/*** PRIVATE VARIABLES ***/
+static LEDOutputStats s_Stats;
+
+// g_LEDBuffer is the back buffer: programs render the logical pixels into it and rely on it keeping the previous frame.
+// The front buffer holds the last frame sent to the strip in physical order, it is used to detect which pixels changed.
+static CRGB s_FrontBuffer[DEFAULT_NUM_LEDS];
+static bool s_ForceFullFrame = true;
+static uint8_t s_LastScale = 0;                   // brightness the last frame was sent with, after power limiting
+
+#ifdef ENABLE_DUAL_CORE_OUTPUT
+// The front buffer is owned by the transmit task while s_TransmitBusy is set, it is only written when the task is idle.
+// Without the task (it could not be created) the frames are sent from loop().
+static TaskHandle_t s_TransmitTask = NULL;
+static volatile bool s_TransmitBusy = false;
+static bool s_FramePending = false;
+#endif //ENABLE_DUAL_CORE_OUTPUT
+
+/*** FORWARD DECLARATIONS ***/
+static void LEDOutput_HandOver(void);
+#ifdef ENABLE_DUAL_CORE_OUTPUT
+static void LEDOutput_TransmitTask(void *inParam);
+#endif //ENABLE_DUAL_CORE_OUTPUT
+
+/*** PUBLIC FUNCTIONS ***/
+void LEDOutput_Init()
+{
+  FastLED.addLeds<LED_TYPE, DATA_PIN, COLOR_ORDER>(s_FrontBuffer, DEFAULT_NUM_LEDS).setCorrection(TypicalLEDStrip);
+#ifdef ENABLE_DUAL_CORE_OUTPUT
+  if (xTaskCreatePinnedToCore(LEDOutput_TransmitTask, "LEDOutput", LED_OUTPUT_TASK_STACK_SIZE, NULL, LED_OUTPUT_TASK_PRIORITY, &s_TransmitTask, LED_OUTPUT_CORE) != pdPASS)
+  {
+    s_TransmitTask = NULL;
+    Serial.println(F("*** LEDOutput task not created, sending from loop() ***"));
+  }
+#endif //ENABLE_DUAL_CORE_OUTPUT
+}
+
+// Called every loop: transmits a frame that had to wait for the previous transmission to finish
+void LEDOutput_Tick()
+{
+#ifdef ENABLE_DUAL_CORE_OUTPUT
+  if (s_FramePending && !s_TransmitBusy)
+  {
+    LEDOutput_HandOver();
+  }
+#endif //ENABLE_DUAL_CORE_OUTPUT
+}
+
+// Called before a program renders the next frame into g_LEDBuffer
+void LEDOutput_BeginFrame()
+{
+#ifdef ENABLE_DUAL_CORE_OUTPUT
+  if (s_TransmitBusy)
+  {
+    s_Stats.OverlappedFrames++;
+  }
+#endif //ENABLE_DUAL_CORE_OUTPUT
+}
+
+void LEDOutput_Show()
+{
+#ifdef ENABLE_DUAL_CORE_OUTPUT
+  if (s_TransmitBusy)
+  {
+    // Previous frame still on the wire. Send this one as soon as the transmitter is idle.
+    if (s_FramePending)
+    {
+      s_Stats.DroppedFrames++;
+    }
+    s_FramePending = true;
+    return;
+  }
+#endif //ENABLE_DUAL_CORE_OUTPUT
+  LEDOutput_HandOver();
+}
+
+// Blank the strip and wait until it has been sent
+void LEDOutput_Clear()
+{
+  fill_solid(g_LEDBuffer, DEFAULT_NUM_LEDS, CRGB(0,0,0));
+#ifdef ENABLE_DUAL_CORE_OUTPUT
+  while (s_TransmitBusy)
+  {
+    delay(1);
+  }
+  LEDOutput_HandOver();
+  while (s_TransmitBusy)
+  {
+    delay(1);
+  }
+#else
+  LEDOutput_HandOver();
+#endif //ENABLE_DUAL_CORE_OUTPUT
+}
+
+const LEDOutputStats *LEDOutput_GetStats()
+{
+  return &s_Stats;
+}
+
+void LEDOutput_ClearStats()
+{
+  memset(&s_Stats, 0, sizeof(s_Stats));
+}
+
+void LEDOutput_PrintStats()
+{
+  Serial.print(F("Output Frames: "));
+  Serial.print(s_Stats.Frames);
+  Serial.print(F("; Dropped: "));
+  Serial.print(s_Stats.DroppedFrames);
+  Serial.print(F("; Overlapped: "));
+  Serial.print(s_Stats.OverlappedFrames);
+  Serial.print(F("; Unchanged: "));
+  Serial.print(s_Stats.UnchangedFrames);
+  Serial.print(F("; Sent: "));
+  Serial.print(s_Stats.BytesSent);
+  Serial.print(F("B; Saved: "));
+  Serial.print(s_Stats.BytesSaved);
+  Serial.print(F("B; Last: ["));
+  Serial.print(s_Stats.DirtyStart);
+  Serial.print(F(".."));
+  Serial.print(s_Stats.DirtyEnd);
+  Serial.print(F("] saved "));
+  Serial.print(s_Stats.LastBytesSaved);
+  Serial.println(F("B"));
+}
+
+/*** PRIVATE FUNCTIONS ***/
+
+// Map the logical pixels onto the strip, copy the changed pixels into the front buffer and transmit up to the last changed pixel.
+// WS2811/WS2812 pixels latch the last data they received, so the unchanged tail does not need to be sent.
+static void LEDOutput_HandOver()
+{
+  const uint16_t *lvMap = Mapping_GetTable();
+  uint16_t lvStart = DEFAULT_NUM_LEDS;
+  uint16_t lvEnd = 0;
+  uint8_t lvBrightness = FastLED.getBrightness();
+  uint8_t lvScale;
+
+#ifdef ENABLE_DUAL_CORE_OUTPUT
+  s_FramePending = false;
+  // the task is idle: its reads of the front buffer are complete before it is written
+  LEDOUTPUT_BARRIER();
+#endif //ENABLE_DUAL_CORE_OUTPUT
+
+  // single gather pass: mirror/reverse/layout and change detection
+  for (uint16_t i = 0; i < DEFAULT_NUM_LEDS; i++)
+  {
+    const CRGB &lvPixel = g_LEDBuffer[lvMap[i]];
+    if (lvPixel != s_FrontBuffer[i])
+    {
+      s_FrontBuffer[i] = lvPixel;
+      if (lvStart > i)
+      {
+        lvStart = i;
+      }
+      lvEnd = i;
+    }
+  }
+
+  // FastLED.show() limits the brightness from the power of the pixels it sends, a prefix draws less than the whole strip.
+  // While the limit is active the prefix would be sent brighter than the latched tail: send the complete strip then.
+  lvScale = calculate_max_brightness_for_power_mW(s_FrontBuffer, DEFAULT_NUM_LEDS, lvBrightness, (uint32_t)LED_VOLTAGE * LED_MAX_CURRENT_MA);
+  if (!s_ForceFullFrame && (lvScale == s_LastScale) && (lvStart >= DEFAULT_NUM_LEDS))
+  {
+    // nothing changed
+    s_Stats.UnchangedFrames++;
+    s_Stats.BytesSaved += DEFAULT_NUM_LEDS * sizeof(CRGB);
+    return;
+  }
+  if (s_ForceFullFrame || (lvScale != s_LastScale) || (lvScale < lvBrightness))
+  {
+    // brightness scales every pixel: resend the complete strip
+    s_ForceFullFrame = false;
+    s_LastScale = lvScale;
+    lvStart = 0;
+    lvEnd = DEFAULT_NUM_LEDS - 1;
+  }
+
+  s_Stats.Frames++;
+  s_Stats.DirtyStart = lvStart;
+  s_Stats.DirtyEnd = lvEnd;
+  s_Stats.LastBytesSaved = (DEFAULT_NUM_LEDS - 1 - lvEnd) * sizeof(CRGB);
+  s_Stats.BytesSent += (lvEnd + 1) * sizeof(CRGB);
+  s_Stats.BytesSaved += s_Stats.LastBytesSaved;
+
+  // Only clock out the changed prefix of the strip
+  FastLED[0].setLeds(s_FrontBuffer, lvEnd + 1);
+
+#ifdef ENABLE_DUAL_CORE_OUTPUT
+  if (s_TransmitTask != NULL)
+  {
+    // Release the front buffer to the transmit task, the frame is complete before the task sees the flag
+    LEDOUTPUT_BARRIER();
+    s_TransmitBusy = true;
+    xTaskNotifyGive(s_TransmitTask);
+    return;
+  }
+#endif //ENABLE_DUAL_CORE_OUTPUT
+  FastLED.show();
+}
+
+#ifdef ENABLE_DUAL_CORE_OUTPUT
+static void LEDOutput_TransmitTask(void *inParam)
+{
+  for (;;)
+  {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    FastLED.show();
+    LEDOUTPUT_BARRIER();
+    s_TransmitBusy = false;
+  }
+}
+#endif //ENABLE_DUAL_CORE_OUTPUT
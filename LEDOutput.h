@@ -0,0 +1,34 @@
+#ifndef LEDOUTPUT_H
+#define LEDOUTPUT_H
+
+/*** INCLUDES ***/
+#include "Settings.h"
+
+/*** TYPE DEFINITIONS ***/
+typedef struct
+{
+  unsigned long Frames;                 // frames handed over to the strip
+  unsigned long DroppedFrames;          // frames superseded by a newer frame before they could be transmitted
+  unsigned long OverlappedFrames;       // frames rendered while the previous frame was still being transmitted
+  unsigned long UnchangedFrames;        // frames not sent because no pixel changed
+  unsigned long BytesSent;
+  unsigned long BytesSaved;             // bytes not sent because the tail of the strip did not change
+
+  // Last transmitted frame
+  uint16_t DirtyStart;                  // lowest changed pixel
+  uint16_t DirtyEnd;                    // highest changed pixel
+  uint16_t LastBytesSaved;
+} LEDOutputStats;
+
+/*** PUBLIC FUNCTIONS ***/
+void LEDOutput_Init(void);
+void LEDOutput_Tick(void);
+void LEDOutput_BeginFrame(void);
+void LEDOutput_Show(void);
+void LEDOutput_Clear(void);
+
+const LEDOutputStats *LEDOutput_GetStats(void);
+void LEDOutput_ClearStats(void);
+void LEDOutput_PrintStats(void);
+
+#endif //LEDOUTPUT_H
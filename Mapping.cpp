@@ -0,0 +1,88 @@
+/*** INCLUDES ***/
+#include "Mapping.h"
+
+#if (LED_LAYOUT == LED_LAYOUT_SERPENTINE)
+  #if !defined(LED_MATRIX_WIDTH) || ((DEFAULT_NUM_LEDS % LED_MATRIX_WIDTH) != 0)
+    #error "LED_LAYOUT_SERPENTINE requires a LED_MATRIX_WIDTH that divides DEFAULT_NUM_LEDS"
+  #endif
+#endif
+
+/*** FORWARD DECLARATIONS ***/
+static uint16_t Mapping_Layout(uint16_t inPhysical);
+
+/*** PRIVATE VARIABLES ***/
+// Programs render NUM_LEDS logical pixels into g_LEDBuffer, physical LED i shows logical pixel s_Map[i]
+static uint16_t s_Map[DEFAULT_NUM_LEDS];
+static uint16_t s_NumLeds = DEFAULT_NUM_LEDS;
+static bool s_Valid = false;
+static bool s_Mirror = false;
+static bool s_Reverse = false;
+
+/*** PUBLIC FUNCTIONS ***/
+
+// Rebuild the map when Mirror or Reverse changed.
+// Returns true if the number of logical pixels changed, the programs have to be restarted.
+bool Mapping_Update()
+{
+  if (s_Valid && (g_GlobalSettings.Mirror == s_Mirror) && (g_GlobalSettings.Reverse == s_Reverse))
+  {
+    return false;
+  }
+  uint16_t lvPrevNumLeds = s_NumLeds;
+
+  s_Mirror = g_GlobalSettings.Mirror;
+  s_Reverse = g_GlobalSettings.Reverse;
+  s_NumLeds = s_Mirror ? ((DEFAULT_NUM_LEDS + 1) / 2) : DEFAULT_NUM_LEDS;
+  for (uint16_t i = 0; i < DEFAULT_NUM_LEDS; i++)
+  {
+    uint16_t lvLogical = Mapping_Layout(i);
+    if (lvLogical >= s_NumLeds)
+    {
+      // mirror: the second half shows the first half backwards
+      lvLogical = DEFAULT_NUM_LEDS - 1 - lvLogical;
+    }
+    if (s_Reverse)
+    {
+      lvLogical = s_NumLeds - 1 - lvLogical;
+    }
+    s_Map[i] = lvLogical;
+  }
+  s_Valid = true;
+  return (s_NumLeds != lvPrevNumLeds);
+}
+
+// Number of pixels the programs render
+uint16_t Mapping_GetNumLeds()
+{
+  return s_NumLeds;
+}
+
+const uint16_t *Mapping_GetTable()
+{
+  return s_Map;
+}
+
+/*** PRIVATE FUNCTIONS ***/
+
+// Position of a physical LED along the line the programs render
+static uint16_t Mapping_Layout(uint16_t inPhysical)
+{
+#if (LED_LAYOUT == LED_LAYOUT_FOLD)
+  // neighbouring pixels alternate between the outgoing and the returning half
+  if (inPhysical < ((DEFAULT_NUM_LEDS + 1) / 2))
+  {
+    return 2 * inPhysical;
+  }
+  return 2 * (DEFAULT_NUM_LEDS - 1 - inPhysical) + 1;
+#elif (LED_LAYOUT == LED_LAYOUT_SERPENTINE)
+  uint16_t lvRow = inPhysical / LED_MATRIX_WIDTH;
+  uint16_t lvColumn = inPhysical % LED_MATRIX_WIDTH;
+  if (lvRow & 1)
+  {
+    lvColumn = LED_MATRIX_WIDTH - 1 - lvColumn;
+  }
+  return (lvRow * LED_MATRIX_WIDTH) + lvColumn;
+#else
+  return inPhysical;
+#endif
+}
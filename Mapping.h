@@ -0,0 +1,12 @@
+#ifndef MAPPING_H
+#define MAPPING_H
+
+/*** INCLUDES ***/
+#include "Settings.h"
+
+/*** PUBLIC FUNCTIONS ***/
+bool Mapping_Update(void);
+uint16_t Mapping_GetNumLeds(void);
+const uint16_t *Mapping_GetTable(void);
+
+#endif //MAPPING_H
@@ -0,0 +1,130 @@
+/*** INCLUDES ***/
+#include "Settings.h"
+#include "PacketPool.h"
+
+#ifdef INCLUDE_PROGRAM_REALTIME
+
+/*** DEFINES ***/
+#define PACKET_POOL_MASK          (PACKET_POOL_BUFFERS - 1)
+
+#ifdef BOARD_ESP32
+  #define PACKET_POOL_BARRIER()   __sync_synchronize()              // producer and consumer run on different cores
+#else
+  #define PACKET_POOL_BARRIER()   __asm__ __volatile__("" ::: "memory")
+#endif //BOARD_ESP32
+
+static_assert((PACKET_POOL_BUFFERS & PACKET_POOL_MASK) == 0, "PACKET_POOL_BUFFERS must be a power of 2");
+
+/*** PRIVATE VARIABLES ***/
+static PacketBuffer s_Buffers[PACKET_POOL_BUFFERS];
+static PacketPoolStats s_Stats;
+
+// Two single producer/single consumer rings of buffer pointers. Head and tail run freely, head - tail is the fill level.
+// Free ring: released by the consumer, taken by the producer. Ready ring: submitted by the producer, taken by the consumer.
+static PacketBuffer *s_FreeRing[PACKET_POOL_BUFFERS];
+static volatile uint8_t s_FreeHead = 0;
+static volatile uint8_t s_FreeTail = 0;
+static PacketBuffer *s_ReadyRing[PACKET_POOL_BUFFERS];
+static volatile uint8_t s_ReadyHead = 0;
+static volatile uint8_t s_ReadyTail = 0;
+
+/*** PUBLIC FUNCTIONS ***/
+
+// Not while packets are received
+void PacketPool_Init()
+{
+  for (uint8_t i = 0; i < PACKET_POOL_BUFFERS; i++)
+  {
+    s_FreeRing[i] = &s_Buffers[i];
+  }
+  s_FreeTail = 0;
+  s_FreeHead = PACKET_POOL_BUFFERS;
+  s_ReadyTail = 0;
+  s_ReadyHead = 0;
+}
+
+// Free buffer for the next datagram, NULL if all buffers wait for loop()
+PacketBuffer *PacketPool_Acquire()
+{
+  uint8_t lvTail = s_FreeTail;
+
+  if (lvTail == s_FreeHead)
+  {
+    s_Stats.Dropped++;
+    return NULL;
+  }
+  PACKET_POOL_BARRIER();
+  PacketBuffer *lvBuffer = s_FreeRing[lvTail & PACKET_POOL_MASK];
+  PACKET_POOL_BARRIER();
+  s_FreeTail = lvTail + 1;
+  return lvBuffer;
+}
+
+void PacketPool_Submit(PacketBuffer *inBuffer)
+{
+  uint8_t lvHead = s_ReadyHead;
+
+  s_ReadyRing[lvHead & PACKET_POOL_MASK] = inBuffer;
+  PACKET_POOL_BARRIER();
+  s_ReadyHead = lvHead + 1;
+}
+
+// The one copy of a datagram, from the network stack into a pool buffer. Returns false if it was dropped.
+bool PacketPool_Put(const uint8_t *inData, uint16_t inLength, uint8_t inTag)
+{
+  if (inLength > PACKET_POOL_BUFFER_SIZE)
+  {
+    s_Stats.Dropped++;
+    return false;
+  }
+  PacketBuffer *lvBuffer = PacketPool_Acquire();
+  if (lvBuffer == NULL)
+  {
+    return false;
+  }
+  memcpy(lvBuffer->Data, inData, inLength);
+  lvBuffer->Length = inLength;
+  lvBuffer->Tag = inTag;
+  PacketPool_Submit(lvBuffer);
+  return true;
+}
+
+// Oldest submitted buffer, NULL if none. Release it when done.
+PacketBuffer *PacketPool_Receive()
+{
+  uint8_t lvTail = s_ReadyTail;
+  uint8_t lvQueued = s_ReadyHead - lvTail;
+
+  if (lvQueued == 0)
+  {
+    return NULL;
+  }
+  PACKET_POOL_BARRIER();
+  PacketBuffer *lvBuffer = s_ReadyRing[lvTail & PACKET_POOL_MASK];
+  PACKET_POOL_BARRIER();
+  s_ReadyTail = lvTail + 1;
+  s_Stats.Received++;
+  s_Stats.MaxQueued = max(s_Stats.MaxQueued, lvQueued);
+  return lvBuffer;
+}
+
+void PacketPool_Release(PacketBuffer *inBuffer)
+{
+  uint8_t lvHead = s_FreeHead;
+
+  s_FreeRing[lvHead & PACKET_POOL_MASK] = inBuffer;
+  PACKET_POOL_BARRIER();
+  s_FreeHead = lvHead + 1;
+}
+
+const PacketPoolStats *PacketPool_GetStats()
+{
+  return &s_Stats;
+}
+
+void PacketPool_ClearStats()
+{
+  memset(&s_Stats, 0, sizeof(s_Stats));
+}
+
+#endif //INCLUDE_PROGRAM_REALTIME
@@ -0,0 +1,47 @@
+#ifndef PACKETPOOL_H
+#define PACKETPOOL_H
+
+/*** INCLUDES ***/
+#include "Settings.h"
+
+/*** DEFINES ***/
+#define PACKET_POOL_BUFFERS       8                   // power of 2
+#ifdef INCLUDE_REALTIME_DDP
+  #define PACKET_POOL_BUFFER_SIZE 1454                // largest DDP packet: header with timecode and 1440 bytes of data
+#else
+  #define PACKET_POOL_BUFFER_SIZE 638                 // largest E1.31 data packet
+#endif //INCLUDE_REALTIME_DDP
+
+/*** TYPE DEFINITIONS ***/
+typedef struct
+{
+  uint16_t Length;
+  uint8_t Tag;                            // set by the producer, e.g. the protocol
+  uint8_t Data[PACKET_POOL_BUFFER_SIZE];
+} PacketBuffer;
+
+typedef struct
+{
+  unsigned long Received;                 // buffers handed to loop()
+  unsigned long Dropped;                  // packets that found no free buffer
+  uint8_t MaxQueued;
+} PacketPoolStats;
+
+/*** PUBLIC FUNCTIONS ***/
+// Fixed set of receive buffers passed between the network task (producer) and loop() (consumer) without locks.
+// The producer copies a datagram into a free buffer once, the consumer parses and uses it in place and releases it.
+void PacketPool_Init(void);
+
+// Producer side
+PacketBuffer *PacketPool_Acquire(void);
+void PacketPool_Submit(PacketBuffer *inBuffer);
+bool PacketPool_Put(const uint8_t *inData, uint16_t inLength, uint8_t inTag);
+
+// Consumer side
+PacketBuffer *PacketPool_Receive(void);
+void PacketPool_Release(PacketBuffer *inBuffer);
+
+const PacketPoolStats *PacketPool_GetStats(void);
+void PacketPool_ClearStats(void);
+
+#endif //PACKETPOOL_H
@@ -0,0 +1,139 @@
+/*** INCLUDES ***/
+#include "Settings.h"
+#include "Palettes.h"
+
+/*** TYPE DEFINITIONS ***/
+typedef struct
+{
+  uint8_t Palette;                        // NUM_PALETTES: empty
+  uint8_t LastUse;
+  CRGBPalette256 Lut;
+} PaletteCacheSlot;
+
+/*** FORWARD DECLARATIONS ***/
+static void Palettes_Expand(uint8_t inPalette, CRGBPalette256 *outLut);
+
+/*** PRIVATE VARIABLES ***/
+// Gradient palette "bhw2_xmas_gp", originally from
+// http://soliton.vm.bytemark.co.uk/pub/cpt-city/bhw/bhw2/tn/bhw2_xmas.png.index.html
+// converted for FastLED with gammas (2.6, 2.2, 2.5)
+// Size: 48 bytes of program space.
+
+DEFINE_GRADIENT_PALETTE( bhw2_xmas_gp ) {
+    0,   0, 12,  0,
+   40,   0, 55,  0,
+   66,   1,117,  2,
+   77,   1, 84,  1,
+   81,   0, 55,  0,
+  119,   0, 12,  0,
+  153,  42,  0,  0,
+  181, 121,  0,  0,
+  204, 255, 12,  8,
+  224, 121,  0,  0,
+  244,  42,  0,  0,
+  255,  42,  0,  0};
+
+static PaletteCacheSlot s_Cache[PALETTE_CACHE_SLOTS];
+static uint8_t s_UseCount = 0;
+static bool s_CacheInitialized = false;
+
+/*** PUBLIC FUNCTIONS ***/
+
+const CRGB *Palettes_Get(uint8_t inPalette)
+{
+  uint8_t lvSlot = 0;
+
+  if (!s_CacheInitialized)
+  {
+    for (uint8_t s = 0; s < PALETTE_CACHE_SLOTS; s++)
+    {
+      s_Cache[s].Palette = NUM_PALETTES;
+    }
+    s_CacheInitialized = true;
+  }
+  if (inPalette >= NUM_PALETTES)
+  {
+    inPalette = PALETTE_RAINBOW;
+  }
+
+  // hit, or else the least recently used slot
+  for (uint8_t s = 0; s < PALETTE_CACHE_SLOTS; s++)
+  {
+    if (s_Cache[s].Palette == inPalette)
+    {
+      lvSlot = s;
+      break;
+    }
+    if ((uint8_t)(s_UseCount - s_Cache[s].LastUse) > (uint8_t)(s_UseCount - s_Cache[lvSlot].LastUse))
+    {
+      lvSlot = s;
+    }
+  }
+  if (s_Cache[lvSlot].Palette != inPalette)
+  {
+    Palettes_Expand(inPalette, &s_Cache[lvSlot].Lut);
+    s_Cache[lvSlot].Palette = inPalette;
+  }
+  s_Cache[lvSlot].LastUse = ++s_UseCount;
+  return s_Cache[lvSlot].Lut.entries;
+}
+
+void Palettes_Map(const CRGB *inLut, const uint8_t *inIndices, CRGB *outColors, uint16_t inCount)
+{
+  for (uint16_t i = 0; i < inCount; i++)
+  {
+    outColors[i] = inLut[inIndices[i]];
+  }
+}
+
+// outColors[i] = inLut[inStart + i * inStep], the index wraps at 256
+void Palettes_MapRamp(const CRGB *inLut, CRGB *outColors, uint16_t inCount, uint8_t inStart, uint8_t inStep)
+{
+  uint8_t lvIndex = inStart;
+  for (uint16_t i = 0; i < inCount; i++)
+  {
+    outColors[i] = inLut[lvIndex];
+    lvIndex += inStep;
+  }
+}
+
+// Call once per update while blending: the change per update is bounded, a finished blend costs one compare per byte
+bool Palettes_Blend(CRGB *ioLut, const CRGB *inTarget, uint8_t inMaxChange)
+{
+  uint8_t *lvCurrent = (uint8_t *)ioLut;
+  const uint8_t *lvTarget = (const uint8_t *)inTarget;
+  bool lvDone = true;
+
+  for (uint16_t i = 0; i < (PALETTE_SIZE * sizeof(CRGB)); i++)
+  {
+    uint8_t lvValue = lvCurrent[i];
+    uint8_t lvTo = lvTarget[i];
+    if (lvValue < lvTo)
+    {
+      lvCurrent[i] = ((lvTo - lvValue) > inMaxChange) ? (lvValue + inMaxChange) : lvTo;
+    }
+    else if (lvValue > lvTo)
+    {
+      lvCurrent[i] = ((lvValue - lvTo) > inMaxChange) ? (lvValue - inMaxChange) : lvTo;
+    }
+    lvDone &= (lvCurrent[i] == lvTo);
+  }
+  return lvDone;
+}
+
+/*** PRIVATE FUNCTIONS ***/
+
+// 16 entry palettes are interpolated like ColorFromPalette(..., LINEARBLEND). The gradient goes through its 16 entry
+// palette too, so the table has the colors of the CRGBPalette16 Christmas used to look up.
+static void Palettes_Expand(uint8_t inPalette, CRGBPalette256 *outLut)
+{
+  switch (inPalette)
+  {
+    case PALETTE_OCEAN:   *outLut = OceanColors_p;    break;
+    case PALETTE_LAVA:    *outLut = LavaColors_p;     break;
+    case PALETTE_FOREST:  *outLut = ForestColors_p;   break;
+    case PALETTE_XMAS:    *outLut = CRGBPalette16(bhw2_xmas_gp);  break;
+    case PALETTE_RAINBOW:
+    default:              *outLut = RainbowColors_p;  break;
+  }
+}
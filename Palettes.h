@@ -0,0 +1,33 @@
+#ifndef PALETTES_H
+#define PALETTES_H
+
+/*** INCLUDES ***/
+#include "Settings.h"
+
+/*** DEFINES ***/
+#define PALETTE_SIZE          256                 // entries in an expanded palette, indexed by a uint8_t
+
+/*** TYPE DEFINITIONS ***/
+enum
+{
+  PALETTE_OCEAN,
+  PALETTE_LAVA,
+  PALETTE_FOREST,
+  PALETTE_RAINBOW,
+  PALETTE_XMAS,
+  NUM_PALETTES
+};
+
+/*** PUBLIC FUNCTIONS ***/
+// Palettes stay in flash (FastLED's 16 entry palettes and gradients). Palettes_Get() expands a palette into a 256 entry
+// lookup table in a small cache on first use, the table is valid until the next Palettes_Get().
+const CRGB *Palettes_Get(uint8_t inPalette);
+
+// Batched lookups for a whole strip
+void Palettes_Map(const CRGB *inLut, const uint8_t *inIndices, CRGB *outColors, uint16_t inCount);
+void Palettes_MapRamp(const CRGB *inLut, CRGB *outColors, uint16_t inCount, uint8_t inStart, uint8_t inStep);
+
+// Moves every channel of ioLut at most inMaxChange towards inTarget. Returns true when ioLut equals inTarget.
+bool Palettes_Blend(CRGB *ioLut, const CRGB *inTarget, uint8_t inMaxChange);
+
+#endif //PALETTES_H
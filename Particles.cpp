@@ -0,0 +1,225 @@
+/*** INCLUDES ***/
+#include "Settings.h"
+#include "Particles.h"
+
+/*** DEFINES ***/
+#define PARTICLES_ALIGN4(n)       (((n) + 3) & ~3)
+#define PARTICLES_PER_LED_DIV     2       // at most one particle per 2 LEDs, more would not fit the state arena on long strips
+
+/*** FORWARD DECLARATIONS ***/
+static void Particles_Remove(ParticlePool *ioPool, uint16_t inIndex);
+
+/*** PUBLIC FUNCTIONS ***/
+
+// Pool capacity for an effect that wants inMaxParticles on a strip of inNumLeds
+uint16_t Particles_Capacity(uint16_t inMaxParticles, uint16_t inNumLeds)
+{
+  return constrain(inNumLeds / PARTICLES_PER_LED_DIV, 1, inMaxParticles);
+}
+
+// Bytes for a pool of inCapacity particles, allocate them with AllocState()
+uint16_t Particles_StateSize(uint16_t inCapacity)
+{
+  return PARTICLES_ALIGN4(sizeof(ParticlePool)) + (inCapacity * (sizeof(int32_t) + sizeof(int16_t) + sizeof(CRGB) + 3));
+}
+
+// Empty pool in outMemory, Particles_StateSize(inCapacity) bytes. Returns NULL if outMemory is NULL.
+ParticlePool *Particles_Init(void *outMemory, uint16_t inCapacity, uint16_t inNumLeds)
+{
+  ParticlePool *lvPool = (ParticlePool *)outMemory;
+  if (lvPool == NULL)
+  {
+    return NULL;
+  }
+
+  // widest arrays first, so every array is aligned
+  uint8_t *lvArrays = (uint8_t *)outMemory + PARTICLES_ALIGN4(sizeof(ParticlePool));
+  lvPool->Capacity = inCapacity;
+  lvPool->Count = 0;
+  lvPool->NumLeds = inNumLeds;
+  lvPool->Pos = (int32_t *)lvArrays;
+  lvPool->Velocity = (int16_t *)&lvPool->Pos[inCapacity];
+  lvPool->Color = (CRGB *)&lvPool->Velocity[inCapacity];
+  lvPool->Level = (uint8_t *)&lvPool->Color[inCapacity];
+  lvPool->Fade = &lvPool->Level[inCapacity];
+  lvPool->Hold = &lvPool->Fade[inCapacity];
+  return lvPool;
+}
+
+// Add a particle at full level. A full pool replaces its dimmest particle, so emitters never stall.
+void Particles_Emit(ParticlePool *ioPool, int32_t inPos, int16_t inVelocity, CRGB inColor, uint8_t inFade, uint8_t inHold)
+{
+  uint16_t lvIndex = ioPool->Count;
+
+  if (lvIndex < ioPool->Capacity)
+  {
+    ioPool->Count++;
+  }
+  else
+  {
+    lvIndex = 0;
+    for (uint16_t i = 1; i < ioPool->Count; i++)
+    {
+      if (ioPool->Level[i] < ioPool->Level[lvIndex])
+      {
+        lvIndex = i;
+      }
+    }
+  }
+  ioPool->Pos[lvIndex] = inPos;
+  ioPool->Velocity[lvIndex] = inVelocity;
+  ioPool->Color[lvIndex] = inColor;
+  ioPool->Level[lvIndex] = 255;
+  ioPool->Fade[lvIndex] = inFade;
+  ioPool->Hold[lvIndex] = inHold;
+}
+
+// Move all particles inSteps steps, particles that leave the strip are removed
+void Particles_Integrate(ParticlePool *ioPool, uint16_t inSteps)
+{
+  int32_t lvEnd = PARTICLE_POS(ioPool->NumLeds);
+  uint16_t i = 0;
+
+  while (i < ioPool->Count)
+  {
+    int32_t lvPos = ioPool->Pos[i] + ((int32_t)ioPool->Velocity[i] * inSteps);
+    if ((lvPos < 0) || (lvPos >= lvEnd))
+    {
+      Particles_Remove(ioPool, i);
+      continue;
+    }
+    ioPool->Pos[i] = lvPos;
+    i++;
+  }
+}
+
+// Fade all particles inSteps steps, particles that reach level 0 are removed.
+// ioRandomDecay: each particle fades in a step with a chance of 1/2, like Meteor's random decay. NULL: always.
+void Particles_Fade(ParticlePool *ioPool, uint16_t inSteps, RandomStream *ioRandomDecay)
+{
+  uint32_t lvBits = 0;
+  uint8_t lvNumBits = 0;
+  uint16_t i = 0;
+
+  while (i < ioPool->Count)
+  {
+    uint8_t lvLevel = ioPool->Level[i];
+    uint8_t lvHold = ioPool->Hold[i];
+    uint8_t lvScale = 255 - ioPool->Fade[i];
+
+    // stops at level 0, so the work per particle is bounded by its lifetime
+    for (uint16_t s = 0; (s < inSteps) && (lvLevel > 0); s++)
+    {
+      if (lvHold > 0)
+      {
+        lvHold--;
+        continue;
+      }
+      if (ioRandomDecay != NULL)
+      {
+        if (lvNumBits == 0)
+        {
+          lvBits = Random_32(ioRandomDecay);
+          lvNumBits = 32;
+        }
+        uint8_t lvDecay = lvBits & 1;
+        lvBits >>= 1;
+        lvNumBits--;
+        if (!lvDecay)
+        {
+          continue;
+        }
+      }
+      lvLevel = scale8(lvLevel, lvScale);
+    }
+
+    if (lvLevel == 0)
+    {
+      Particles_Remove(ioPool, i);
+      continue;
+    }
+    ioPool->Level[i] = lvLevel;
+    ioPool->Hold[i] = lvHold;
+    i++;
+  }
+}
+
+// Add all particles to ioLEDs, anti-aliased over the 2 LEDs around their position
+void Particles_Render(const ParticlePool *inPool, CRGB *ioLEDs)
+{
+  for (uint16_t i = 0; i < inPool->Count; i++)
+  {
+    CRGB lvColor = inPool->Color[i];
+    if (inPool->Level[i] < 255)
+    {
+      lvColor.nscale8(inPool->Level[i]);
+    }
+    Particles_Splat(ioLEDs, inPool->NumLeds, inPool->Pos[i], lvColor);
+  }
+}
+
+// Black out the LEDs the last Particles_Render() drew. Call before the pool changes, the positions are the footprints:
+// effects that only draw particles clear these instead of the complete strip.
+void Particles_Clear(const ParticlePool *inPool, CRGB *ioLEDs)
+{
+  for (uint16_t i = 0; i < inPool->Count; i++)
+  {
+    Particles_Erase(ioLEDs, inPool->NumLeds, inPool->Pos[i]);
+  }
+}
+
+// Add one dot at a sub-pixel position: the LED at inPos gets the part of inColor that the fraction leaves for it
+void Particles_Splat(CRGB *ioLEDs, uint16_t inNumLeds, int32_t inPos, CRGB inColor)
+{
+  if ((inPos < 0) || (PARTICLE_LED(inPos) >= inNumLeds))
+  {
+    return;
+  }
+  uint16_t lvLed = PARTICLE_LED(inPos);
+  uint8_t lvFraction = inPos & ((1 << PARTICLE_POS_SHIFT) - 1);
+
+  if (lvFraction == 0)
+  {
+    ioLEDs[lvLed] += inColor;
+    return;
+  }
+  CRGB lvLeft = inColor;
+  lvLeft.nscale8(255 - lvFraction);
+  ioLEDs[lvLed] += lvLeft;
+  if ((lvLed + 1) < inNumLeds)
+  {
+    inColor.nscale8(lvFraction);
+    ioLEDs[lvLed + 1] += inColor;
+  }
+}
+
+// Black out the LEDs a Particles_Splat() at inPos drew
+void Particles_Erase(CRGB *ioLEDs, uint16_t inNumLeds, int32_t inPos)
+{
+  if ((inPos < 0) || (PARTICLE_LED(inPos) >= inNumLeds))
+  {
+    return;
+  }
+  uint16_t lvLed = PARTICLE_LED(inPos);
+
+  ioLEDs[lvLed] = CRGB(0,0,0);
+  if (((inPos & ((1 << PARTICLE_POS_SHIFT) - 1)) != 0) && ((lvLed + 1) < inNumLeds))
+  {
+    ioLEDs[lvLed + 1] = CRGB(0,0,0);
+  }
+}
+
+/*** PRIVATE FUNCTIONS ***/
+
+// The last particle takes the place of the removed one
+static void Particles_Remove(ParticlePool *ioPool, uint16_t inIndex)
+{
+  uint16_t lvLast = --ioPool->Count;
+
+  ioPool->Pos[inIndex] = ioPool->Pos[lvLast];
+  ioPool->Velocity[inIndex] = ioPool->Velocity[lvLast];
+  ioPool->Color[inIndex] = ioPool->Color[lvLast];
+  ioPool->Level[inIndex] = ioPool->Level[lvLast];
+  ioPool->Fade[inIndex] = ioPool->Fade[lvLast];
+  ioPool->Hold[inIndex] = ioPool->Hold[lvLast];
+}
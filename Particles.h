@@ -0,0 +1,42 @@
+#ifndef PARTICLES_H
+#define PARTICLES_H
+
+/*** INCLUDES ***/
+#include "Settings.h"
+
+/*** DEFINES ***/
+#define PARTICLE_POS_SHIFT        8                   // positions and velocities in 1/256 LED
+#define PARTICLE_POS(led)         ((int32_t)(led) << PARTICLE_POS_SHIFT)
+#define PARTICLE_LED(pos)         ((pos) >> PARTICLE_POS_SHIFT)
+
+/*** TYPE DEFINITIONS ***/
+// Fixed capacity pool of moving dots in structure-of-arrays layout: every pass walks only the arrays it needs.
+// Particles start at full level, fade out after their hold time and are removed at level 0 or when they leave the strip.
+// The pool and its arrays are one block from Particles_Init(), the order of the particles changes on removal.
+typedef struct
+{
+  uint16_t Capacity;
+  uint16_t Count;
+  uint16_t NumLeds;
+  int32_t *Pos;                           // 1/256 LED
+  int16_t *Velocity;                      // 1/256 LED per step
+  CRGB *Color;                            // color at full level
+  uint8_t *Level;                         // 255: full .. 0: removed
+  uint8_t *Fade;                          // fade amount per step, like fadeToBlackBy()
+  uint8_t *Hold;                          // steps at full level before fading starts
+} ParticlePool;
+
+/*** PUBLIC FUNCTIONS ***/
+uint16_t Particles_Capacity(uint16_t inMaxParticles, uint16_t inNumLeds);
+uint16_t Particles_StateSize(uint16_t inCapacity);
+ParticlePool *Particles_Init(void *outMemory, uint16_t inCapacity, uint16_t inNumLeds);
+
+void Particles_Emit(ParticlePool *ioPool, int32_t inPos, int16_t inVelocity, CRGB inColor, uint8_t inFade, uint8_t inHold);
+void Particles_Integrate(ParticlePool *ioPool, uint16_t inSteps);
+void Particles_Fade(ParticlePool *ioPool, uint16_t inSteps, RandomStream *ioRandomDecay);
+void Particles_Render(const ParticlePool *inPool, CRGB *ioLEDs);
+void Particles_Clear(const ParticlePool *inPool, CRGB *ioLEDs);
+void Particles_Splat(CRGB *ioLEDs, uint16_t inNumLeds, int32_t inPos, CRGB inColor);
+void Particles_Erase(CRGB *ioLEDs, uint16_t inNumLeds, int32_t inPos);
+
+#endif //PARTICLES_H
@@ -0,0 +1,168 @@
+/*** INCLUDES ***/
+#include "Profiler.h"
+#include "Registry.h"
+
+#ifdef ENABLE_PROFILER
+
+/*** TYPE DEFINITIONS ***/
+typedef struct
+{
+  uint16_t Histogram[PROFILER_BUCKETS];
+  unsigned long MaxUs;
+} ProfilerStageData;
+
+typedef struct
+{
+  ProfilerStageData Stages[PROFILER_NUM_STAGES];
+  uint16_t Frames;
+  unsigned long TargetPeriodUs;
+} ProfilerProgramData;
+
+/*** FORWARD DECLARATIONS ***/
+static uint8_t Profiler_Bucket(unsigned long inDurationUs);
+static unsigned long Profiler_BucketLimit(uint8_t inBucket);
+static unsigned long Profiler_Percentile(const ProfilerStageData *inData, uint16_t inCount, uint8_t inPercent);
+
+/*** PRIVATE VARIABLES ***/
+static ProfilerProgramData s_Programs[PROFILER_MAX_PROGRAMS];
+static unsigned long s_WindowStartMs = 0;
+
+/*** PUBLIC FUNCTIONS ***/
+void Profiler_Record(int8_t inProgramIndex, ProfilerStage inStage, unsigned long inDurationUs)
+{
+  if ((inProgramIndex < 0) || (inProgramIndex >= PROFILER_MAX_PROGRAMS))
+  {
+    return;
+  }
+  ProfilerStageData *lvData = &s_Programs[inProgramIndex].Stages[inStage];
+  uint8_t lvBucket = Profiler_Bucket(inDurationUs);
+  if (lvData->Histogram[lvBucket] < 0xFFFF)
+  {
+    lvData->Histogram[lvBucket]++;
+  }
+  if (inDurationUs > lvData->MaxUs)
+  {
+    lvData->MaxUs = inDurationUs;
+  }
+}
+
+void Profiler_RecordFrame(int8_t inProgramIndex, unsigned long inTargetPeriodUs)
+{
+  if ((inProgramIndex < 0) || (inProgramIndex >= PROFILER_MAX_PROGRAMS))
+  {
+    return;
+  }
+  if (s_Programs[inProgramIndex].Frames < 0xFFFF)
+  {
+    s_Programs[inProgramIndex].Frames++;
+  }
+  s_Programs[inProgramIndex].TargetPeriodUs = inTargetPeriodUs;
+}
+
+// Returns false if the program did not run in the current window
+bool Profiler_GetSummary(uint8_t inProgramIndex, ProfilerSummary *outSummary)
+{
+  if ((inProgramIndex >= PROFILER_MAX_PROGRAMS) || (s_Programs[inProgramIndex].Frames == 0))
+  {
+    return false;
+  }
+  const ProfilerProgramData *lvData = &s_Programs[inProgramIndex];
+  unsigned long lvWindowMs = millis() - s_WindowStartMs;
+
+  outSummary->Frames = lvData->Frames;
+  outSummary->Fps = (lvWindowMs > 0) ? ((1000.0f * lvData->Frames) / lvWindowMs) : 0;
+  outSummary->TargetFps = (lvData->TargetPeriodUs > 0) ? (1000000.0f / lvData->TargetPeriodUs) : 0;
+  for (uint8_t s = 0; s < PROFILER_NUM_STAGES; s++)
+  {
+    outSummary->Stages[s].P50Us = Profiler_Percentile(&lvData->Stages[s], lvData->Frames, 50);
+    outSummary->Stages[s].P99Us = Profiler_Percentile(&lvData->Stages[s], lvData->Frames, 99);
+    outSummary->Stages[s].MaxUs = lvData->Stages[s].MaxUs;
+  }
+  return true;
+}
+
+// Clear all histograms, summaries cover the time since the last call
+void Profiler_StartWindow()
+{
+  memset(s_Programs, 0, sizeof(s_Programs));
+  s_WindowStartMs = millis();
+}
+
+void Profiler_Print()
+{
+  ProfilerSummary lvSummary;
+  for (uint8_t i = 0; i < g_NumPrograms; i++)
+  {
+    if (Profiler_GetSummary(i, &lvSummary))
+    {
+      Serial.print(g_ProgramRegistry[i].Name);
+      Serial.print(F(": Frames: "));
+      Serial.print(lvSummary.Frames);
+      Serial.print(F("; Fps: "));
+      Serial.print(lvSummary.Fps);
+      Serial.print(F("/"));
+      Serial.print(lvSummary.TargetFps);
+      for (uint8_t s = 0; s < PROFILER_NUM_STAGES; s++)
+      {
+        Serial.print((s == PROFILER_STAGE_UPDATE) ? F("; Update: ") : F("; Show: "));
+        Serial.print(lvSummary.Stages[s].P50Us);
+        Serial.print(F("/"));
+        Serial.print(lvSummary.Stages[s].P99Us);
+        Serial.print(F("/"));
+        Serial.print(lvSummary.Stages[s].MaxUs);
+      }
+      Serial.println();
+    }
+  }
+}
+
+/*** PRIVATE FUNCTIONS ***/
+
+// Bucket 2k holds [2^k, 1.5*2^k), bucket 2k+1 holds [1.5*2^k, 2^(k+1))
+static uint8_t Profiler_Bucket(unsigned long inDurationUs)
+{
+  if (inDurationUs < 2)
+  {
+    return inDurationUs;
+  }
+  uint8_t lvLog2 = 31 - __builtin_clzl(inDurationUs);
+  uint8_t lvBucket = (lvLog2 << 1) | ((inDurationUs >> (lvLog2 - 1)) & 1);
+  if (lvBucket >= PROFILER_BUCKETS)
+  {
+    lvBucket = PROFILER_BUCKETS - 1;
+  }
+  return lvBucket;
+}
+
+// Upper limit of a bucket, used as the percentile estimate
+static unsigned long Profiler_BucketLimit(uint8_t inBucket)
+{
+  if (inBucket < 2)
+  {
+    return inBucket + 1;
+  }
+  uint8_t lvLog2 = inBucket >> 1;
+  if (inBucket & 1)
+  {
+    return 1UL << (lvLog2 + 1);
+  }
+  return 3UL << (lvLog2 - 1);
+}
+
+static unsigned long Profiler_Percentile(const ProfilerStageData *inData, uint16_t inCount, uint8_t inPercent)
+{
+  unsigned long lvRank = ((unsigned long)inCount * inPercent + 99) / 100;
+  unsigned long lvSum = 0;
+  for (uint8_t b = 0; b < PROFILER_BUCKETS; b++)
+  {
+    lvSum += inData->Histogram[b];
+    if (lvSum >= lvRank)
+    {
+      // never report more than the measured maximum
+      return min(Profiler_BucketLimit(b), inData->MaxUs);
+    }
+  }
+  return inData->MaxUs;
+}
+
+#endif //ENABLE_PROFILER
@@ -0,0 +1,48 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+/*** INCLUDES ***/
+#include "Settings.h"
+
+/*** DEFINES ***/
+#define PROFILER_BUCKETS          32      // 2 buckets per power of 2 [us], last bucket collects everything >= 48ms
+
+#ifdef ENABLE_PROFILER
+  #define PROFILER_START(tim)                 unsigned long tim = micros();
+  #define PROFILER_LAP(tim, prog, stage)      { unsigned long lvLapUs = micros(); Profiler_Record(prog, stage, lvLapUs - tim); tim = lvLapUs; }
+#else
+  #define PROFILER_START(tim)
+  #define PROFILER_LAP(tim, prog, stage)
+#endif //ENABLE_PROFILER
+
+/*** TYPE DEFINITIONS ***/
+typedef enum
+{
+  PROFILER_STAGE_UPDATE,                  // CLEDProgram::Update()
+  PROFILER_STAGE_SHOW,                    // pixel mapping and handing the frame to the strip
+  PROFILER_NUM_STAGES
+} ProfilerStage;
+
+typedef struct
+{
+  unsigned long P50Us;
+  unsigned long P99Us;
+  unsigned long MaxUs;
+} ProfilerStageSummary;
+
+typedef struct
+{
+  uint16_t Frames;
+  float Fps;                              // achieved frame rate
+  float TargetFps;                        // frame rate requested from the scheduler, 0 for NoDelay programs
+  ProfilerStageSummary Stages[PROFILER_NUM_STAGES];
+} ProfilerSummary;
+
+/*** PUBLIC FUNCTIONS ***/
+void Profiler_Record(int8_t inProgramIndex, ProfilerStage inStage, unsigned long inDurationUs);
+void Profiler_RecordFrame(int8_t inProgramIndex, unsigned long inTargetPeriodUs);
+bool Profiler_GetSummary(uint8_t inProgramIndex, ProfilerSummary *outSummary);
+void Profiler_StartWindow(void);
+void Profiler_Print(void);
+
+#endif //PROFILER_H
@@ -1,63 +1,51 @@
 #include "Programs.h"
 #include "Settings.h"
 
-#define BUBBLE_SIZE           9
-#define MAX_BUBBLES           (DEFAULT_NUM_LEDS / 15)
-#define BUBBLES_DECAY         100
-#define BUBBLES_THRESHOLD     85
-
-static int s_BubblePos[MAX_BUBBLES];
-static unsigned long s_LastBubbleTime = 0;
+#define BUBBLES_THRESHOLD     85      // dimmest bubble
+#define BUBBLE_SPAWN_CHANCE   32      // chance (out of 256) for a new bubble per step
+#define BUBBLE_MIN_SPEED      192     // 1/256 LED per step
+#define BUBBLE_FADE           1       // per step while rising
+#define BUBBLE_PARTICLES      48
 
 bool Program_Bubble::Start()
 {
   fill_solid(g_LEDS, NUM_LEDS, CRGB(0,0,0));
- // BaseHue = g_GlobalSettings.Hue;
-  return true;
+  PrevSeconds = 99;
+  uint16_t lvCapacity = Particles_Capacity(BUBBLE_PARTICLES, NUM_LEDS);
+  Pool = Particles_Init(AllocState(Particles_StateSize(lvCapacity)), lvCapacity, NUM_LEDS);
+  return (Pool != NULL);
 }
 
-bool Program_Bubble::Update()
+bool Program_Bubble::Update(unsigned long inElapsedUs)
 {
-  //fadeToBlackBy(g_LEDS, NUM_LEDS, BUBBLES_DECAY);
-
-  // build pressure
-  for (int m = 0; m < BUBBLE_SIZE; m++)
-  {   
-     g_LEDS[m] += CHSV(g_GlobalSettings.Hue, 128, random8(BUBBLES_DECAY)+1);
-//     if (m > 1)
-//     {
-//      g_LEDS[m].r /= 10;
-//      g_LEDS[m].g /= 10;
-//      g_LEDS[m].b /= 10;
-//      g_LEDS[m-1].r -= g_LEDS[m-1].r / 10;
-//      g_LEDS[m-1].g -= g_LEDS[m-1].g / 10;
-//      g_LEDS[m-1].b -= g_LEDS[m-1].b / 10;
-//     }
+  uint16_t lvSteps = TakeSteps(inElapsedUs, MAX_STEPS_PER_UPDATE);
+  if (Pool == NULL)
+  {
+    return true;
   }
-  for (int i = NUM_LEDS-1; i >= 0; i--)
-  {   
-    if ((i > 0) && ((g_LEDS[i-1].r > BUBBLES_THRESHOLD) || (g_LEDS[i-1].g > BUBBLES_THRESHOLD) || (g_LEDS[i-1].b > BUBBLES_THRESHOLD)))
-    {
-      // bubble up
-      g_LEDS[i] |= g_LEDS[i-1];
-      g_LEDS[i-1].fadeToBlackBy(BUBBLES_DECAY);
-    }
-    else
+
+  // bubbles rise at their own speed until they leave the top of the strip
+  Particles_Clear(Pool, g_LEDS);
+  Particles_Integrate(Pool, lvSteps);
+  Particles_Fade(Pool, lvSteps, NULL);
+  while (lvSteps-- > 0)
+  {
+    if (Random_8(&Rng) < BUBBLE_SPAWN_CHANCE)
     {
-      g_LEDS[i].fadeToBlackBy(BUBBLES_DECAY/2);
+      int16_t lvSpeed = BUBBLE_MIN_SPEED + (Random_8(&Rng) >> 1);
+      Particles_Emit(Pool, 0, lvSpeed, CHSV(g_GlobalSettings.Hue, 128, Random_8Range(&Rng, BUBBLES_THRESHOLD, 255)), BUBBLE_FADE, 0);
     }
   }
-    
+  Particles_Render(Pool, g_LEDS);
   return true;
 }
 
 void Program_Bubble::Variate()
 {
-  uint8_t lvSeconds = (millis() / 1000) % 60;
-  static uint8_t s_PrevSeconds = 99;
-  if (lvSeconds != s_PrevSeconds) 
+  uint8_t lvSeconds = (Clock_Millis() / 1000) % 60;
+  if (lvSeconds != PrevSeconds) 
   {                             
-    s_PrevSeconds = lvSeconds;
+    PrevSeconds = lvSeconds;
     switch(lvSeconds) 
     {
       case 30: 
@@ -11,45 +11,28 @@ bool Program_ColorWipe::Start()
   return true;
 }
 
-bool Program_ColorWipe::Update()
+bool Program_ColorWipe::Update(unsigned long inElapsedUs)
 {
-  uint8_t lvHue;
-  for (int i = StartLED; i < NUM_LEDS; i++)
-  {
-    if (i < WiperPos)
-    {
-      // new color
-      lvHue = g_GlobalSettings.Hue + HueOffset + COLORWIPE_HUE_DELTA; 
-    }
-    else
-    {
-      // previous color
-      lvHue = g_GlobalSettings.Hue + HueOffset;
-    }
-    g_LEDS[i] = CHSV(lvHue, 255, 255);
-  }
-  if (g_GlobalSettings.Reverse)
+  uint16_t lvSteps = TakeSteps(inElapsedUs);
+  uint8_t lvHues[2] = {(uint8_t)(g_GlobalSettings.Hue + HueOffset), (uint8_t)(g_GlobalSettings.Hue + HueOffset + COLORWIPE_HUE_DELTA)};
+  CRGB lvColors[2];             // previous color, new color
+
+  Hsv_FillHues(lvColors, lvHues, 2, 255, 255);
+  uint16_t lvWiped = constrain(WiperPos, 0, NUM_LEDS);
+  fill_solid(g_LEDS, lvWiped, lvColors[1]);
+  fill_solid(&g_LEDS[lvWiped], NUM_LEDS - lvWiped, lvColors[0]);
+  // sub-pixel: the pixel at the wiper position blends into the new color
+  if ((WiperPos >= 0) && (WiperPos < NUM_LEDS))
   {
-    WiperPos--;
-    if (WiperPos < StartLED)
-    {
-      WiperPos = NUM_LEDS-1;
-      if (HueOffset <= (255-COLORWIPE_HUE_DELTA))
-      {
-        HueOffset += COLORWIPE_HUE_DELTA;
-      }
-      else
-      {
-        HueOffset = COLORWIPE_HUE_DELTA;
-      }
-    }
+    g_LEDS[WiperPos] = blend(lvColors[0], lvColors[1], StepFraction());
   }
-  else
+
+  while (lvSteps-- > 0)
   {
     WiperPos++;
     if (WiperPos >= NUM_LEDS)
     {
-      WiperPos = StartLED;
+      WiperPos = 0;
       if (HueOffset <= (255-COLORWIPE_HUE_DELTA))
       {
         HueOffset += COLORWIPE_HUE_DELTA;
@@ -2,44 +2,96 @@
 #include "Settings.h"
 
 //#define CONFETTI_SATURATION  255
-#define CONFETTI_BRIGHTNESS  255
+#define CONFETTI_PARTICLES   255     // about the lifetime in steps at the slowest fade, one new confetti per step
+                                     // when the pool is full new confetti replaces the dimmest
+#define CONFETTI_BLEND_STEP  4       // palette change per step after a hue change
 
 bool Program_Confetti::Start()
 {
+  fill_solid(g_LEDS, NUM_LEDS, CRGB(0,0,0));
   FadeAmount = 5;
   CurrentHue = g_GlobalSettings.Hue;
   HueRange = 255;
   HueInc = 1;
+  PrevSeconds = 99;
+  // one block: the particle pool followed by the current palette.
+  // The pool grows with the strip, on long strips it takes what is left of the arena.
+  uint16_t lvCapacity = Particles_Capacity(CONFETTI_PARTICLES, NUM_LEDS);
+  uint16_t lvFixedSize = Particles_StateSize(0) + (PALETTE_SIZE * sizeof(CRGB));
+  uint16_t lvMaxSize = MaxStateSize();
+  if (lvMaxSize > lvFixedSize)
+  {
+    lvCapacity = constrain((lvMaxSize - lvFixedSize) / (Particles_StateSize(1) - Particles_StateSize(0)), 1, lvCapacity);
+  }
+  uint16_t lvPoolSize = Particles_StateSize(lvCapacity);
+  uint8_t *lvState = (uint8_t *)AllocState(lvPoolSize + (PALETTE_SIZE * sizeof(CRGB)));
+  Pool = Particles_Init(lvState, lvCapacity, NUM_LEDS);
+  if (Pool == NULL)
+  {
+    return false;
+  }
+  Lut = (CRGB *)(lvState + lvPoolSize);
+  Palette = PALETTE_OCEAN + (g_GlobalSettings.Hue >> 6);
+  memcpy(Lut, Palettes_Get(Palette), PALETTE_SIZE * sizeof(CRGB));
+  Blending = false;
   return true;
 }
 
-bool Program_Confetti::Update()
+bool Program_Confetti::Update(unsigned long inElapsedUs)
 {
-  CRGBPalette16 lvPalletes[] = {OceanColors_p, LavaColors_p, ForestColors_p, RainbowColors_p};
+  uint16_t lvSteps = TakeSteps(inElapsedUs, MAX_STEPS_PER_UPDATE);
+  uint8_t lvIndices[MAX_STEPS_PER_UPDATE];
+  uint16_t lvPositions[MAX_STEPS_PER_UPDATE];
+  CRGB lvColors[MAX_STEPS_PER_UPDATE];
   
-  fadeToBlackBy(g_LEDS, NUM_LEDS, FadeAmount);                // Low values = slower fade.
-  int pos = random16(NUM_LEDS);                               // Pick an LED at random.
-  //g_LEDS[pos] += CHSV((CurrentHue + random16(HueRange))/4 , CONFETTI_SATURATION, CONFETTI_BRIGHTNESS);  
-  g_LEDS[pos] = ColorFromPalette(lvPalletes[g_GlobalSettings.Hue >> 6], CurrentHue + random16(HueRange)/4 , CONFETTI_BRIGHTNESS, LINEARBLEND);
-  CurrentHue += HueInc;                                // It increments here.
+  if (Pool == NULL)
+  {
+    return true;
+  }
+
+  // the hue selects the palette, a new palette is blended in over the next steps
+  uint8_t lvPalette = PALETTE_OCEAN + (g_GlobalSettings.Hue >> 6);
+  if (lvPalette != Palette)
+  {
+    Palette = lvPalette;
+    Blending = true;
+  }
+  if (Blending && (lvSteps > 0))
+  {
+    Blending = !Palettes_Blend(Lut, Palettes_Get(Palette), min(lvSteps * CONFETTI_BLEND_STEP, 255));
+  }
+
+  Particles_Clear(Pool, g_LEDS);
+  Particles_Fade(Pool, lvSteps, NULL);
+  for (uint16_t s = 0; s < lvSteps; s++)
+  {
+    lvPositions[s] = Random_16Range(&Rng, 0, NUM_LEDS);                 // Pick an LED at random.
+    lvIndices[s] = CurrentHue + Random_16Range(&Rng, 0, HueRange)/4;
+    CurrentHue += HueInc;                                               // It increments here.
+  }
+  Palettes_Map(Lut, lvIndices, lvColors, lvSteps);
+  for (uint16_t s = 0; s < lvSteps; s++)
+  {
+    Particles_Emit(Pool, PARTICLE_POS(lvPositions[s]), 0, lvColors[s], FadeAmount, 0);    // Low fade values = slower fade.
+  }
+  Particles_Render(Pool, g_LEDS);
   Variate();
   return true;
 }
 
 void Program_Confetti::Variate()
 {
-  uint8_t lvSeconds = (millis() / 1000) % 60;
-  static uint8_t s_PrevSeconds = 99;
-  if (lvSeconds != s_PrevSeconds) 
+  uint8_t lvSeconds = (Clock_Millis() / 1000) % 60;
+  if (lvSeconds != PrevSeconds) 
   {                             
-    s_PrevSeconds = lvSeconds;
+    PrevSeconds = lvSeconds;
     switch(lvSeconds) 
     {
       case 30: 
-        HueInc = random8(1, 3); 
-        CurrentHue = random8(255); 
-        FadeAmount = random8(3, 8); 
-        HueRange = random8(64, 255);
+        HueInc = Random_8Range(&Rng, 1, 3); 
+        CurrentHue = Random_8Range(&Rng, 0, 255); 
+        FadeAmount = Random_8Range(&Rng, 3, 8); 
+        HueRange = Random_8Range(&Rng, 64, 255);
         break;
     }
   }
@@ -4,7 +4,7 @@
 
 // COOLING: How much does the air cool as it rises?
 // Less cooling = taller flames.  More cooling = shorter flames.
-// Default 50, suggested range 20-100 
+// Default 50, suggested range 20-100
 #define COOLING  8 //55
 
 // SPARKING: What chance (out of 255) is there that a new spark will be lit?
@@ -12,52 +12,125 @@
 // Default 120, suggested range 50-200.
 #define SPARKING 100 //120
 
+#define SPARK_CELLS         7         // sparks are lit in the bottom cells of each flame
+#define NOISE_MUL           40503U    // odd 16 bit multiplier (golden ratio) for the cooling noise hash
 
-#define HEAT_ARRAY_SIZE     50
+// The kernels below are branch-free fixed-point loops over independent cells with separate input and output rows,
+// so they have no loop-carried dependencies and a vectorising compiler can turn them into SIMD code.
 
-static byte s_Heat[HEAT_ARRAY_SIZE];
+/*** PRIVATE FUNCTIONS ***/
+
+// 0..255 without a branch
+static inline uint8_t Fire_Clamp8(int16_t inValue)
+{
+  inValue &= ~(inValue >> 15);                    // below 0: 0
+  inValue |= (int16_t)(255 - inValue) >> 15;      // above 255: all bits set
+  return (uint8_t)inValue;
+}
+
+// Step 1.  Cool down every cell a little, by 0..inMaxCool.
+// The noise is a hash of the cell index and a per step seed, so the cells do not share a sequential random generator.
+static void Fire_Cool(uint8_t *ioHeat, uint16_t inNumCells, uint8_t inMaxCool, uint16_t inSeed)
+{
+  for (uint16_t i = 0; i < inNumCells; i++)
+  {
+    uint16_t lvNoise = (uint16_t)(i * NOISE_MUL + inSeed);
+    lvNoise ^= lvNoise >> 7;
+    lvNoise = (uint16_t)(lvNoise * NOISE_MUL);
+    int16_t lvHeat = ioHeat[i] - (int16_t)(((lvNoise >> 8) * inMaxCool) >> 8);
+    ioHeat[i] = lvHeat & ~(lvHeat >> 15);
+  }
+}
+
+// Step 2.  Heat from each cell drifts 'up' and diffuses a little.
+// (h[k-1] + 2*h[k-2]) / 3, dividing by 3 as *85/256 in 16 bit. The bottom 2 cells of each flame are set by the caller.
+static void Fire_Diffuse(const uint8_t *inHeat, uint8_t *outHeat, uint16_t inNumCells)
+{
+  for (uint16_t k = 2; k < inNumCells; k++)
+  {
+    outHeat[k] = ((uint16_t)(inHeat[k - 1] + inHeat[k - 2] + inHeat[k - 2]) * 85) >> 8;
+  }
+}
+
+/*** CLASS FUNCTIONS ***/
 
 bool Program_Fire::Start()
 {
-  memset(s_Heat, 0, sizeof(s_Heat));
+  // two heat rows: the diffusion reads one and writes the other
+  Heat = (uint8_t *)AllocState(2 * NUM_LEDS);
+  if (Heat == NULL)
+  {
+    return false;
+  }
+  Scratch = Heat + NUM_LEDS;
   return true;
 }
 
-bool Program_Fire::Update()
+bool Program_Fire::Update(unsigned long inElapsedUs)
 {
-  // Array of temperature readings at each simulation cell
-  
+  uint16_t lvSteps = TakeSteps(inElapsedUs, MAX_STEPS_PER_UPDATE);
+  if ((lvSteps == 0) || (Heat == NULL))
+  {
+    return true;
+  }
 
-  // Step 1.  Cool down every cell a little
-  for( int i = 0; i < HEAT_ARRAY_SIZE; i++) 
+  while (lvSteps-- > 0)
   {
-    s_Heat[i] = qsub8( s_Heat[i],  random8(0, ((COOLING * 10) / HEAT_ARRAY_SIZE) + 2));
+    uint8_t *lvHeat = Heat;
+    Step(&Rng, Heat, Scratch, NUM_LEDS);
+    Heat = Scratch;
+    Scratch = lvHeat;
   }
 
-  // Step 2.  Heat from each cell drifts 'up' and diffuses a little
-  //for( int k = (NUM_LEDS - 1); k >= 2; k--) 
-  //for( int k = 2; k < (NUM_LEDS-2); k++) 
-  //{
-    //s_Heat[k] = (s_Heat[k - 1] + s_Heat[k - 2] + s_Heat[k] + s_Heat[k + 1] + s_Heat[k + 2]) / 5;
-  //}
-    
-  // Step 3.  Randomly ignite new 'sparks' of heat near the bottom
-  if( random8() < SPARKING ) 
+  // Step 4.  Map from heat cells to LED colors
+  Render(Heat, g_LEDS, NUM_LEDS);
+  return true;
+}
+
+// One simulation step of all flames: cools ioHeat and writes the new heat field to outHeat.
+// The strip holds one flame per FIRE_LEDS_PER_SOURCE LEDs, each rising from its first LED.
+void Program_Fire::Step(RandomStream *ioRandom, uint8_t *ioHeat, uint8_t *outHeat, uint16_t inNumCells)
+{
+  uint16_t lvNumSources = inNumCells / FIRE_LEDS_PER_SOURCE;
+  if (lvNumSources == 0)
+  {
+    lvNumSources = 1;
+  }
+  uint16_t lvFlameLength = inNumCells / lvNumSources;
+  uint8_t lvMaxCool = min(((COOLING * 10) / lvFlameLength) + 2, 255);
+
+  Fire_Cool(ioHeat, inNumCells, lvMaxCool, Random_16(ioRandom));
+  Fire_Diffuse(ioHeat, outHeat, inNumCells);
+
+  for (uint16_t s = 0; s < lvNumSources; s++)
   {
-    int y = random16(HEAT_ARRAY_SIZE);
-    if (s_Heat[y] < 90)
+    uint16_t lvBase = ((uint32_t)s * inNumCells) / lvNumSources;
+    uint16_t lvLength = ((((uint32_t)s + 1) * inNumCells) / lvNumSources) - lvBase;
+
+    // the bottom of the flame does not diffuse, the diffusion above must not cross into the flame below
+    outHeat[lvBase] = ioHeat[lvBase];
+    if (lvLength > 1)
     {
-      s_Heat[y] = qadd8( s_Heat[y], random8(100,150) );
+      outHeat[lvBase + 1] = ioHeat[lvBase + 1];
+    }
+
+    // Step 3.  Randomly ignite new 'sparks' of heat near the bottom
+    if (Random_8(ioRandom) < SPARKING)
+    {
+      uint16_t y = lvBase + Random_8Range(ioRandom, 0, min(lvLength, (uint16_t)SPARK_CELLS));
+      outHeat[y] = qadd8(outHeat[y], Random_8Range(ioRandom, 160, 255));
     }
   }
+}
 
-  // Step 4.  Map from heat cells to LED colors
-  for( int j = 0; j < NUM_LEDS; j++) 
+// HeatColor() as three clamped ramps: black -> red -> yellow -> white
+void Program_Fire::Render(const uint8_t *inHeat, CRGB *outLEDs, uint16_t inNumCells)
+{
+  for (uint16_t i = 0; i < inNumCells; i++)
   {
-    CRGB color = HeatColor( s_Heat[j % HEAT_ARRAY_SIZE]);
-    g_LEDS[j] = color;
+    int16_t lvRamp = ((inHeat[i] * 192) >> 8) << 2;
+    outLEDs[i].r = Fire_Clamp8(lvRamp);
+    outLEDs[i].g = Fire_Clamp8(lvRamp - 256);
+    outLEDs[i].b = Fire_Clamp8(lvRamp - 512);
   }
-
-  blur1d(g_LEDS, NUM_LEDS, 64);  
-  return true;
 }
@@ -4,31 +4,82 @@
 #define JUGGLE_SATURATION  255
 #define JUGGLE_BRIGHTNESS  255
 
-#define JUGGLE_MAX_DOTS     8
+#define JUGGLE_FADE_AMOUNT  20
+#define JUGGLE_PARTICLES    64
+
+// with sound: the dots follow the loudness and change color on every beat
+#define JUGGLE_QUIET_BRIGHTNESS   64
+#define JUGGLE_BEAT_HUE_STEP      32
 
 Program_Juggle::Program_Juggle() : CLEDProgram("Juggle") 
 {
   TicksPerCycle = NUM_LEDS;
+  Pool = NULL;
 }
   
 bool Program_Juggle::Start()
 {
+  fill_solid(g_LEDS, NUM_LEDS, CRGB(0,0,0));
   NumDots = 4;
-  FadeAmount = 20;
-  
-  return true;
+  FadeAmount = JUGGLE_FADE_AMOUNT;
+  for (uint8_t i = 0; i < JUGGLE_MAX_DOTS; i++)
+  {
+    DotLed[i] = 0xFFFF;
+    DotPos[i] = -1;
+  }
+  BeatHue = 0;
+  LastBeats = 0;
+  UseAudio();     // optional, without a capture the dots keep full brightness
+  uint16_t lvCapacity = Particles_Capacity(JUGGLE_PARTICLES, NUM_LEDS);
+  Pool = Particles_Init(AllocState(Particles_StateSize(lvCapacity)), lvCapacity, NUM_LEDS);
+  return (Pool != NULL);
 }
 
-bool Program_Juggle::Update()
+bool Program_Juggle::Update(unsigned long inElapsedUs)
 {
-  // eight colored dots, weaving in and out of sync with each other
-  fadeToBlackBy( g_LEDS, NUM_LEDS, FadeAmount);
-  byte dothue = g_GlobalSettings.Hue;
+  // colored dots, weaving in and out of sync with each other
+  // (dot positions follow the clock, only the trail fade depends on the speed)
+  uint16_t lvSteps = TakeSteps(inElapsedUs);
+  if (Pool == NULL)
+  {
+    return true;
+  }
+  // black out the last frame: the trails and the dots
+  Particles_Clear(Pool, g_LEDS);
+  for (uint8_t i = 0; i < NumDots; i++)
+  {
+    Particles_Erase(g_LEDS, NUM_LEDS, DotPos[i]);
+  }
+  Particles_Fade(Pool, lvSteps, NULL);
+
+  uint8_t lvBrightness = JUGGLE_BRIGHTNESS;
+  AudioBusFrame lvBus;
+  if (AudioBus_Read(&lvBus))
+  {
+    if (lvBus.Beats != LastBeats)
+    {
+      LastBeats = lvBus.Beats;
+      BeatHue += JUGGLE_BEAT_HUE_STEP;
+    }
+    lvBrightness = qadd8(JUGGLE_QUIET_BRIGHTNESS, scale8(lvBus.Level, JUGGLE_BRIGHTNESS - JUGGLE_QUIET_BRIGHTNESS));
+  }
+
+  byte dothue = g_GlobalSettings.Hue + BeatHue;
   for( int i = 0; i < NumDots; i++) 
   {
-    g_LEDS[beatsin16( i+7, 0, NUM_LEDS-1 )] |= CHSV(dothue, g_GlobalSettings.Saturation, JUGGLE_BRIGHTNESS);
+    // sub-pixel position, the dots leave a trail particle on every LED they enter
+    int32_t lvPos = ((uint32_t)beatsin16( i+7 ) * PARTICLE_POS(NUM_LEDS-1)) >> 16;
+    CRGB lvColor = CHSV(dothue, g_GlobalSettings.Saturation, lvBrightness);
+    if (PARTICLE_LED(lvPos) != DotLed[i])
+    {
+      DotLed[i] = PARTICLE_LED(lvPos);
+      Particles_Emit(Pool, PARTICLE_POS(DotLed[i]), 0, lvColor, FadeAmount, 0);
+    }
+    Particles_Splat(g_LEDS, NUM_LEDS, lvPos, lvColor);
+    DotPos[i] = lvPos;
     dothue += 32;
   }
+  Particles_Render(Pool, g_LEDS);
   Variate();
   return true;
 }
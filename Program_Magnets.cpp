@@ -6,398 +6,442 @@
 //#define  MAGNET_DEBUG
 
 #define POSITION_SHIFT      6             // shift factor between magnet position and LED position
-#define LED_POS(idx)        (idx << POSITION_SHIFT)
-#define LED_IDX(pos)        (pos >> POSITION_SHIFT)
-#define MAX_POS             (LED_POS(NUM_LEDS+1)-1)
+#define LED_POS(idx)        ((int32_t)(idx) << POSITION_SHIFT)
+#define LED_IDX(pos)        ((pos) >> POSITION_SHIFT)
+#define VELOCITY_SHIFT      10            // velocity is in pos/tick << VELOCITY_SHIFT, scaling factor empirically chosen to have some decent speed
 
-#define SPAWN_DELAY         40          // delay (ticks) before spawning a new magnet
+#define SPAWN_DELAY         40            // delay (ticks) before spawning a new magnet
+#define SPAWN_SIZE          LED_POS(2)
+#define MIN_SPAWN_GAP       4             // LEDs, when the widest gap is smaller the program restarts
+#define LEDS_PER_MAGNET     50            // number of magnets: one per 50 LEDs, at least 3 and at most MAGNETS_MAX
+#define MIN_MAGNETS         3
+#define NO_MAGNET           0xFF
 
 //#define SIZE_TO_MASS(s)     (s/64)    // determine mass based on size
 #define SIZE_TO_MASS(s)     (2)         // use fixed mass
+#define FORCE_SCALE         (1L << 20)
 
 #define POLARITY_REVERSAL_CHANCE    32    // chance for polarity reversal when 2 magnets collide
 
+#define ALIGN4(n)           (((n) + 3) & ~3)
+
 /*** TYPES ***/
-typedef struct Magnet
+typedef struct
 {
   // Magnet Attributes
-  int       Pos;
-  uint16_t  Size;
-  long      Accelleration;     // pos / tick^2
-  long      Velocity;          // pos / tick
-  uint8_t   Orientation;    // Magnet polarity
-
-  // Magnet Operations
-  void Spawn(int inPos, uint16_t inSize, uint8_t inOrientation)
+  int32_t   Pos;                // left end
+  int32_t   Size;
+  int32_t   Accelleration;      // pos / tick^2
+  int32_t   Velocity;           // pos / tick
+  uint8_t   Orientation;        // Magnet polarity
+  uint8_t   Prev;               // neighbours in position order, NO_MAGNET at the ends of the strip
+  uint8_t   Next;
+} Magnet;
+
+// Simulation state, allocated in the state arena by Start().
+// The magnets are a list in position order. Gaps[s] is the free space left of magnet s, Gaps[Capacity] the space right of
+// the last magnet. Widest[] is a max tree over Gaps[], so the widest gap for a new magnet is found at the root.
+struct MagnetsState
+{
+  uint16_t NumLeds;
+  uint8_t Capacity;
+  uint8_t Count;
+  uint8_t First;
+  uint8_t Last;
+  uint8_t FreeSlot;             // unused slots, linked through Next
+  uint8_t Delay;
+  uint8_t Phase;
+  uint8_t NumLeaves;            // power of 2, > Capacity
+  Magnet *Magnets;              // [Capacity]
+  uint16_t *Gaps;               // [NumLeaves] in LEDs
+  uint8_t *Widest;              // [NumLeaves] node n: gap index of the widest gap below it, root at 1, leaves at NumLeaves+i
+};
+
+enum { STATE_INITIAL, STATE_SPAWN };
+
+/*** PRIVATE FUNCTIONS ***/
+
+static uint8_t Magnets_Capacity(uint16_t inNumLeds)
+{
+  return constrain(inNumLeds / LEDS_PER_MAGNET, MIN_MAGNETS, MAGNETS_MAX);
+}
+
+static uint8_t Magnets_NumLeaves(uint8_t inCapacity)
+{
+  uint8_t lvLeaves = 2;
+  while (lvLeaves <= inCapacity)
   {
-    Pos = inPos; 
-    Size = inSize;
-    Orientation = inOrientation;    
-    Accelleration = 0;
-    Velocity = 0;    
+    lvLeaves <<= 1;
   }
-  
-  void ApplyForce(long inForce)
+  return lvLeaves;
+}
+
+// First LED right of the magnet, 0 for no magnet
+static uint16_t Magnets_End(const MagnetsState *inState, uint8_t inSlot)
+{
+  if (inSlot == NO_MAGNET)
   {
-    long lvMass = SIZE_TO_MASS(Size);
-    if (((LED_IDX(Pos) <= 0) && (inForce < 0)) || ((LED_IDX(Pos+Size) >= (NUM_LEDS-1))) && (inForce > 0))
-    {
-      Accelleration = 0;
-      Velocity = 0;
-    }
-    else
-    {      
-      // Newton's 2nd:
-      // F = m*a
-      // a = F/m
-      long lvNewAccelleration = inForce / lvMass;
-      
-      if (abs(lvNewAccelleration) > abs(Accelleration))
-      {
-        // Only accept new accelleration if it is bigger than the one we already have
-        Accelleration = lvNewAccelleration;
-      }
-    }
+    return 0;
   }
+  return LED_IDX(inState->Magnets[inSlot].Pos + inState->Magnets[inSlot].Size);
+}
+
+// Widest gap below a tree node, a leaf (inNode >= NumLeaves) is its own gap
+static uint8_t Magnets_NodeGap(const MagnetsState *inState, uint16_t inNode)
+{
+  return (inNode >= inState->NumLeaves) ? (inNode - inState->NumLeaves) : inState->Widest[inNode];
+}
 
-  void Print()
+// The widest of the gaps below the two children of a tree node
+static void Magnets_UpdateNode(MagnetsState *inState, uint16_t inNode)
+{
+  uint8_t lvLeft = Magnets_NodeGap(inState, 2 * inNode);
+  uint8_t lvRight = Magnets_NodeGap(inState, (2 * inNode) + 1);
+  inState->Widest[inNode] = (inState->Gaps[lvRight] > inState->Gaps[lvLeft]) ? lvRight : lvLeft;
+}
+
+// Recalculate a gap and its path to the root of the max tree: O(log n)
+static void Magnets_UpdateGap(MagnetsState *inState, uint8_t inGap)
+{
+  int16_t lvStart;
+  int16_t lvEnd;
+
+  if (inGap == inState->Capacity)
   {
-    Serial.print("Pos: ");
-    Serial.print(Pos);
-    Serial.print(" [");
-    Serial.print(LED_IDX(Pos));
-    Serial.print("]; Size: ");
-    Serial.print(Size);
-    Serial.print(" [");
-    Serial.print(LED_IDX(Size));
-    Serial.print("]; Acc: ");
-    Serial.print(Accelleration);
-    Serial.print("; Vel: ");
-    Serial.print(Velocity);
+    lvStart = Magnets_End(inState, inState->Last);
+    lvEnd = inState->NumLeds;
   }
-  
-  void Move()
+  else
   {
-    Velocity += Accelleration;        // v = a*t
-    if (Velocity != 0)
-    {
-      if (Velocity > 0)
-      {
-        Pos += (Velocity >> 10);        // Scaling factor empirically chosen to have some decent speed
-      }
-      else if (Velocity < 0)
-      {
-        Pos -= (abs(Velocity) >> 10);   // Scaling factor empirically chosen to have some decent speed
-      }
-      
-      if (Pos < 0)
-      {
-        // Hit the end stop. Reset accelleration and velocity to 0.
-        Pos = 0;
-        Accelleration = 0;
-        Velocity = 0;
-      }
-      else if ((Pos + Size) > MAX_POS)
-      {
-        // Hit the end stop. Reset accelleration and velocity to 0.
-        Pos = MAX_POS - Size;
-        Accelleration = 0;
-        Velocity = 0;
-      }
-    }
+    lvStart = Magnets_End(inState, inState->Magnets[inGap].Prev);
+    lvEnd = LED_IDX(inState->Magnets[inGap].Pos);
   }
-  
-  void Draw()
+  inState->Gaps[inGap] = max(lvEnd - lvStart, 0);
+
+  for (uint16_t lvNode = (inState->NumLeaves + inGap) >> 1; lvNode > 0; lvNode >>= 1)
   {
-    uint16_t lvLedPos = LED_IDX(Pos);
-    uint16_t lvLedSize = LED_IDX(Size);
-    
-    uint8_t lvHues[] = {g_GlobalSettings.Hue, g_GlobalSettings.Hue - 255/3};
-    
-    for (int i = lvLedPos; i < (lvLedPos + lvLedSize); i++)
+    Magnets_UpdateNode(inState, lvNode);
+  }
+}
+
+// The magnet moved or grew: the gaps left and right of it changed
+static void Magnets_Changed(MagnetsState *inState, uint8_t inSlot)
+{
+  uint8_t lvNext = inState->Magnets[inSlot].Next;
+  Magnets_UpdateGap(inState, inSlot);
+  Magnets_UpdateGap(inState, (lvNext != NO_MAGNET) ? lvNext : inState->Capacity);
+}
+
+// Sum of the forces of all other magnets, attraction for equal orientation and repulsion for reverse polarity.
+// Magnetic force (F) is inversely proportional to the distance (r) between the facing ends: F = 1 / r
+static void Magnets_ApplyForces(MagnetsState *inState)
+{
+  Magnet *lvMagnets = inState->Magnets;
+
+  for (uint8_t i = inState->First; i != NO_MAGNET; i = lvMagnets[i].Next)
+  {
+    lvMagnets[i].Accelleration = 0;
+  }
+  for (uint8_t i = inState->First; i != NO_MAGNET; i = lvMagnets[i].Next)
+  {
+    for (uint8_t j = lvMagnets[i].Next; j != NO_MAGNET; j = lvMagnets[j].Next)
     {
-      if ((i >= 0) && (i < NUM_LEDS))
+      // magnet i is left of magnet j
+      int32_t lvDistance = lvMagnets[j].Pos - (lvMagnets[i].Pos + lvMagnets[i].Size) + LED_POS(1);
+      int32_t lvForce = FORCE_SCALE / max(lvDistance, LED_POS(1));
+      if (lvMagnets[i].Orientation != lvMagnets[j].Orientation)
       {
-        g_LEDS[i] = CHSV(lvHues[(i-lvLedPos+Orientation) % 2], 255, 255);
+        lvForce = -lvForce;
       }
+      lvMagnets[i].Accelleration += lvForce;
+      lvMagnets[j].Accelleration -= lvForce;   // Newton's 3rd
     }
   }
-} Magnet;
+}
 
-/*** PRIVATE FUNCTIONS ***/
-static bool Magnets_Attract(Magnet *inMagnet1, Magnet *inMagnet2)
+// Newton's 2nd: a = F/m, v = a*t. Returns true if the magnet moved.
+static bool Magnets_Move(MagnetsState *inState, Magnet *ioMagnet)
 {
-  if (inMagnet1->Pos > inMagnet2->Pos)
+  int32_t lvMaxPos = LED_POS(inState->NumLeds + 1) - 1;
+  int32_t lvPrevPos = ioMagnet->Pos;
+
+  ioMagnet->Accelleration /= SIZE_TO_MASS(ioMagnet->Size);
+  if (((LED_IDX(ioMagnet->Pos) <= 0) && (ioMagnet->Accelleration < 0)) || ((LED_IDX(ioMagnet->Pos + ioMagnet->Size) >= (inState->NumLeds - 1)) && (ioMagnet->Accelleration > 0)))
+  {
+    // pushed against an end stop
+    ioMagnet->Accelleration = 0;
+    ioMagnet->Velocity = 0;
+  }
+
+  ioMagnet->Velocity += ioMagnet->Accelleration;
+  if (ioMagnet->Velocity > 0)
   {
-    // Swap arguments so Magnet1 is to the left of Magnet2
-    Magnet *lvTemp = inMagnet1;
-    inMagnet1 = inMagnet2;
-    inMagnet2 = lvTemp;
+    ioMagnet->Pos += (ioMagnet->Velocity >> VELOCITY_SHIFT);
+  }
+  else if (ioMagnet->Velocity < 0)
+  {
+    ioMagnet->Pos -= ((-ioMagnet->Velocity) >> VELOCITY_SHIFT);
   }
 
-  // Determine attractive force between the magnets, based on the distance between them.
-  long lvDistance = (long)inMagnet2->Pos - inMagnet1->Pos + inMagnet1->Size;
-  long lvForce = 0;
-  
-  if (lvDistance > 0)
+  if (ioMagnet->Pos < 0)
   {
-    // Magnetic force (F) is inversely proportional to distance squared (r)
-    // F = 1 / (r^2)
-    lvForce = (1L << 20)/(lvDistance /* *lvDistance */ );   // Scaling factor (1 << 30) added to maintain resolution
+    // Hit the end stop. Reset accelleration and velocity to 0.
+    ioMagnet->Pos = 0;
+    ioMagnet->Accelleration = 0;
+    ioMagnet->Velocity = 0;
   }
-  
-  if (inMagnet1->Orientation != inMagnet2->Orientation)
+  else if ((ioMagnet->Pos + ioMagnet->Size) > lvMaxPos)
   {
-    // Magnets have opposite orientation (reverse polarity): repel instead of attract
-    lvForce = -lvForce;
+    // Hit the end stop. Reset accelleration and velocity to 0.
+    ioMagnet->Pos = lvMaxPos - ioMagnet->Size;
+    ioMagnet->Accelleration = 0;
+    ioMagnet->Velocity = 0;
   }
-  
-  inMagnet1->ApplyForce(lvForce);
-  inMagnet2->ApplyForce(-lvForce);  // Newton's 3rd
-  
-  return (lvForce != 0);
+  return (ioMagnet->Pos != lvPrevPos);
 }
 
-static bool Magnets_DetectCollision(Magnet *inMagnet1, Magnet *inMagnet2)
+// Merge the right magnet into the left one and free its slot
+static void Magnets_Merge(MagnetsState *inState, uint8_t inLeft, uint8_t inRight, RandomStream *ioRandom)
 {
-  if (inMagnet1->Pos > inMagnet2->Pos)
+  Magnet *lvLeft = &inState->Magnets[inLeft];
+  Magnet *lvRight = &inState->Magnets[inRight];
+
+  lvLeft->Pos = min(lvLeft->Pos, lvRight->Pos);
+  lvLeft->Size += lvRight->Size;
+  lvLeft->Accelleration = 0;
+  lvLeft->Velocity = 0;
+
+   // chance for polarity reversal
+  if (Random_8(ioRandom) < POLARITY_REVERSAL_CHANCE)
   {
-    // Swap arguments so Magnet1 is to the left of Magnet2
-    Magnet *lvTemp = inMagnet1;
-    inMagnet1 = inMagnet2;
-    inMagnet2 = lvTemp;
+#ifdef MAGNET_DEBUG
+    Serial.println("Polarity Swap!");
+#endif //MAGNET_DEBUG
+
+    lvLeft->Orientation = 1 - lvLeft->Orientation;
   }
-  if (LED_IDX(inMagnet1->Pos + inMagnet1->Size) >= LED_IDX(inMagnet2->Pos))
+
+  lvLeft->Next = lvRight->Next;
+  if (lvRight->Next != NO_MAGNET)
   {
-    // Collision: Clip position of Magnet1
-    inMagnet1->Pos = LED_POS(LED_IDX(inMagnet2->Pos - inMagnet1->Size));
-    if (inMagnet1->Pos < 0)
-    {
-      inMagnet1->Pos = 0;
-    }  
-    return true;
+    inState->Magnets[lvRight->Next].Prev = inLeft;
   }
-  return false;
+  else
+  {
+    inState->Last = inLeft;
+  }
+  lvRight->Next = inState->FreeSlot;
+  inState->FreeSlot = inRight;
+  inState->Count--;
+
+  // a free slot has no gap
+  lvRight->Pos = 0;
+  lvRight->Prev = NO_MAGNET;
+  Magnets_UpdateGap(inState, inRight);
+  Magnets_Changed(inState, inLeft);
 }
 
-static bool Magnets_Merge(Magnet *inMagnet1, Magnet *inMagnet2)
+// Spawn a magnet in the widest gap: O(log n). Returns false if the gap is too small.
+static bool Magnets_Spawn(MagnetsState *inState, RandomStream *ioRandom)
 {
-  inMagnet1->Pos = min(inMagnet1->Pos, inMagnet2->Pos);
-  inMagnet1->Size += inMagnet2->Size;
-  inMagnet1->Accelleration = 0;
-  inMagnet1->Velocity = 0;
-
-  inMagnet2->Pos = -1;
-  inMagnet2->Size = 0;
-  inMagnet2->Accelleration = 0;
-  inMagnet2->Velocity = 0;
-
-   // chance for polarity reversal          
-  if (random8() < POLARITY_REVERSAL_CHANCE)
-  { 
-    uint8_t lvIdx = random(2);
-
-#ifdef MAGNET_DEBUG    
-    Serial.println("Polarity Swap!");    
-#endif //MAGNET_DEBUG
+  uint8_t lvGap = inState->Widest[1];
+  uint16_t lvGapSize = inState->Gaps[lvGap];
+  uint8_t lvRight = (lvGap == inState->Capacity) ? NO_MAGNET : lvGap;      // the gap is left of this magnet
+  uint8_t lvLeft = (lvRight == NO_MAGNET) ? inState->Last : inState->Magnets[lvRight].Prev;
+  uint8_t lvSlot = inState->FreeSlot;
+
+  if ((lvGapSize < MIN_SPAWN_GAP) || (lvSlot == NO_MAGNET))
+  {
+    return false;
+  }
 
-    inMagnet1->Orientation = 1 - inMagnet1->Orientation;
+  // Determine a random location inside the gap
+  uint16_t lvGapStart = Magnets_End(inState, lvLeft);
+  uint16_t lvMagnetIdx = Random_16Range(ioRandom, lvGapStart + 1, lvGapStart + lvGapSize - 2);
+
+  Magnet *lvMagnet = &inState->Magnets[lvSlot];
+  inState->FreeSlot = lvMagnet->Next;
+  lvMagnet->Pos = LED_POS(lvMagnetIdx);
+  lvMagnet->Size = SPAWN_SIZE;
+  lvMagnet->Orientation = Random_8(ioRandom) & 1;    // randomize magnet orientation
+  lvMagnet->Accelleration = 0;
+  lvMagnet->Velocity = 0;
+
+  // insert between the magnets around the gap, which keeps the list in position order
+  lvMagnet->Prev = lvLeft;
+  lvMagnet->Next = lvRight;
+  if (lvLeft != NO_MAGNET)
+  {
+    inState->Magnets[lvLeft].Next = lvSlot;
+  }
+  else
+  {
+    inState->First = lvSlot;
   }
+  if (lvRight != NO_MAGNET)
+  {
+    inState->Magnets[lvRight].Prev = lvSlot;
+  }
+  else
+  {
+    inState->Last = lvSlot;
+  }
+  inState->Count++;
+  Magnets_Changed(inState, lvSlot);
+
+#ifdef MAGNET_DEBUG
+  Serial.print("Spawn Magnet @ LED ");
+  Serial.println(lvMagnetIdx);
+#endif //MAGNET_DEBUG
   return true;
 }
 
-/*** STATIC VARIABLES ***/
-static Magnet s_Magnets[3];
-static uint8_t s_MagnetCount = 0;
-static uint8_t s_Delay = 0;
-enum { STATE_INITIAL, STATE_SPAWN, STATE_ATTRACT} s_State;
-
 /*** CLASS FUNCTIONS ***/
-Program_Magnets::Program_Magnets() : CLEDProgram("Magnets") 
+Program_Magnets::Program_Magnets() : CLEDProgram("Magnets")
 {
   TicksPerCycle = NUM_LEDS;
+  State = NULL;
 }
-  
+
 bool Program_Magnets::Start()
 {
-  s_State = STATE_INITIAL;
+  State = (MagnetsState *)AllocState(StateSize(NUM_LEDS));
+  if (State == NULL)
+  {
+    return false;
+  }
+  Init(State, NUM_LEDS);
+  return true;
+}
+
+bool Program_Magnets::Update(unsigned long inElapsedUs)
+{
+  uint16_t lvSteps = TakeSteps(inElapsedUs, MAX_STEPS_PER_UPDATE);
+  if ((lvSteps == 0) || (State == NULL))
+  {
+    return true;
+  }
+  while (lvSteps-- > 0)
+  {
+    Step(State, &Rng);
+  }
+  Draw(State, g_LEDS);
   return true;
 }
 
+// Bytes of state for a strip of inNumLeds LEDs
+uint16_t Program_Magnets::StateSize(uint16_t inNumLeds)
+{
+  uint8_t lvCapacity = Magnets_Capacity(inNumLeds);
+  uint8_t lvLeaves = Magnets_NumLeaves(lvCapacity);
+  return ALIGN4(sizeof(MagnetsState)) + (lvCapacity * sizeof(Magnet)) + (lvLeaves * sizeof(uint16_t)) + lvLeaves;
+}
 
-bool Program_Magnets::Update()
+// Empty strip, outState points to StateSize(inNumLeds) bytes
+void Program_Magnets::Init(MagnetsState *outState, uint16_t inNumLeds)
 {
-  bool lvIdle = true;
-  
-  // clear all LEDs
-  fill_solid(g_LEDS, NUM_LEDS, CRGB(0,0,0));
-  
-  if (s_MagnetCount > 0)
+  uint8_t *lvMemory = (uint8_t *)outState;
+
+  outState->NumLeds = inNumLeds;
+  outState->Capacity = Magnets_Capacity(inNumLeds);
+  outState->NumLeaves = Magnets_NumLeaves(outState->Capacity);
+  outState->Magnets = (Magnet *)(lvMemory + ALIGN4(sizeof(MagnetsState)));
+  outState->Gaps = (uint16_t *)&outState->Magnets[outState->Capacity];
+  outState->Widest = (uint8_t *)&outState->Gaps[outState->NumLeaves];
+
+  outState->Count = 0;
+  outState->First = NO_MAGNET;
+  outState->Last = NO_MAGNET;
+  outState->FreeSlot = 0;
+  for (uint8_t i = 0; i < outState->Capacity; i++)
   {
-    for (int i = 0; i < s_MagnetCount; i++)
-    {
-      // Move magnet according to it's velocity and accelleration
-      s_Magnets[i].Move();
-      
-      if (i < (s_MagnetCount - 1))
-      {
-        // Calculate magnetic attraction force between 2 adjacent magnets
-        Magnets_Attract(&s_Magnets[i], &s_Magnets[i+1]);
+    outState->Magnets[i].Next = ((i + 1) < outState->Capacity) ? (i + 1) : NO_MAGNET;
+  }
+  // all free space is right of the (missing) last magnet
+  memset(outState->Gaps, 0, outState->NumLeaves * sizeof(uint16_t));
+  for (uint16_t lvNode = outState->NumLeaves - 1; lvNode > 0; lvNode--)
+  {
+    Magnets_UpdateNode(outState, lvNode);
+  }
+  Magnets_UpdateGap(outState, outState->Capacity);
 
-        //Determine if magnets have collided
-        if (Magnets_DetectCollision(&s_Magnets[i], &s_Magnets[i+1]))
-        {
-          // When magnets collide, merge them into one bigger magnet          
-          Magnets_Merge(&s_Magnets[i], &s_Magnets[i+1]);
-          
-          if (i < (s_MagnetCount - 2))
-          {
-            // magnet was removed from middle of array, shift the right side of the array to fill the gap
-            s_Magnets[i+1] = s_Magnets[i+2];
-          }
-          s_MagnetCount--;
-        }
-      }
-      
-      if (s_Magnets[i].Velocity != 0)
-      {
-        // magnet is still moving, not idle
-        lvIdle = false;
-      }
-      
-      // update LEDs, based on magnet position and size
-      s_Magnets[i].Draw();
+  outState->Delay = 0;
+  outState->Phase = STATE_SPAWN;
+}
 
-#ifdef MAGNET_DEBUG
-        Serial.print("Magnet[");
-        Serial.print(i);
-        Serial.print("]: ");
-        s_Magnets[i].Print();
-        Serial.print(";  ");
-#endif //MAGNET_DEBUG        
-    }    
-#ifdef MAGNET_DEBUG    
-     Serial.println();
-#endif //MAGNET_DEBUG     
+// One simulation step: forces, move, collide and spawn. Returns the number of magnets.
+uint8_t Program_Magnets::Step(MagnetsState *ioState, RandomStream *ioRandom)
+{
+  Magnet *lvMagnets = ioState->Magnets;
+
+  Magnets_ApplyForces(ioState);
+  for (uint8_t i = ioState->First; i != NO_MAGNET; i = lvMagnets[i].Next)
+  {
+    // Move magnet according to it's velocity and accelleration
+    if (Magnets_Move(ioState, &lvMagnets[i]))
+    {
+      Magnets_Changed(ioState, i);
+    }
   }
 
-  switch (s_State)
+  // Determine if magnets have collided
+  uint8_t i = ioState->First;
+  while (i != NO_MAGNET)
+  {
+    uint8_t lvNext = lvMagnets[i].Next;
+    if ((lvNext != NO_MAGNET) && (Magnets_End(ioState, i) >= LED_IDX(lvMagnets[lvNext].Pos)))
+    {
+      // When magnets collide, merge them into one bigger magnet, which can collide with the next one
+      Magnets_Merge(ioState, i, lvNext, ioRandom);
+    }
+    else
+    {
+      i = lvNext;
+    }
+  }
+
+  switch (ioState->Phase)
   {
     case STATE_INITIAL:
-      s_MagnetCount = 0;
-      s_Delay = 0;
-      s_State = STATE_SPAWN;
+      Init(ioState, ioState->NumLeds);
       break;
     case STATE_SPAWN:
-      if (s_Delay-- == 0)
+      if (ioState->Delay-- == 0)
       {
-        if (s_MagnetCount < 3)
+        if (ioState->Count < ioState->Capacity)
         {
-          // find largest open section
-          uint16_t lvOpenSectionStart = 0;
-          uint16_t lvOpenSectionSize = 0;
-          for (int i = 0; i < NUM_LEDS; i++)
-          {
-            uint16_t lvCurrentSectionStart = i;
-            uint16_t lvCurrentSectionSize = 0;
-            while ((!g_LEDS[i]) && (i < NUM_LEDS))
-            {
-              // empty position
-              lvCurrentSectionSize++;
-              i++;
-            }
-            if ((lvCurrentSectionSize > 0) && (lvCurrentSectionSize > lvOpenSectionSize))
-            {
-              // keep track of largest found section
-              lvOpenSectionStart = lvCurrentSectionStart;
-              lvOpenSectionSize = lvCurrentSectionSize;
-            }
-          }
-          
-          if (lvOpenSectionSize < 4)
-          {
-             // largest section is too small. Restart program.
-             s_State = STATE_INITIAL;
-             break;
-          }
-
-          // Determine a random location inside the open section
-          uint16_t lvMagnetIdx = random8(lvOpenSectionStart+1, lvOpenSectionStart+lvOpenSectionSize-2);          
-
-          // To maintain order in the s_Magnets array we determine the position where to insert the new magnet, based on its position.
-          uint8_t lvArrayIdx = s_MagnetCount;
-          if (s_MagnetCount > 0)
+          if (!Magnets_Spawn(ioState, ioRandom))
           {
-            for (int i = 0; i < s_MagnetCount; i++)
-            {
-              if (LED_POS(lvMagnetIdx) < s_Magnets[i].Pos)
-              {
-                lvArrayIdx = i;
-                // shift rest of array
-                for (int j = s_MagnetCount; j > lvArrayIdx; j--)
-                {
-                  s_Magnets[j] = s_Magnets[j-1];
-                }
-                break;
-              }
-            }            
-          }
-
-          // Spawn magnet
-          s_Magnets[lvArrayIdx].Spawn(LED_POS(lvMagnetIdx), LED_POS(2), random(2));   // randomize magnet orientation
-          s_MagnetCount++;
-
-#ifdef MAGNET_DEBUG  
-          Serial.print("Spawn Magnet @ Array Index ");
-          Serial.print(lvArrayIdx);
-          Serial.print(" -> ");
-          s_Magnets[lvArrayIdx].Print();
-          Serial.println();
-#endif //MAGNET_DEBUG  
-  
-//          if (s_MagnetCount > 1)
-//          {
-//            s_State = STATE_ATTRACT;
-//          }
-//          else
-          {
-            // Only one magnet: spawn another one
-            s_Delay = random(10,SPAWN_DELAY+10);
-            s_State = STATE_SPAWN;
+            // widest gap is too small. Restart program.
+            ioState->Phase = STATE_INITIAL;
+            break;
           }
+          ioState->Delay = Random_8Range(ioRandom, 10, SPAWN_DELAY+10);
         }
       }
       break;
-//    case STATE_ATTRACT:
-//      if ((s_MagnetCount < 2))
-//      {
-//        // Less than 2 magnets: spawn another one
-//        s_Delay = SPAWN_DELAY;
-//        s_State = STATE_SPAWN;
-//      }
-//      else
-//      {
-//        s_Delay = SPAWN_DELAY+30;
-//        s_State = STATE_SPAWN;
-        // 2 or more magnets: wait for motion to stop
-//        if (lvIdle)
-//        {
-//          if (s_Delay == 0)
-//          {
-//            s_Delay = SPAWN_DELAY;
-//            s_State = STATE_SPAWN;
-//          }
-//          else
-//          {
-//            s_Delay--;
-//          }
-//        }
-//        else
-//        {
-//          s_Delay = 10;
-//        }
-//      }
-//      break;
   }
-  return true;
+  return ioState->Count;
+}
+
+// Magnets in alternating colors on a dark strip
+void Program_Magnets::Draw(const MagnetsState *inState, CRGB *outLEDs)
+{
+  uint8_t lvHues[] = {g_GlobalSettings.Hue, (uint8_t)(g_GlobalSettings.Hue - 255/3)};
+  CRGB lvColors[2];
+
+  Hsv_FillHues(lvColors, lvHues, 2, 255, 255);
+
+  fill_solid(outLEDs, inState->NumLeds, CRGB(0,0,0));
+  for (uint8_t m = inState->First; m != NO_MAGNET; m = inState->Magnets[m].Next)
+  {
+    const Magnet *lvMagnet = &inState->Magnets[m];
+    uint16_t lvLedPos = LED_IDX(lvMagnet->Pos);
+    uint16_t lvLedEnd = min(Magnets_End(inState, m), inState->NumLeds);
+
+    for (uint16_t i = lvLedPos; i < lvLedEnd; i++)
+    {
+      outLEDs[i] = lvColors[(i - lvLedPos + lvMagnet->Orientation) % 2];
+    }
+  }
 }
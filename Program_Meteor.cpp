@@ -4,6 +4,20 @@
 #define METEOR_DISTANCE   50
 #define METEOR_HUE_SHIFT  64
 #define METEOR_RANGE      (NUM_LEDS+20)
+#define METEOR_PARTICLES  48            // trail particles per meteor, a trail fades out in about 40 steps
+
+static int Meteor_WrapPos(int inPos)
+{
+  if (inPos < 0)
+  {
+    inPos = METEOR_RANGE - inPos;
+  }
+  else if (inPos > METEOR_RANGE)
+  {
+    inPos -= METEOR_RANGE;
+  }
+  return inPos;
+}
 
 Program_Meteor::Program_Meteor() : CLEDProgram("Meteor")
 {
@@ -11,19 +25,18 @@ Program_Meteor::Program_Meteor() : CLEDProgram("Meteor")
   TicksPerCycle = METEOR_RANGE;
   if (VariateEnabled)
   {
-    if (random(2))
+    if (Random_8(&Rng) & 1)
     {
       Direction = -Direction;
     }
-    MeteorSize = random8(5,10);
-    BaseHue = random8(255);
-    MeteorCount = random8(1, NUM_LEDS/30);
+    MeteorSize = Random_8Range(&Rng, 5, 10);
+    BaseHue = Random_8Range(&Rng, 0, 255);
+    MeteorCount = Random_8Range(&Rng, 1, NUM_LEDS/30);
   }
 }
 
 bool Program_Meteor::Start()
 {
-  fill_solid(g_LEDS, NUM_LEDS, CRGB(0,0,0));
   BaseHue = g_GlobalSettings.Hue;
   RandomDecay = true;
   TrailDecay = 64;
@@ -31,88 +44,99 @@ bool Program_Meteor::Start()
   MeteorCount = 1;
   MeteorPos = 0;
   Direction = 1;
-  return true;
+  PrevSeconds = 99;
+  // the meteors leave a particle on every LED they pass, the particles form the trail
+  uint16_t lvCapacity = Particles_Capacity(METEOR_PARTICLES * (VariateEnabled ? max(NUM_LEDS/30, 1) : MeteorCount), NUM_LEDS);
+  Pool = Particles_Init(AllocState(Particles_StateSize(lvCapacity)), lvCapacity, NUM_LEDS);
+  fill_solid(g_LEDS, NUM_LEDS, CRGB(0,0,0));
+  return (Pool != NULL);
 }
 
-bool Program_Meteor::Update()
+bool Program_Meteor::Update(unsigned long inElapsedUs)
 {
-  // fade brightness all LEDs one step
-  if (RandomDecay)
+  uint16_t lvSteps = TakeSteps(inElapsedUs, MAX_STEPS_PER_UPDATE);
+  bool lvCycleDone = false;
+
+  if (Pool == NULL)
   {
-    for(int j=0; j<NUM_LEDS; j++) 
+    return true;
+  }
+
+  // black out the last frame: the trails and the heads, before Variate() can move the heads
+  Particles_Clear(Pool, g_LEDS);
+  for (int m = 0; m < MeteorCount; m++)
+  {
+    int lvPos = Meteor_WrapPos(MeteorPos-(m*METEOR_DISTANCE*Direction));
+    if( (lvPos < NUM_LEDS) && (lvPos >= 0) )
     {
-      if(g_LEDS[j] && (random(2)))
-      {
-        g_LEDS[j].fadeToBlackBy( TrailDecay );
-      }
+      g_LEDS[lvPos] = CRGB(0,0,0);
     }
   }
-  else
+  if (VariateEnabled)
   {
-    fadeToBlackBy(g_LEDS, NUM_LEDS, TrailDecay);
+    Variate();
   }
-  
-  // draw meteor(s)
-  for (int m = 0; m < MeteorCount; m++)
-  {   
-    for(int j = 0; j < MeteorSize; j++) 
-    {
-      int lvPos = MeteorPos-(m*METEOR_DISTANCE*Direction)-(j*Direction);
-      if (lvPos < 0)
-      {
-        lvPos = METEOR_RANGE - lvPos;
-      }
-      else if (lvPos > METEOR_RANGE)
-      {
-        lvPos -= METEOR_RANGE;
-      }
+
+  while (lvSteps-- > 0)
+  {
+    // fade the trails one step
+    Particles_Fade(Pool, 1, RandomDecay ? &Rng : NULL);
+    
+    // meteor(s) leave a particle at full brightness for the length of their body
+    for (int m = 0; m < MeteorCount; m++)
+    {   
+      int lvPos = Meteor_WrapPos(MeteorPos-(m*METEOR_DISTANCE*Direction));
       if( (lvPos < NUM_LEDS) && (lvPos >= 0) )
       {
-        g_LEDS[lvPos] = CHSV(g_GlobalSettings.Hue + (m * METEOR_HUE_SHIFT), 255, 255);
+        Particles_Emit(Pool, PARTICLE_POS(lvPos), 0, CHSV(g_GlobalSettings.Hue + (m * METEOR_HUE_SHIFT), 255, 255), TrailDecay, MeteorSize - 1);
       }
     }
-  }
-  if (g_GlobalSettings.Reverse)
-  {
-     MeteorPos -= Direction;
-  }
-  else
-  {
     MeteorPos += Direction;
+    
+    if (MeteorPos < 0)
+    {
+      MeteorPos = METEOR_RANGE;
+    }
+    else if (MeteorPos > METEOR_RANGE)
+    {
+      MeteorPos = 0;
+    }
+    if (MeteorPos == 0)
+    {
+      lvCycleDone = true;
+    }
   }
-  
-  if (MeteorPos < 0)
-  {
-    MeteorPos = METEOR_RANGE;
-  }
-  else if (MeteorPos > METEOR_RANGE)
-  {
-    MeteorPos = 0;
-  }
-  if (VariateEnabled)
-  {
-    Variate();
+
+  Particles_Render(Pool, g_LEDS);
+
+  // sub-pixel: fade in the pixel each meteor head moves into next
+  for (int m = 0; m < MeteorCount; m++)
+  {   
+    int lvPos = Meteor_WrapPos(MeteorPos-(m*METEOR_DISTANCE*Direction));
+    if( (lvPos < NUM_LEDS) && (lvPos >= 0) )
+    {
+      g_LEDS[lvPos] = CHSV(g_GlobalSettings.Hue + (m * METEOR_HUE_SHIFT), 255, StepFraction());
+    }
   }
-  return (MeteorPos == 0);
+  return lvCycleDone;
 }
 
 void Program_Meteor::Variate()
 {
-  uint8_t lvSeconds = (millis() / 1000) % 60;
-  static uint8_t s_PrevSeconds = 99;
-  if (lvSeconds != s_PrevSeconds) 
+  uint8_t lvSeconds = (Clock_Millis() / 1000) % 60;
+  if (lvSeconds != PrevSeconds) 
   {                             
-    s_PrevSeconds = lvSeconds;
+    PrevSeconds = lvSeconds;
     switch(lvSeconds) 
     {
       case 30: 
-        if (random(2))
+        if (Random_8(&Rng) & 1)
         {
           Direction = -Direction;
         }
-        MeteorSize = random8(5,10);
-        BaseHue = random8(255);
-        MeteorCount = random8(1, NUM_LEDS/30);
+        MeteorSize = Random_8Range(&Rng, 5, 10);
+        BaseHue = Random_8Range(&Rng, 0, 255);
+        MeteorCount = Random_8Range(&Rng, 1, NUM_LEDS/30);
         break;
     }
   }
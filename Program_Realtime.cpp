@@ -0,0 +1,52 @@
+#include "Programs.h"
+#include "Settings.h"
+#include "Realtime.h"
+#include "E131Frame.h"
+
+#ifdef INCLUDE_PROGRAM_REALTIME
+
+static_assert(E131_UNIVERSE_COUNT <= E131_FRAME_MAX_UNIVERSES, "Too many universes for E131Frame");
+
+
+bool Program_Realtime::Start()
+{
+  // packets are stored in a frame buffer, g_LEDS only gets complete frames
+  Output.Frame = (uint8_t *)AllocState(NUM_LEDS * 3);
+  if (Output.Frame == NULL)
+  {
+    return false;
+  }
+  Output.FrameBytes = NUM_LEDS * 3;
+  Output.LEDs = g_LEDS;
+
+  if (Realtime_Begin())
+  {
+      Serial.println(F("Listening for data..."));
+      Serial.printf("\nE131_UNIVERSE_START: %d\nE131_UNIVERSE_COUNT: %d\nE131_CHANNEL_START: %d\n", E131_UNIVERSE_START, E131_UNIVERSE_COUNT, E131_CHANNEL_START);
+  }
+  else
+  {
+    Serial.println(F("*** Realtime_Begin failed ***"));
+    return false;
+  }
+
+  return true;
+}
+
+bool Program_Realtime::Stop()
+{
+  Realtime_Stop();
+  return CLEDProgram::Stop();
+}
+
+// Drains all received packets, a frame is copied to g_LEDS when it is complete, synced, pushed or timed out
+bool Program_Realtime::Update(unsigned long)
+{
+  if (Output.Frame != NULL)
+  {
+    Realtime_Drain(&Output);
+  }
+  return true;
+}
+
+#endif //INCLUDE_PROGRAM_REALTIME
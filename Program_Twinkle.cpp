@@ -2,98 +2,131 @@
 #include "Settings.h"
 
 
-#define LED_SET_BRIGHTENING(l)   {l.r &= ~0x01;l.g &= ~0x01;l.b |=  0x01;}
-#define LED_SET_DIMMING(l)       {l.r |=  0x01;l.g &= ~0x01;l.b &= ~0x01;}
-#define LED_SET_IDLE(l)          {l.r &= ~0x01;l.g &= ~0x01;l.b &= ~0x01;}
-
-#define LED_IS_BRIGHTENING(l)   (l.b & 0x01)
-#define LED_IS_DIMMING(l)       (l.r & 0x01)
-#define LED_IS_IDLE(l)          (!LED_IS_BRIGHTENING(l) && !LED_IS_DIMMING(l))
-
 #define BASE_BRIGHTNESS       32
 #define TWINKLE_BRIGHTNESS    80
 
-// Amount to increment the color by each loop as it gets brighter:
-#define DELTA_COLOR_UP        CRGB(4,4,4)
+#define TWINKLE_LEVEL_MAX     255
 
-// Amount to decrement the color by each loop as it gets dimmer:
-#define DELTA_COLOR_DOWN      CRGB(2,2,2)
+/*** TYPES ***/
+// A pixel that is brightening towards the peak color or dimming back to the base color
+struct TwinkleEntry
+{
+  uint16_t Pos;
+  uint8_t Level;                // 0: base color .. TWINKLE_LEVEL_MAX: peak color
+  uint8_t Dimming;
+};
 
-// Chance of each pixel starting to brighten up.  
-// 1 or 2 = a few brightening pixels at a time.
-// 10 = lots of pixels brightening at a time.
-#define CHANCE_OF_TWINKLE     1
+/*** CLASS FUNCTIONS ***/
+
+// inDensity: maximum number of twinkling pixels per 256 LEDs
+// inRiseStep/inFallStep: level change per animation step while brightening/dimming
+Program_Twinkle::Program_Twinkle(uint8_t inDensity, uint8_t inRiseStep, uint8_t inFallStep) : CLEDProgram("Twinkle")
+{
+  Density = inDensity;
+  RiseStep = max(inRiseStep, (uint8_t)1);
+  FallStep = max(inFallStep, (uint8_t)1);
+  Active = NULL;
+}
 
 bool Program_Twinkle::Start()
 {
+  uint16_t lvLifetime = (TWINKLE_LEVEL_MAX / RiseStep) + (TWINKLE_LEVEL_MAX / FallStep) + 2;
+  uint32_t lvSpawnRate;
+
+  MaxActive = ((uint32_t)NUM_LEDS * Density) >> 8;
+  if (MaxActive == 0)
+  {
+    MaxActive = 1;
+  }
+  // new twinkles per step in 8.8 fixed-point, keeps MaxActive pixels twinkling
+  lvSpawnRate = ((uint32_t)MaxActive << 8) / lvLifetime;
+  SpawnRate = min(lvSpawnRate, (uint32_t)0xFFFF);
+  NumActive = 0;
+
+  // active list followed by one bit per LED: set while the LED is in the list
+  Active = (TwinkleEntry *)AllocState((MaxActive * sizeof(TwinkleEntry)) + ((NUM_LEDS + 7) / 8));
+  if (Active == NULL)
+  {
+    return false;
+  }
+  Twinkling = (uint8_t *)&Active[MaxActive];
+  PrevHue = g_GlobalSettings.Hue + 10;    // fill with the base color in the first update
   return true;
 }
 
-bool Program_Twinkle::Update()
+bool Program_Twinkle::Update(unsigned long inElapsedUs)
 {
-  static uint8_t s_DelayCounter = 0;
-  static uint8_t s_PrevHue = DEFAULT_HUE + 10;
+  uint16_t lvSteps = TakeSteps(inElapsedUs, MAX_STEPS_PER_UPDATE);
+  if (Active == NULL)
+  {
+    return true;
+  }
 
-  if (abs((int)s_PrevHue - g_GlobalSettings.Hue) > 2)
+  if (abs((int)PrevHue - g_GlobalSettings.Hue) > 2)
   {
     hsv2rgb_spectrum(CHSV(g_GlobalSettings.Hue, 255, TWINKLE_BRIGHTNESS), PeakColor);
     hsv2rgb_spectrum(CHSV(g_GlobalSettings.Hue, 255, BASE_BRIGHTNESS), BaseColor);
-    
-    LED_SET_IDLE(BaseColor);
-    LED_SET_IDLE(PeakColor);
-  
-    // Fill LED array with base color  
+
+    // Fill LED array with base color, the twinkling pixels are drawn below
     fill_solid( g_LEDS, NUM_LEDS, BaseColor);
 
-    s_PrevHue = g_GlobalSettings.Hue;
-  }
-  
-  if (s_DelayCounter++ > 5)
-  {
-    s_DelayCounter = 0;
+    PrevHue = g_GlobalSettings.Hue;
   }
-  for( uint16_t i = 0; i < NUM_LEDS; i++) 
+
+  // only the pixels in the active list change
+  while (lvSteps-- > 0)
   {
-    if( LED_IS_IDLE(g_LEDS[i]) && (s_DelayCounter == 0))
+    uint16_t a = 0;
+    while (a < NumActive)
     {
-      // LED is IDLE
-      // Randomly consider making it start getting brighter
-      if(random8() <= (g_GlobalSettings.Speed/64)) 
+      TwinkleEntry *lvTwinkle = &Active[a];
+      if (!lvTwinkle->Dimming)
       {
-        LED_SET_BRIGHTENING(g_LEDS[i]);
-      }      
-    }
-    else if(LED_IS_BRIGHTENING(g_LEDS[i])) 
-    {
-      // LED is getting brighter
-      // if it's at peak color, switch it to getting dimmer again
-      if( g_LEDS[i] >= PeakColor) 
+        // getting brighter, switch to dimming at the peak
+        if (lvTwinkle->Level >= (TWINKLE_LEVEL_MAX - RiseStep))
+        {
+          lvTwinkle->Level = TWINKLE_LEVEL_MAX;
+          lvTwinkle->Dimming = 1;
+        }
+        else
+        {
+          lvTwinkle->Level += RiseStep;
+        }
+      }
+      else if (lvTwinkle->Level <= FallStep)
       {
-        LED_SET_DIMMING(g_LEDS[i]);
-      } 
-      else 
+        // back at the base color: remove from the list, the last entry takes its place
+        g_LEDS[lvTwinkle->Pos] = BaseColor;
+        Twinkling[lvTwinkle->Pos >> 3] &= ~(1 << (lvTwinkle->Pos & 7));
+        Active[a] = Active[--NumActive];
+        continue;
+      }
+      else
       {
-        // otherwise, just keep brightening it:
-        g_LEDS[i] += DELTA_COLOR_UP;
-        LED_SET_BRIGHTENING(g_LEDS[i]);
+        lvTwinkle->Level -= FallStep;
       }
-    } 
-    else
+      a++;
+    }
+
+    // start new twinkles, the fraction of SpawnRate is a chance
+    uint8_t lvSpawns = (SpawnRate >> 8) + ((Random_8(&Rng) < (SpawnRate & 0xFF)) ? 1 : 0);
+    while ((lvSpawns-- > 0) && (NumActive < MaxActive))
     {
-      // getting dimmer again
-      // if it's back to base color, switch it to IDLE
-      if( g_LEDS[i] <= BaseColor ) 
-      {
-        g_LEDS[i] = BaseColor; // reset to exact base color, in case we overshot
-        LED_SET_IDLE(g_LEDS[i]);
-      } 
-      else 
+      uint16_t lvPos = Random_16Range(&Rng, 0, NUM_LEDS);
+      if (!(Twinkling[lvPos >> 3] & (1 << (lvPos & 7))))
       {
-        // otherwise, just keep dimming it down:
-        g_LEDS[i] -= DELTA_COLOR_DOWN;
-        LED_SET_DIMMING(g_LEDS[i]);
+        Twinkling[lvPos >> 3] |= (1 << (lvPos & 7));
+        Active[NumActive].Pos = lvPos;
+        Active[NumActive].Level = 0;
+        Active[NumActive].Dimming = 0;
+        NumActive++;
       }
     }
   }
+
+  for (uint16_t a = 0; a < NumActive; a++)
+  {
+    g_LEDS[Active[a].Pos] = blend(BaseColor, PeakColor, Active[a].Level);
+  }
   return true;
 }
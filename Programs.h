@@ -3,69 +3,89 @@
 
 #include "Settings.h"
 #include "CProgram.h"
+#include "Clock.h"
+#include "Particles.h"
+#include "Tile.h"
+#include "Palettes.h"
+#include "Hsv.h"
+#include "AudioBus.h"
+#include "Realtime.h"
 
 
 class Program_Connecting : public CLEDProgram
 {
   public:
-    Program_Connecting() : CLEDProgram("Connecting") {  TicksPerCycle = NUM_LEDS; }
-    int GetUpdatePeriod(uint8_t inSpeed) { return (1000 / NUM_LEDS); }
-    bool Update() 
+    Program_Connecting() : CLEDProgram("Connecting") {  TicksPerCycle = NUM_LEDS; Offset = START_LED; }
+    unsigned long GetUpdatePeriodUs(uint8_t) { return (1000000UL / NUM_LEDS); }
+    bool Update(unsigned long inElapsedUs) 
     {
-      static uint8_t s_Offset = START_LED;
-      fadeToBlackBy( g_LEDS, NUM_LEDS, 150);
-      g_LEDS[s_Offset] = CRGB(0,0,255);
-      s_Offset++;
-      if (s_Offset >= NUM_LEDS)
+      uint16_t lvSteps = TakeSteps(inElapsedUs, MAX_STEPS_PER_UPDATE);
+      while (lvSteps-- > 0)
       {
-        s_Offset = START_LED;
+        fadeToBlackBy( g_LEDS, NUM_LEDS, 150);
+        g_LEDS[Offset] = CRGB(0,0,255);
+        Offset++;
+        if (Offset >= NUM_LEDS)
+        {
+          Offset = START_LED;
+        }
       }
+      // sub-pixel: fade in the next pixel
+      g_LEDS[Offset] = CRGB(0,0,StepFraction());
       return true;
     }
   private:
+    uint16_t Offset;
 };
 
 class Program_Solid : public CLEDProgram
 {
   public:
-    Program_Solid(const char *inName = "Solid", uint8_t inNumColors = 1, uint16_t inStartLED = 0) : CLEDProgram(inName) { NumColors = inNumColors; TicksPerCycle = NUM_LEDS/10; StartLED = inStartLED; }
-    bool Start() { fill_solid(g_LEDS, NUM_LEDS, CRGB(0,0,0)); }
-    bool Update() 
+    Program_Solid(uint8_t inNumColors = 1) : CLEDProgram("Solid") { NumColors = max(inNumColors, (uint8_t)1); TicksPerCycle = NUM_LEDS/10; Cache.Pixels = NULL; }
+    bool Start()
     {
-      static uint8_t s_Offset = 0;
-      uint8_t lvSpacing = 85;
-      if (NumColors > 3)
-      {
-        lvSpacing = 42;
-      }
-      
-      for (uint16_t i = StartLED; i < NUM_LEDS; i++)
-      {
-        g_LEDS[i] = CHSV(g_GlobalSettings.Hue + ((i + s_Offset) % NumColors) * lvSpacing, g_GlobalSettings.Saturation, 255);
-      }
-      if (g_GlobalSettings.Reverse)
+      Phase = 0;
+      Cache.Pixels = (CRGB *)AllocState(NumColors * sizeof(CRGB));
+      Tile_Invalidate(&Cache);
+      fill_solid(g_LEDS, NUM_LEDS, CRGB(0,0,0));
+      return (Cache.Pixels != NULL);
+    }
+    bool Update(unsigned long inElapsedUs) 
+    {
+      uint16_t lvSteps = TakeSteps(inElapsedUs);
+      if (Cache.Pixels == NULL)
       {
-        s_Offset--;
+        return true;
       }
-      else
+      if (Tile_Changed(&Cache, NUM_LEDS))
       {
-        s_Offset++;
+        // one pixel per color, converted only when the settings change
+        uint8_t lvSpacing = 85;
+        if (NumColors > 3)
+        {
+          lvSpacing = 42;
+        }
+        Hsv_FillRamp(Cache.Pixels, NumColors, g_GlobalSettings.Hue, lvSpacing, g_GlobalSettings.Saturation, 255);
       }
+      Tile_Fill(g_LEDS, NUM_LEDS, Cache.Pixels, NumColors, Phase);
+      Phase = Tile_Scroll(Phase, lvSteps, NumColors);
       return true;
     }
   private:
     uint8_t NumColors;
-    uint16_t StartLED;
+    uint8_t Phase;
+    TileCache Cache;              // NumColors pixels
 };
 
 class Program_Breathe : public CLEDProgram
 {
   public:
     Program_Breathe() : CLEDProgram("Breathe") { NoDelay = true; }
-    bool Update() 
+    bool Update(unsigned long) 
     {
       uint8_t BeatsPerMinute = g_GlobalSettings.Speed / 2;
       fill_solid(g_LEDS, NUM_LEDS, CHSV(g_GlobalSettings.Hue, g_GlobalSettings.Saturation, beatsin8( BeatsPerMinute, 128, 255)));
+      return true;
     }
   private:
 };
@@ -74,184 +94,274 @@ class Program_Breathe : public CLEDProgram
 class Program_Strobe : public CLEDProgram
 {
   public:
-    Program_Strobe() : CLEDProgram("Strobe") { NoDelay = true; IncludeInAutoProgram = false; }
-    bool Update() 
+    Program_Strobe() : CLEDProgram("Strobe") { NoDelay = true; }
+    bool Start() { PrevVal = 0; return true; }
+    bool Update(unsigned long) 
     {
-      static uint8_t s_PrevVal = 0;
       // g_GlobalSettings.Speed is interpreted as Frequency[Hz] * 8
       // ==> Frequency[Hz] = g_GlobalSettings.Speed / 8 = g_GlobalSettings.Speed >> 3
       // Hz = 1/s = 1/1000000 us = 286 / (256*1048576) = 286 / (256 * 2^20) = 286 / 2^23 = 286 >> 23
-      if ((uint8_t)(((unsigned long)micros() * g_GlobalSettings.Speed * 286) >> 23) >= 128)
+      if ((uint8_t)(((unsigned long)Clock_Micros() * g_GlobalSettings.Speed * 286) >> 23) >= 128)
       {
-        if (s_PrevVal)
+        if (PrevVal)
         {
-          FastLED.clear();
-          s_PrevVal = 0;
+          fill_solid(g_LEDS, NUM_LEDS, CRGB(0,0,0));
+          PrevVal = 0;
         }
       }
       else
       {
-        if (!s_PrevVal)
+        if (!PrevVal)
         {
           fill_solid(g_LEDS, NUM_LEDS, CHSV(g_GlobalSettings.Hue, g_GlobalSettings.Saturation, 255));
-          s_PrevVal = 1;
+          PrevVal = 1;
         }
       }
+      return true;
     }
   private:
+    uint8_t PrevVal;
 };
 
 class Program_ColorWipe : public CLEDProgram
 {
   public:
-    Program_ColorWipe(uint16_t inStartLED = 0) : CLEDProgram("ColorWipe") { TicksPerCycle = NUM_LEDS; StartLED = inStartLED;}
+    Program_ColorWipe() : CLEDProgram("ColorWipe") { TicksPerCycle = NUM_LEDS; }
     bool Start();
-    bool Update();
+    bool Update(unsigned long inElapsedUs);
   private:
     int WiperPos;
     uint8_t HueOffset;
-    uint16_t StartLED;
 };
 
 class Program_Chase: public CLEDProgram
 {
   public:
-    Program_Chase(const char *inName = "Chase", uint8_t inGapSize = 1, uint16_t inStartLED = 0) : CLEDProgram(inName) { GapSize = inGapSize; TicksPerCycle = NUM_LEDS/10; StartLED = inStartLED; }
-    bool Start() { fill_solid(g_LEDS, NUM_LEDS, CRGB(0,0,0)); }
-    bool Update() 
+    Program_Chase(uint8_t inGapSize = 1) : CLEDProgram("Chase") { GapSize = inGapSize; TicksPerCycle = NUM_LEDS/10; Cache.Pixels = NULL; }
+    bool Start()
     {
-      static uint8_t s_Offset = 0;      
-      for (uint16_t i = StartLED; i < NUM_LEDS; i++)
-      {
-        if (((i + s_Offset) % (GapSize+1)) == 0)
-        {
-          g_LEDS[i] = CHSV(g_GlobalSettings.Hue, g_GlobalSettings.Saturation, 255);
-        }
-        else
-        {
-          g_LEDS[i] = CRGB(0,0,0);
-        }
-      }   
-      if (g_GlobalSettings.Reverse)
+      Phase = 0;
+      Cache.Pixels = (CRGB *)AllocState((GapSize + 1) * sizeof(CRGB));
+      Tile_Invalidate(&Cache);
+      fill_solid(g_LEDS, NUM_LEDS, CRGB(0,0,0));
+      return (Cache.Pixels != NULL);
+    }
+    bool Update(unsigned long inElapsedUs) 
+    {
+      uint16_t lvSteps = TakeSteps(inElapsedUs);
+      if (Cache.Pixels == NULL)
       {
-        s_Offset++;
+        return true;
       }
-      else
+      if (Tile_Changed(&Cache, NUM_LEDS))
       {
-        s_Offset--;
+        // one lit pixel followed by the gap, the arena block is zeroed so the gap is already black
+        Cache.Pixels[0] = CHSV(g_GlobalSettings.Hue, g_GlobalSettings.Saturation, 255);
       }
+      Tile_Fill(g_LEDS, NUM_LEDS, Cache.Pixels, GapSize + 1, Phase);
+      Phase = Tile_Scroll(Phase, -(int16_t)lvSteps, GapSize + 1);
       return true;
     }
   private:
     uint8_t GapSize;
-    uint16_t StartLED;
+    uint8_t Phase;
+    TileCache Cache;              // GapSize+1 pixels
 };
 
+#define TWINKLE_DENSITY       24    // twinkling pixels per 256 LEDs
+#define TWINKLE_RISE_STEP     16    // brightening takes 16 steps
+#define TWINKLE_FALL_STEP     8     // dimming takes 32 steps
+
+struct TwinkleEntry;
+
 class Program_Twinkle : public CLEDProgram {
   public:
-    Program_Twinkle() : CLEDProgram("Twinkle") {}
+    Program_Twinkle(uint8_t inDensity = TWINKLE_DENSITY, uint8_t inRiseStep = TWINKLE_RISE_STEP, uint8_t inFallStep = TWINKLE_FALL_STEP);
     bool Start();
-    bool Update();
+    bool Update(unsigned long inElapsedUs);
   private:
     CRGB BaseColor;
     CRGB PeakColor;
+    uint8_t PrevHue;
+    uint8_t Density;
+    uint8_t RiseStep;
+    uint8_t FallStep;
+    uint16_t SpawnRate;           // new twinkles per step, 8.8 fixed-point
+    uint16_t MaxActive;
+    uint16_t NumActive;
+    TwinkleEntry *Active;         // active list in the state arena
+    uint8_t *Twinkling;           // one bit per LED, behind the active list
 };
 
 
+#define GLITTER_PARTICLES       32
+#define GLITTER_FADE            20
+
 class Program_Glitter : public CLEDProgram {
   public:
-    Program_Glitter() : CLEDProgram("Glitter") {}
-    bool Start() { fill_solid(g_LEDS, NUM_LEDS, CRGB(0,0,0)); }
-    bool Update()
+    Program_Glitter() : CLEDProgram("Glitter") { Pool = NULL; }
+    bool Start()
+    {
+      uint16_t lvCapacity = Particles_Capacity(GLITTER_PARTICLES, NUM_LEDS);
+      Pool = Particles_Init(AllocState(Particles_StateSize(lvCapacity)), lvCapacity, NUM_LEDS);
+      fill_solid(g_LEDS, NUM_LEDS, CRGB(0,0,0));
+      return (Pool != NULL);
+    }
+    bool Update(unsigned long inElapsedUs)
     {
-      fadeToBlackBy( g_LEDS, NUM_LEDS, 20);
-      if ( random8() < 80) 
+      uint16_t lvSteps = TakeSteps(inElapsedUs, MAX_STEPS_PER_UPDATE);
+      if ((lvSteps == 0) || (Pool == NULL))
       {
-        g_LEDS[ random16(NUM_LEDS) ] += CHSV(g_GlobalSettings.Hue, g_GlobalSettings.Saturation, 255);
+        return true;
       }
+      Particles_Fade(Pool, lvSteps, NULL);
+      while (lvSteps-- > 0)
+      {
+        if ( Random_8(&Rng) < 80) 
+        {
+          Particles_Emit(Pool, PARTICLE_POS(Random_16Range(&Rng, 0, NUM_LEDS)), 0, CHSV(g_GlobalSettings.Hue, g_GlobalSettings.Saturation, 255), GLITTER_FADE, 0);
+        }
+      }
+      fill_solid(g_LEDS, NUM_LEDS, CRGB(0,0,0));
+      Particles_Render(Pool, g_LEDS);
+      return true;
     }
   private:
+    ParticlePool *Pool;           // in the state arena
 };
 
 
+#define RAINBOW_HUE_DELTA       5     // hue change per LED, like fill_rainbow()
+#define RAINBOW_PERIOD          256   // LEDs, RAINBOW_HUE_DELTA is odd so the hues repeat after 256 LEDs
+#define RAINBOW_PHASE_MUL       205   // RAINBOW_HUE_DELTA * 205 = 1 (mod 256): a hue shift of 1 is a shift of 205 LEDs
+#define RAINBOW_SATURATION      240   // like fill_rainbow()
+
 class Program_Rainbow : public CLEDProgram
 {
   public:
-    Program_Rainbow() : CLEDProgram("Rainbow") { TicksPerCycle = 255; }
+    Program_Rainbow() : CLEDProgram("Rainbow") { TicksPerCycle = 255; Ring = NULL; }
     bool Start()
     {
       HueStart = g_GlobalSettings.Hue;
-      fill_rainbow(g_LEDS, NUM_LEDS, HueStart);  
+      // one period with hue 0 on the first LED, it does not depend on the settings.
+      // Without room for the ring, e.g. in the Nano's state arena, the rainbow is converted every update.
+      Ring = NULL;
+      if (MaxStateSize() >= (RAINBOW_PERIOD * sizeof(CRGB)))
+      {
+        Ring = (CRGB *)AllocState(RAINBOW_PERIOD * sizeof(CRGB));
+      }
+      if (Ring != NULL)
+      {
+        Hsv_FillRamp(Ring, RAINBOW_PERIOD, 0, RAINBOW_HUE_DELTA, RAINBOW_SATURATION, 255);
+      }
+      Draw();
       return true;
     }
-    bool Update()
+    bool Update(unsigned long inElapsedUs)
+    {
+      uint16_t lvSteps = TakeSteps(inElapsedUs);
+      HueStart += lvSteps;
+      Draw();
+      return (HueStart == g_GlobalSettings.Hue);
+    }
+  private:
+    void Draw()
     {
-      if (g_GlobalSettings.Reverse)
+      if (Ring != NULL)
       {
-        HueStart--;
+        Tile_Fill(g_LEDS, NUM_LEDS, Ring, RAINBOW_PERIOD, (uint8_t)(HueStart * RAINBOW_PHASE_MUL));
       }
       else
       {
-        HueStart++;
-      }      
-      fill_rainbow(g_LEDS, NUM_LEDS, HueStart);
-      return (HueStart == g_GlobalSettings.Hue);
+        Hsv_FillRamp(g_LEDS, NUM_LEDS, HueStart, RAINBOW_HUE_DELTA, RAINBOW_SATURATION, 255);
+      }
     }
-  private:
     uint8_t HueStart;
+    CRGB *Ring;                   // in the state arena, NULL: no room
 };
 
 
 class Program_Gradient : public CLEDProgram
 {
   #define HUE_DELTA            64
+  #define GRADIENT_BATCH       32      // hues converted per batch
   public:
-    Program_Gradient() : CLEDProgram("Gradient")     { TicksPerCycle = NUM_LEDS;   }
+    Program_Gradient() : CLEDProgram("Gradient")     { TicksPerCycle = NUM_LEDS; Cache.Pixels = NULL; }
     bool Start()
     {
       HueStartOffset = 0;
+      Cache.Pixels = NULL;
+      Tile_Invalidate(&Cache);
       return true;
     }
-    bool Update()
+    bool Update(unsigned long inElapsedUs)
     {
-      for( int i = 0; i < NUM_LEDS; i++) 
-      {
-        uint16_t a = triwave8((((i + HueStartOffset) * 255) + (NUM_LEDS/2)) / NUM_LEDS);
-        g_LEDS[i] = CHSV(g_GlobalSettings.Hue + (a * HUE_DELTA) / 255, 255, 255);
-      }
-      if (g_GlobalSettings.Reverse)
+      uint16_t lvSteps = TakeSteps(inElapsedUs) % NUM_LEDS;
+      uint16_t lvRingSize = Cache.NumLeds;
+      if (Tile_Changed(&Cache, NUM_LEDS))
       {
-        if (HueStartOffset == 0)
+        // one period is the complete strip, a new length needs a new ring.
+        // Without room for the ring, e.g. in the Nano's state arena, the gradient is converted every update.
+        if ((Cache.Pixels == NULL) || (lvRingSize != NUM_LEDS))
         {
-          HueStartOffset = NUM_LEDS-1;
+          Cache.Pixels = (MaxStateSize() >= (NUM_LEDS * sizeof(CRGB))) ? (CRGB *)AllocState(NUM_LEDS * sizeof(CRGB)) : NULL;
         }
-        else
+        if (Cache.Pixels != NULL)
         {
-          HueStartOffset--;
+          Draw(Cache.Pixels, 0);
         }
       }
+      if (Cache.Pixels != NULL)
+      {
+        Tile_Fill(g_LEDS, NUM_LEDS, Cache.Pixels, NUM_LEDS, HueStartOffset);
+      }
       else
       {
-        if (++HueStartOffset >= NUM_LEDS)
-        {
-          HueStartOffset = 0;
-        }
-      } 
+        Draw(g_LEDS, HueStartOffset);
+      }
+      HueStartOffset = Tile_Scroll(HueStartOffset, lvSteps, NUM_LEDS);
       return (HueStartOffset == 0);
     }
   private:
-    uint8_t HueStartOffset;
+    // LED i gets the gradient at LED (i + inPhase) % NUM_LEDS, like Tile_Fill()
+    void Draw(CRGB *outLEDs, uint16_t inPhase)
+    {
+      uint8_t lvHues[GRADIENT_BATCH];
+      uint16_t lvLed = inPhase;
+      for (uint16_t lvFirst = 0; lvFirst < NUM_LEDS; lvFirst += GRADIENT_BATCH)
+      {
+        uint16_t lvCount = min((uint16_t)GRADIENT_BATCH, (uint16_t)(NUM_LEDS - lvFirst));
+        for (uint16_t i = 0; i < lvCount; i++)
+        {
+          uint16_t a = triwave8(((((uint32_t)lvLed) * 255) + (NUM_LEDS/2)) / NUM_LEDS);
+          lvHues[i] = g_GlobalSettings.Hue + (a * HUE_DELTA) / 255;
+          if (++lvLed >= NUM_LEDS)
+          {
+            lvLed = 0;
+          }
+        }
+        Hsv_FillHues(&outLEDs[lvFirst], lvHues, lvCount, 255, 255);
+      }
+    }
+    uint16_t HueStartOffset;
+    TileCache Cache;              // NUM_LEDS pixels, reallocated when the length changes, Pixels NULL: no room
 };
 
 
+#define FIRE_LEDS_PER_SOURCE    50    // one flame per 50 LEDs
+
 class Program_Fire : public CLEDProgram
 {
   public:
-    Program_Fire() : CLEDProgram("Fire") {}
+    Program_Fire() : CLEDProgram("Fire") { Heat = NULL; TicksPerCycle = FIRE_LEDS_PER_SOURCE; }
     bool Start();
-    bool Update();
+    bool Update(unsigned long inElapsedUs);
+    // Simulation kernels on a heat field of one cell per LED, public for the benchmark
+    static void Step(RandomStream *ioRandom, uint8_t *ioHeat, uint8_t *outHeat, uint16_t inNumCells);
+    static void Render(const uint8_t *inHeat, CRGB *outLEDs, uint16_t inNumCells);
   private:
-    uint8_t HueStart;
+    uint8_t *Heat;                // one temperature cell per LED, in the state arena
+    uint8_t *Scratch;             // next heat field, swapped with Heat every step
 };
 
 
@@ -260,7 +370,7 @@ class Program_Meteor : public CLEDProgram
   public:
     Program_Meteor(); //const char *inName = "Meteor", bool inVariate = false) ;
     bool Start();
-    bool Update();
+    bool Update(unsigned long inElapsedUs);
     void Variate();
   private:
     uint8_t BaseHue;
@@ -271,86 +381,127 @@ class Program_Meteor : public CLEDProgram
     int MeteorPos;
     int Direction;
     bool VariateEnabled;
+    uint8_t PrevSeconds;
+    ParticlePool *Pool;           // the trails, in the state arena
 };
 
 class Program_Confetti : public CLEDProgram
 {
   public:
-    Program_Confetti() : CLEDProgram("Confetti") {}
+    Program_Confetti() : CLEDProgram("Confetti") { Pool = NULL; }
     bool Start();
-    bool Update();
+    bool Update(unsigned long inElapsedUs);
     void Variate();
   private:
     uint8_t FadeAmount;
     uint8_t HueRange;
     uint8_t CurrentHue;
     uint8_t HueInc;
+    uint8_t PrevSeconds;
+    uint8_t Palette;              // palette Lut is blending towards
+    bool Blending;
+    ParticlePool *Pool;           // in the state arena
+    CRGB *Lut;                    // current palette, behind the pool
 };
 
 
+#define JUGGLE_MAX_DOTS     8
+
 class Program_Juggle : public CLEDProgram
 {
   public:
     Program_Juggle();
     bool Start();
-    bool Update();
+    bool Update(unsigned long inElapsedUs);
     void Variate();
   private:
     uint8_t NumDots;
     uint8_t FadeAmount;
+    uint16_t DotLed[JUGGLE_MAX_DOTS];   // LED of every dot when its last trail particle was emitted
+    int32_t DotPos[JUGGLE_MAX_DOTS];    // where every dot was drawn, -1: not yet
+    ParticlePool *Pool;           // the trails, in the state arena
+    uint8_t BeatHue;              // hue offset, one step per beat from the audio bus
+    unsigned long LastBeats;      // AudioBusFrame.Beats at the last hue step
 };
 
 class Program_Bubble : public CLEDProgram
 {
   public:
-    Program_Bubble() : CLEDProgram("Bubble") {}
+    Program_Bubble() : CLEDProgram("Bubble") { Pool = NULL; }
     bool Start();
-    bool Update();
+    bool Update(unsigned long inElapsedUs);
     void Variate();
   private:
-  
+    uint8_t PrevSeconds;
+    ParticlePool *Pool;           // in the state arena
 };
 
+#define MAGNETS_MAX   48    // magnets on long strips
+
+struct MagnetsState;
+
 class Program_Magnets : public CLEDProgram
 {
   public:
     Program_Magnets();
     bool Start();
-    bool Update();
-    void Variate();
+    bool Update(unsigned long inElapsedUs);
+    // Physics core on a state of StateSize() bytes, public for the benchmark
+    static uint16_t StateSize(uint16_t inNumLeds);
+    static void Init(MagnetsState *outState, uint16_t inNumLeds);
+    static uint8_t Step(MagnetsState *ioState, RandomStream *ioRandom);
+    static void Draw(const MagnetsState *inState, CRGB *outLEDs);
   private:
-  
+    MagnetsState *State;          // in the state arena
 };
 
-DECLARE_GRADIENT_PALETTE( bhw2_xmas_gp );
+
+#define CHRISTMAS_PALETTE_STEP  4     // palette index change per LED
+#define CHRISTMAS_PERIOD        (256 / CHRISTMAS_PALETTE_STEP)
 
 class Program_Christmas: public CLEDProgram
 {
   public:
-    Program_Christmas() : CLEDProgram("Christmas") { TicksPerCycle = NUM_LEDS; }
-    bool Update() 
+    Program_Christmas() : CLEDProgram("Christmas") { TicksPerCycle = NUM_LEDS; Ring = NULL; }
+    bool Start()
     {
-      static uint8_t s_Offset = 0;
-      uint8_t BeatsPerMinute = 62;
-      CRGBPalette16 palette = bhw2_xmas_gp;
-      uint8_t beat = 0;//beatsin8( BeatsPerMinute, 0, 20);
-      for( int i = 0; i < NUM_LEDS; i++) 
+      Offset = 0;
+      // a step moves the pattern a quarter LED: one ring per quarter, ring q holds the palette indices 4k+q.
+      // Without room for the rings, e.g. in the Nano's state arena, the palette is mapped every update.
+      Ring = NULL;
+      if (MaxStateSize() >= (CHRISTMAS_PALETTE_STEP * CHRISTMAS_PERIOD * sizeof(CRGB)))
       {
-        g_LEDS[i] = ColorFromPalette(palette, (((uint8_t)((4*i)+beat)+ s_Offset)), 255);
+        Ring = (CRGB *)AllocState(CHRISTMAS_PALETTE_STEP * CHRISTMAS_PERIOD * sizeof(CRGB));
       }
-      if (g_GlobalSettings.Reverse)
+      if (Ring != NULL)
       {
-         s_Offset--;
+        const CRGB *lvPalette = Palettes_Get(PALETTE_XMAS);
+        for (uint8_t q = 0; q < CHRISTMAS_PALETTE_STEP; q++)
+        {
+          Palettes_MapRamp(lvPalette, &Ring[q * CHRISTMAS_PERIOD], CHRISTMAS_PERIOD, q, CHRISTMAS_PALETTE_STEP);
+        }
+      }
+      return true;
+    }
+    bool Update(unsigned long inElapsedUs) 
+    {
+      uint16_t lvSteps = TakeSteps(inElapsedUs);
+      // LED i shows palette index 4i + Offset
+      if (Ring != NULL)
+      {
+        uint8_t lvQuarter = Offset % CHRISTMAS_PALETTE_STEP;
+        Tile_Fill(g_LEDS, NUM_LEDS, &Ring[lvQuarter * CHRISTMAS_PERIOD], CHRISTMAS_PERIOD, Offset / CHRISTMAS_PALETTE_STEP);
       }
       else
       {
-        s_Offset++;
+        Palettes_MapRamp(Palettes_Get(PALETTE_XMAS), g_LEDS, NUM_LEDS, Offset, CHRISTMAS_PALETTE_STEP);
       }
+      Offset += lvSteps;
       return true;
     }
   private:
-    uint8_t GapSize;
-    
+    uint8_t Offset;
+    CRGB *Ring;                   // in the state arena, NULL: no room
 };
 
 #ifdef INCLUDE_PROGRAM_SOUND
@@ -359,23 +510,28 @@ class Program_Sound : public CLEDProgram
   public:
     Program_Sound() : CLEDProgram("Sound") { NoDelay = true; }
     bool Start();
-    bool Update();
-    bool Stop();
+    bool Update(unsigned long inElapsedUs);
   private:
+    unsigned long LastSequence;   // of the last frame from Audio_GetFrame()
+    unsigned long LastBeats;      // AudioBusFrame.Beats at the last color change
+    uint16_t Width;               // of the bar
+    uint8_t Hue;
 };
 #endif //INCLUDE_PROGRAM_SOUND
 
 
-#ifdef INCLUDE_PROGRAM_E131
-class Program_E131 : public CLEDProgram
+#ifdef INCLUDE_PROGRAM_REALTIME
+// E1.31, DDP and Art-Net input
+class Program_Realtime : public CLEDProgram
 {
   public:
-    Program_E131() : CLEDProgram("E131") { NoDelay = true; IncludeInAutoProgram = false; }
+    Program_Realtime() : CLEDProgram("Realtime") { NoDelay = true; }
     bool Start();
-    bool Update();
+    bool Update(unsigned long inElapsedUs);
     bool Stop();
   private:
+    RealtimeOutput Output;        // Frame: the frame being received, in the state arena
 };
-#endif //INCLUDE_PROGRAM_E131
+#endif //INCLUDE_PROGRAM_REALTIME
 
 #endif //PROGRAMS_H
@@ -0,0 +1,98 @@
+/*** INCLUDES ***/
+#include "Settings.h"
+#include "Random.h"
+
+/*** FORWARD DECLARATIONS ***/
+static uint32_t Random_Mix(uint32_t inValue);
+
+/*** PRIVATE VARIABLES ***/
+static uint32_t s_Seed = 1;
+static uint32_t s_NumStreams = 0;        // streams started since the last Random_Seed(), every start gets a new sequence
+
+/*** PUBLIC FUNCTIONS ***/
+
+// Streams started after this call are a function of inSeed, the stream id and the order in which they are started
+void Random_Seed(uint32_t inSeed)
+{
+  s_Seed = inSeed;
+  s_NumStreams = 0;
+}
+
+void Random_SeedFromEntropy()
+{
+#if defined(BOARD_ESP32)
+  Random_Seed(esp_random());
+#elif defined(ESP8266)
+  Random_Seed(RANDOM_REG32);
+#else
+  // floating analog input and the startup time
+  Random_Seed(((uint32_t)analogRead(A0) << 16) ^ micros());
+#endif
+}
+
+uint32_t Random_GetSeed()
+{
+  return s_Seed;
+}
+
+void Random_InitStream(RandomStream *outStream, uint32_t inStreamId)
+{
+  uint32_t lvState = Random_Mix(s_Seed ^ Random_Mix(inStreamId + s_NumStreams));
+  s_NumStreams++;
+  outStream->State = (lvState != 0) ? lvState : 1;
+}
+
+// inCount random bytes, 4 per generator step
+void Random_FillBytes(RandomStream *ioStream, uint8_t *outBytes, uint16_t inCount)
+{
+  while (inCount >= 4)
+  {
+    uint32_t lvValue = Random_32(ioStream);
+    outBytes[0] = lvValue;
+    outBytes[1] = lvValue >> 8;
+    outBytes[2] = lvValue >> 16;
+    outBytes[3] = lvValue >> 24;
+    outBytes += 4;
+    inCount -= 4;
+  }
+  if (inCount > 0)
+  {
+    uint32_t lvValue = Random_32(ioStream);
+    while (inCount-- > 0)
+    {
+      *outBytes++ = lvValue;
+      lvValue >>= 8;
+    }
+  }
+}
+
+// inNumBits coin flips, packed 8 per byte: bit i is (outBits[i >> 3] >> (i & 7)) & 1
+void Random_FillBits(RandomStream *ioStream, uint8_t *outBits, uint16_t inNumBits)
+{
+  Random_FillBytes(ioStream, outBits, (inNumBits + 7) / 8);
+}
+
+// inCount values in inMin .. inLimit-1
+void Random_FillRange(RandomStream *ioStream, uint8_t *outValues, uint16_t inCount, uint8_t inMin, uint8_t inLimit)
+{
+  uint8_t lvRange = inLimit - inMin;
+
+  Random_FillBytes(ioStream, outValues, inCount);
+  for (uint16_t i = 0; i < inCount; i++)
+  {
+    outValues[i] = inMin + (((uint16_t)outValues[i] * lvRange) >> 8);
+  }
+}
+
+/*** PRIVATE FUNCTIONS ***/
+
+// MurmurHash3 finalizer: nearby seeds and stream ids give unrelated states
+static uint32_t Random_Mix(uint32_t inValue)
+{
+  inValue ^= inValue >> 16;
+  inValue *= 0x85EBCA6BUL;
+  inValue ^= inValue >> 13;
+  inValue *= 0xC2B2AE35UL;
+  inValue ^= inValue >> 16;
+  return inValue;
+}
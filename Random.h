@@ -0,0 +1,58 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+/*** INCLUDES ***/
+#include <stdint.h>                       // included by CProgram.h, so not Settings.h
+
+/*** TYPE DEFINITIONS ***/
+// xorshift32 generator. Every program has its own stream, so programs do not change each other's sequences.
+typedef struct
+{
+  uint32_t State;                         // never 0
+} RandomStream;
+
+/*** PUBLIC FUNCTIONS ***/
+void Random_Seed(uint32_t inSeed);
+void Random_SeedFromEntropy(void);
+uint32_t Random_GetSeed(void);
+void Random_InitStream(RandomStream *outStream, uint32_t inStreamId);
+
+// Bulk generation for a whole strip
+void Random_FillBytes(RandomStream *ioStream, uint8_t *outBytes, uint16_t inCount);
+void Random_FillBits(RandomStream *ioStream, uint8_t *outBits, uint16_t inNumBits);
+void Random_FillRange(RandomStream *ioStream, uint8_t *outValues, uint16_t inCount, uint8_t inMin, uint8_t inLimit);
+
+/*** INLINE FUNCTIONS ***/
+inline uint32_t Random_32(RandomStream *ioStream)
+{
+  uint32_t lvState = ioStream->State;
+  lvState ^= lvState << 13;
+  lvState ^= lvState >> 17;
+  lvState ^= lvState << 5;
+  ioStream->State = lvState;
+  return lvState;
+}
+
+inline uint8_t Random_8(RandomStream *ioStream)
+{
+  return Random_32(ioStream) >> 24;
+}
+
+inline uint16_t Random_16(RandomStream *ioStream)
+{
+  return Random_32(ioStream) >> 16;
+}
+
+// inMin .. inLimit-1, like random8(inMin, inLimit). Multiply-shift instead of a modulo.
+inline uint8_t Random_8Range(RandomStream *ioStream, uint8_t inMin, uint8_t inLimit)
+{
+  return inMin + (((uint16_t)Random_8(ioStream) * (uint8_t)(inLimit - inMin)) >> 8);
+}
+
+// inMin .. inLimit-1, like random16(inMin, inLimit)
+inline uint16_t Random_16Range(RandomStream *ioStream, uint16_t inMin, uint16_t inLimit)
+{
+  return inMin + (((uint32_t)Random_16(ioStream) * (uint16_t)(inLimit - inMin)) >> 16);
+}
+
+#endif //RANDOM_H
@@ -0,0 +1,410 @@
+/*** INCLUDES ***/
+#include "Settings.h"
+#include "Realtime.h"
+#include "PacketPool.h"
+#include "E131Frame.h"
+#include "E131Receiver.h"
+#include "DdpReceiver.h"
+#include "ArtNetReceiver.h"
+
+#ifdef INCLUDE_PROGRAM_REALTIME
+
+/*** DEFINES ***/
+// pcap capture files
+#define PCAP_MAGIC                  0xa1b2c3d4UL
+#define PCAP_MAGIC_NS               0xa1b23c4dUL
+#define PCAP_HEADER_LENGTH          24
+#define PCAP_RECORD_LENGTH          16
+#define PCAP_LINK_NULL              0       // BSD loopback: address family in the byte order of the capturing machine
+#define PCAP_LINK_ETHERNET          1       // also the Linux loopback interface
+#define PCAP_LINK_RAW               101
+#define PCAP_LINK_LOOP              108     // OpenBSD loopback: address family in network byte order
+#define PCAP_LINK_LINUX_SLL         113
+#define PCAP_LINK_IPV4              228
+#define PCAP_FAMILY_INET            2
+
+/*** PRIVATE VARIABLES ***/
+// Channel of a pixel in the received data -> byte of the CRGB, from the digits of the FastLED EOrder
+static const uint8_t c_ChannelTarget[3] = {(REALTIME_CHANNEL_ORDER >> 6) & 3, (REALTIME_CHANNEL_ORDER >> 3) & 3, REALTIME_CHANNEL_ORDER & 3};
+
+static RealtimeStats s_Stats;
+
+/*** FORWARD DECLARATIONS ***/
+static void Realtime_Reset(void);
+static void Realtime_Process(const PacketBuffer *inBuffer, const RealtimeOutput *inOutput);
+static void Realtime_CheckTimeouts(const RealtimeOutput *inOutput);
+static int Realtime_ProtocolOfPort(uint16_t inPort);
+static uint32_t Pcap_Read32(const uint8_t *inData, bool inSwap);
+
+/*** PUBLIC FUNCTIONS ***/
+bool Realtime_Begin()
+{
+  bool lvResult = true;
+
+  Realtime_Reset();
+#ifdef INCLUDE_REALTIME_E131
+  lvResult = lvResult && E131Receiver_Begin();
+#endif //INCLUDE_REALTIME_E131
+#ifdef INCLUDE_REALTIME_DDP
+  lvResult = lvResult && DdpReceiver_Begin();
+#endif //INCLUDE_REALTIME_DDP
+#ifdef INCLUDE_REALTIME_ARTNET
+  lvResult = lvResult && ArtNetReceiver_Begin();
+#endif //INCLUDE_REALTIME_ARTNET
+  if (!lvResult)
+  {
+    Realtime_Stop();
+  }
+  return lvResult;
+}
+
+void Realtime_Stop()
+{
+#ifdef INCLUDE_REALTIME_E131
+  E131Receiver_Stop();
+#endif //INCLUDE_REALTIME_E131
+#ifdef INCLUDE_REALTIME_DDP
+  DdpReceiver_Stop();
+#endif //INCLUDE_REALTIME_DDP
+#ifdef INCLUDE_REALTIME_ARTNET
+  ArtNetReceiver_Stop();
+#endif //INCLUDE_REALTIME_ARTNET
+}
+
+uint16_t Realtime_Drain(const RealtimeOutput *inOutput)
+{
+  PacketBuffer *lvBuffer;
+  uint16_t lvDrained = 0;
+
+  while ((lvBuffer = PacketPool_Receive()) != NULL)
+  {
+    lvDrained++;
+    Realtime_Process(lvBuffer, inOutput);
+    PacketPool_Release(lvBuffer);
+  }
+#ifdef REALTIME_UNIVERSES
+  E131Frame_Drained(lvDrained);
+#endif //REALTIME_UNIVERSES
+
+  // frames that were not completed
+  Realtime_CheckTimeouts(inOutput);
+  return lvDrained;
+}
+
+// Not while receiving: the datagrams go through the same packet pool
+bool Realtime_ReplayPcap(const uint8_t *inPcap, uint32_t inLength, const RealtimeOutput *inOutput, RealtimeReplayStats *outStats)
+{
+  bool lvSwap;
+  uint8_t lvQueued = 0;
+
+  memset(outStats, 0, sizeof(RealtimeReplayStats));
+  if (inLength < PCAP_HEADER_LENGTH)
+  {
+    return false;
+  }
+  uint32_t lvMagic = Pcap_Read32(inPcap, false);
+  if ((lvMagic == PCAP_MAGIC) || (lvMagic == PCAP_MAGIC_NS))
+  {
+    lvSwap = false;
+  }
+  else if ((Pcap_Read32(inPcap, true) == PCAP_MAGIC) || (Pcap_Read32(inPcap, true) == PCAP_MAGIC_NS))
+  {
+    lvSwap = true;
+  }
+  else
+  {
+    return false;
+  }
+  uint32_t lvLinkType = Pcap_Read32(&inPcap[20], lvSwap);
+
+  Realtime_Reset();
+  unsigned long lvFramesBefore = s_Stats.Frames;
+  uint32_t lvPos = PCAP_HEADER_LENGTH;
+  while ((lvPos + PCAP_RECORD_LENGTH) <= inLength)
+  {
+    uint32_t lvCaptured = Pcap_Read32(&inPcap[lvPos + 8], lvSwap);
+    const uint8_t *lvRecord = &inPcap[lvPos + PCAP_RECORD_LENGTH];
+    lvPos += PCAP_RECORD_LENGTH + lvCaptured;
+    if (lvPos > inLength)
+    {
+      break;
+    }
+
+    // link layer, IPv4 and UDP headers
+    uint32_t lvIp;
+    if ((lvLinkType == PCAP_LINK_ETHERNET) && (lvCaptured >= 14) && (Realtime_Read16(&lvRecord[12]) == 0x0800))
+    {
+      lvIp = 14;
+    }
+    else if ((lvLinkType == PCAP_LINK_LINUX_SLL) && (lvCaptured >= 16) && (Realtime_Read16(&lvRecord[14]) == 0x0800))
+    {
+      lvIp = 16;
+    }
+    else if ((lvLinkType == PCAP_LINK_NULL) && (lvCaptured >= 4) && (Pcap_Read32(lvRecord, lvSwap) == PCAP_FAMILY_INET))
+    {
+      lvIp = 4;
+    }
+    else if ((lvLinkType == PCAP_LINK_LOOP) && (lvCaptured >= 4) && (Realtime_Read32(lvRecord) == PCAP_FAMILY_INET))
+    {
+      lvIp = 4;
+    }
+    else if ((lvLinkType == PCAP_LINK_RAW) || (lvLinkType == PCAP_LINK_IPV4))
+    {
+      lvIp = 0;
+    }
+    else
+    {
+      continue;
+    }
+    if (((lvIp + 20) > lvCaptured) || ((lvRecord[lvIp] >> 4) != 4) || (lvRecord[lvIp + 9] != 17))
+    {
+      continue;
+    }
+    uint32_t lvUdp = lvIp + ((lvRecord[lvIp] & 0x0f) * 4);
+    if ((lvUdp + 8) > lvCaptured)
+    {
+      continue;
+    }
+    int lvProtocol = Realtime_ProtocolOfPort(Realtime_Read16(&lvRecord[lvUdp + 2]));
+    uint32_t lvUdpLength = min((uint32_t)Realtime_Read16(&lvRecord[lvUdp + 4]), lvCaptured - lvUdp);
+    if ((lvProtocol < 0) || (lvUdpLength < 8))
+    {
+      continue;
+    }
+
+    // what the network task and loop() do: a pool buffer per datagram, drained when the pool is full
+    unsigned long lvStartUs = micros();
+    PacketPool_Put(&lvRecord[lvUdp + 8], lvUdpLength - 8, lvProtocol);
+    if (++lvQueued == PACKET_POOL_BUFFERS)
+    {
+      Realtime_Drain(inOutput);
+      lvQueued = 0;
+    }
+    outStats->TotalUs += micros() - lvStartUs;
+    outStats->Packets++;
+    outStats->Bytes += lvUdpLength - 8;
+  }
+  unsigned long lvStartUs = micros();
+  Realtime_Drain(inOutput);
+  outStats->TotalUs += micros() - lvStartUs;
+
+  outStats->Frames = s_Stats.Frames - lvFramesBefore;
+  if (outStats->TotalUs > 0)
+  {
+    outStats->PacketsPerSec = (unsigned long)(((uint64_t)outStats->Packets * 1000000UL) / outStats->TotalUs);
+    outStats->BytesPerSec = (unsigned long)(((uint64_t)outStats->Bytes * 1000000UL) / outStats->TotalUs);
+  }
+  return true;
+}
+
+#ifdef REALTIME_UNIVERSES
+// Frame membership of a universe and the copy of its DMX data to its part of the frame
+bool Realtime_StoreUniverse(const RealtimeUniverse *inUniverse, const RealtimeOutput *inOutput)
+{
+  E131FrameResult lvResult = E131Frame_Receive(inUniverse->Index, inUniverse->Sequence, inUniverse->SyncAddress, micros());
+  if (lvResult == E131_FRAME_REJECT)
+  {
+    return false;
+  }
+  if (lvResult == E131_FRAME_FLUSH)
+  {
+    Realtime_Present(inOutput);
+  }
+
+  uint16_t lvSlotOffset = 0;
+  int32_t lvFrameOffset = ((int32_t)inUniverse->Index * E131_MAX_CHANNELS_PER_UNIVERSE) - (E131_CHANNEL_START - 1);
+  int32_t lvCount = min(inUniverse->NumSlots, (uint16_t)E131_MAX_CHANNELS_PER_UNIVERSE);
+  if (inUniverse->Index == 0)
+  {
+    // offset only applies for first universe
+    lvSlotOffset = E131_CHANNEL_START - 1;
+    lvFrameOffset = 0;
+    lvCount -= lvSlotOffset;
+  }
+  if ((lvCount > 0) && (lvFrameOffset >= 0))
+  {
+    Realtime_StorePixels(inUniverse->Slots + lvSlotOffset, lvFrameOffset, lvCount, inOutput);
+  }
+  return true;
+}
+#endif //REALTIME_UNIVERSES
+
+// Copy of received channels straight from the receive buffer to the frame, in CRGB order. inOffset: channel in the frame.
+void Realtime_StorePixels(const uint8_t *inData, uint32_t inOffset, uint32_t inCount, const RealtimeOutput *inOutput)
+{
+  if (inOffset >= inOutput->FrameBytes)
+  {
+    return;
+  }
+  inCount = min(inCount, inOutput->FrameBytes - inOffset);
+
+  if ((c_ChannelTarget[0] == 0) && (c_ChannelTarget[1] == 1) && (c_ChannelTarget[2] == 2))
+  {
+    memcpy(inOutput->Frame + inOffset, inData, inCount);
+    return;
+  }
+  // pixels may straddle packets, so the channel of the first byte follows from the frame offset
+  uint8_t lvChannel = inOffset % 3;
+  uint8_t *lvPixel = inOutput->Frame + inOffset - lvChannel;
+  for (uint32_t i = 0; i < inCount; i++)
+  {
+    lvPixel[c_ChannelTarget[lvChannel]] = inData[i];
+    if (++lvChannel == 3)
+    {
+      lvChannel = 0;
+      lvPixel += 3;
+    }
+  }
+}
+
+void Realtime_Present(const RealtimeOutput *inOutput)
+{
+  memcpy(inOutput->LEDs, inOutput->Frame, inOutput->FrameBytes);
+  s_Stats.Frames++;
+}
+
+uint16_t Realtime_Read16(const uint8_t *inData)
+{
+  return ((uint16_t)inData[0] << 8) | inData[1];
+}
+
+uint32_t Realtime_Read32(const uint8_t *inData)
+{
+  return ((uint32_t)Realtime_Read16(inData) << 16) | Realtime_Read16(&inData[2]);
+}
+
+const RealtimeStats *Realtime_GetStats()
+{
+  return &s_Stats;
+}
+
+void Realtime_ClearStats()
+{
+  memset(&s_Stats, 0, sizeof(s_Stats));
+  PacketPool_ClearStats();
+#ifdef INCLUDE_REALTIME_E131
+  E131Receiver_ClearStats();
+#endif //INCLUDE_REALTIME_E131
+#ifdef INCLUDE_REALTIME_DDP
+  DdpReceiver_ClearStats();
+#endif //INCLUDE_REALTIME_DDP
+#ifdef INCLUDE_REALTIME_ARTNET
+  ArtNetReceiver_ClearStats();
+#endif //INCLUDE_REALTIME_ARTNET
+#ifdef REALTIME_UNIVERSES
+  E131Frame_ClearStats();
+#endif //REALTIME_UNIVERSES
+}
+
+void Realtime_PrintStats()
+{
+  const PacketPoolStats *lvPool = PacketPool_GetStats();
+
+  Serial.print(F("Realtime Received: "));
+  Serial.print(lvPool->Received);
+  Serial.print(F("; Dropped: "));
+  Serial.print(lvPool->Dropped);
+  Serial.print(F("; Max queued: "));
+  Serial.print(lvPool->MaxQueued);
+  Serial.print(F("; Frames: "));
+  Serial.println(s_Stats.Frames);
+#ifdef INCLUDE_REALTIME_E131
+  E131Receiver_PrintStats();
+#endif //INCLUDE_REALTIME_E131
+#ifdef INCLUDE_REALTIME_DDP
+  DdpReceiver_PrintStats();
+#endif //INCLUDE_REALTIME_DDP
+#ifdef INCLUDE_REALTIME_ARTNET
+  ArtNetReceiver_PrintStats();
+#endif //INCLUDE_REALTIME_ARTNET
+#ifdef REALTIME_UNIVERSES
+  E131Frame_PrintStats();
+#endif //REALTIME_UNIVERSES
+}
+
+/*** PRIVATE FUNCTIONS ***/
+
+static void Realtime_Reset()
+{
+  PacketPool_Init();
+#ifdef REALTIME_UNIVERSES
+  E131Frame_Init(E131_UNIVERSE_COUNT);
+#endif //REALTIME_UNIVERSES
+}
+
+// The decoder of the port the datagram was received on
+static void Realtime_Process(const PacketBuffer *inBuffer, const RealtimeOutput *inOutput)
+{
+  switch (inBuffer->Tag)
+  {
+#ifdef INCLUDE_REALTIME_E131
+    case REALTIME_PROTOCOL_E131:
+      E131Receiver_Process(inBuffer->Data, inBuffer->Length, inOutput);
+      break;
+#endif //INCLUDE_REALTIME_E131
+#ifdef INCLUDE_REALTIME_DDP
+    case REALTIME_PROTOCOL_DDP:
+      DdpReceiver_Process(inBuffer->Data, inBuffer->Length, inOutput);
+      break;
+#endif //INCLUDE_REALTIME_DDP
+#ifdef INCLUDE_REALTIME_ARTNET
+    case REALTIME_PROTOCOL_ARTNET:
+      ArtNetReceiver_Process(inBuffer->Data, inBuffer->Length, inOutput);
+      break;
+#endif //INCLUDE_REALTIME_ARTNET
+    default:
+      break;
+  }
+#ifdef REALTIME_UNIVERSES
+  if (E131Frame_TakeReady(micros()))
+  {
+    Realtime_Present(inOutput);
+  }
+#endif //REALTIME_UNIVERSES
+}
+
+static void Realtime_CheckTimeouts(const RealtimeOutput *inOutput)
+{
+  unsigned long lvNowUs = micros();
+
+#ifdef REALTIME_UNIVERSES
+  if (E131Frame_TakeReady(lvNowUs))
+  {
+    Realtime_Present(inOutput);
+  }
+#endif //REALTIME_UNIVERSES
+#ifdef INCLUDE_REALTIME_DDP
+  DdpReceiver_CheckTimeout(lvNowUs, inOutput);
+#endif //INCLUDE_REALTIME_DDP
+}
+
+// Protocol of a destination port in a capture, -1 if not enabled
+static int Realtime_ProtocolOfPort(uint16_t inPort)
+{
+  switch (inPort)
+  {
+#ifdef INCLUDE_REALTIME_E131
+    case E131_PORT:
+      return REALTIME_PROTOCOL_E131;
+#endif //INCLUDE_REALTIME_E131
+#ifdef INCLUDE_REALTIME_DDP
+    case DDP_PORT:
+      return REALTIME_PROTOCOL_DDP;
+#endif //INCLUDE_REALTIME_DDP
+#ifdef INCLUDE_REALTIME_ARTNET
+    case ARTNET_PORT:
+      return REALTIME_PROTOCOL_ARTNET;
+#endif //INCLUDE_REALTIME_ARTNET
+    default:
+      return -1;
+  }
+}
+
+// pcap headers are in the byte order of the capturing machine
+static uint32_t Pcap_Read32(const uint8_t *inData, bool inSwap)
+{
+  uint32_t lvLittle = inData[0] | ((uint32_t)inData[1] << 8) | ((uint32_t)inData[2] << 16) | ((uint32_t)inData[3] << 24);
+  return inSwap ? Realtime_Read32(inData) : lvLittle;
+}
+
+#endif //INCLUDE_PROGRAM_REALTIME
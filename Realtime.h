@@ -0,0 +1,110 @@
+#ifndef REALTIME_H
+#define REALTIME_H
+
+/*** INCLUDES ***/
+#include "Settings.h"
+
+/*** DEFINES ***/
+// Channels of the strips in a chain of universes, E1.31 and Art-Net senders use the same layout
+#define E131_LEDSTRIP1_CH_START  1
+#define E131_LEDSTRIP1_CH_END    (E131_LEDSTRIP1_CH_START+(LEDSTRIP1_NUM_LEDS*3))
+#define E131_LEDSTRIP2_CH_START  (E131_LEDSTRIP1_CH_END+1)
+#define E131_LEDSTRIP2_CH_END    (E131_LEDSTRIP2_CH_START+(LEDSTRIP2_NUM_LEDS*3))
+#define E131_LEDSTRIP3_CH_START  (E131_LEDSTRIP2_CH_END+1)
+#define E131_LEDSTRIP3_CH_END    (E131_LEDSTRIP3_CH_START+(LEDSTRIP3_NUM_LEDS*3))
+
+#define E131_UNIVERSE(ch)         ((((uint16_t)(ch) - 1) / E131_MAX_CHANNELS_PER_UNIVERSE)+1)
+
+#define _CONCAT(a,b,c)             a##b##c
+
+#define _E131_LEDSTRIP_CH_START(d) _CONCAT(E131_LEDSTRIP,d,_CH_START)
+#define E131_LEDSTRIP_CH_START     _E131_LEDSTRIP_CH_START(DEVICENR)
+#define _E131_LEDSTRIP_CH_END(d)   _CONCAT(E131_LEDSTRIP,d,_CH_END)
+#define E131_LEDSTRIP_CH_END       _E131_LEDSTRIP_CH_END(DEVICENR)
+
+// Strips without their own universes in Settings.h use the channels after the previous strips
+#ifndef E131_UNIVERSE_START
+  #define E131_UNIVERSE_START        E131_UNIVERSE(E131_LEDSTRIP_CH_START)
+  #define E131_UNIVERSE_END          E131_UNIVERSE(E131_LEDSTRIP_CH_END)
+  #define E131_CHANNEL_START         (E131_LEDSTRIP_CH_START - ((E131_UNIVERSE_START-1)*E131_MAX_CHANNELS_PER_UNIVERSE))
+#endif //E131_UNIVERSE_START
+#define E131_UNIVERSE_COUNT       (E131_UNIVERSE_END-E131_UNIVERSE_START+1)
+
+// Order of the color channels in the received data, CRGB is stored as R, G, B
+#ifndef REALTIME_CHANNEL_ORDER
+  #define REALTIME_CHANNEL_ORDER  RGB
+#endif //REALTIME_CHANNEL_ORDER
+
+// E1.31 and Art-Net carry DMX universes, these are assembled into frames by E131Frame
+#if defined(INCLUDE_REALTIME_E131) || defined(INCLUDE_REALTIME_ARTNET)
+  #define REALTIME_UNIVERSES
+#endif
+
+/*** TYPE DEFINITIONS ***/
+// Tag of a PacketBuffer: the port it was received on
+typedef enum
+{
+  REALTIME_PROTOCOL_E131,
+  REALTIME_PROTOCOL_DDP,
+  REALTIME_PROTOCOL_ARTNET
+} RealtimeProtocol;
+
+// The frame being received and the LEDs it is presented on
+typedef struct
+{
+  uint8_t *Frame;                         // CRGB layout
+  uint16_t FrameBytes;
+  CRGB *LEDs;
+} RealtimeOutput;
+
+// DMX data of one of the strip's universes
+typedef struct
+{
+  uint8_t Index;                          // 0: E131_UNIVERSE_START
+  uint16_t Sequence;                      // E131_FRAME_NO_SEQUENCE if the sender does not number its packets
+  uint16_t SyncAddress;                   // 0: not synchronized
+  const uint8_t *Slots;
+  uint16_t NumSlots;
+} RealtimeUniverse;
+
+typedef struct
+{
+  unsigned long Frames;                   // presented on the LEDs
+} RealtimeStats;
+
+// Host replay of a capture
+typedef struct
+{
+  unsigned long Packets;                  // realtime datagrams in the capture
+  unsigned long Bytes;                    // .. their UDP payload
+  unsigned long Frames;                   // presented
+  unsigned long TotalUs;                  // receive path: pool, decoders, frame assembly and store
+  unsigned long PacketsPerSec;
+  unsigned long BytesPerSec;
+} RealtimeReplayStats;
+
+/*** PUBLIC FUNCTIONS ***/
+// Listens on the ports of the enabled protocols, datagrams go into the PacketPool from the network task
+bool Realtime_Begin(void);
+void Realtime_Stop(void);
+// Passes all queued packets to their decoder, which writes into the frame. Returns the number of packets.
+uint16_t Realtime_Drain(const RealtimeOutput *inOutput);
+
+// Replays the UDP datagrams to the realtime ports of a pcap capture through the receive path.
+// Captures of a local sender on the loopback interface work as well (Linux: Ethernet, BSD/macOS: null/loop link).
+bool Realtime_ReplayPcap(const uint8_t *inPcap, uint32_t inLength, const RealtimeOutput *inOutput, RealtimeReplayStats *outStats);
+
+// For the decoders
+bool Realtime_StoreUniverse(const RealtimeUniverse *inUniverse, const RealtimeOutput *inOutput);
+void Realtime_StorePixels(const uint8_t *inData, uint32_t inOffset, uint32_t inCount, const RealtimeOutput *inOutput);
+void Realtime_Present(const RealtimeOutput *inOutput);
+// Network byte order
+uint16_t Realtime_Read16(const uint8_t *inData);
+uint32_t Realtime_Read32(const uint8_t *inData);
+
+const RealtimeStats *Realtime_GetStats(void);
+void Realtime_ClearStats(void);
+// Pool, decoder and frame assembly statistics
+void Realtime_PrintStats(void);
+
+#endif //REALTIME_H
@@ -0,0 +1,111 @@
+/*** INCLUDES ***/
+#include "Registry.h"
+
+/*** DEFINES ***/
+#define REGISTRY_BUCKET_MASK        (REGISTRY_BUCKETS - 1)
+
+static_assert((REGISTRY_BUCKETS & REGISTRY_BUCKET_MASK) == 0, "REGISTRY_BUCKETS must be a power of 2");
+
+/*** TYPE DEFINITIONS ***/
+typedef union
+{
+  void *AlignPointer;
+  double AlignDouble;
+  uint32_t AlignLong;
+  uint8_t Bytes[PROGRAM_SLOT_SIZE];
+} ProgramSlot;
+
+/*** PRIVATE VARIABLES ***/
+// Only the programs in use are constructed: the running program, the next one during a program change, or one per segment
+static ProgramSlot s_Slots[PROGRAM_SLOTS];
+static CLEDProgram *s_SlotPrograms[PROGRAM_SLOTS];     // NULL: slot is free
+static uint8_t s_SlotIndex[PROGRAM_SLOTS];             // registry index of the program in the slot
+
+static int8_t s_Buckets[REGISTRY_BUCKETS];             // open addressing on the name hash, -1: empty
+
+/*** PUBLIC FUNCTIONS ***/
+
+// Build the name index
+void Registry_Init()
+{
+  memset(s_Buckets, -1, sizeof(s_Buckets));
+  for (uint8_t i = 0; i < g_NumPrograms; i++)
+  {
+    uint8_t lvBucket = g_ProgramRegistry[i].NameHash & REGISTRY_BUCKET_MASK;
+    while (s_Buckets[lvBucket] >= 0)
+    {
+      lvBucket = (lvBucket + 1) & REGISTRY_BUCKET_MASK;
+    }
+    s_Buckets[lvBucket] = i;
+  }
+}
+
+// Returns the registry index of the program, -1 for an unknown name
+int8_t Registry_Find(const char *inName)
+{
+  uint32_t lvHash = Registry_Hash(inName);
+  uint8_t lvBucket = lvHash & REGISTRY_BUCKET_MASK;
+
+  while (s_Buckets[lvBucket] >= 0)
+  {
+    const ProgramEntry *lvEntry = &g_ProgramRegistry[s_Buckets[lvBucket]];
+    if ((lvEntry->NameHash == lvHash) && (strcmp(lvEntry->Name, inName) == 0))
+    {
+      return s_Buckets[lvBucket];
+    }
+    lvBucket = (lvBucket + 1) & REGISTRY_BUCKET_MASK;
+  }
+  return -1;
+}
+
+// Construct the program in a free slot, returns the existing instance if it is already constructed.
+// Returns NULL if all slots are in use.
+CLEDProgram *Registry_Acquire(uint8_t inIndex)
+{
+  CLEDProgram *lvProgram = Registry_Get(inIndex);
+  if ((lvProgram != NULL) || (inIndex >= g_NumPrograms))
+  {
+    return lvProgram;
+  }
+  for (uint8_t s = 0; s < PROGRAM_SLOTS; s++)
+  {
+    if (s_SlotPrograms[s] == NULL)
+    {
+      const ProgramEntry *lvEntry = &g_ProgramRegistry[inIndex];
+      lvProgram = lvEntry->Create(&s_Slots[s], lvEntry->Param);
+      lvProgram->Name = lvEntry->Name;
+      Random_InitStream(&lvProgram->Rng, lvEntry->NameHash);
+      s_SlotPrograms[s] = lvProgram;
+      s_SlotIndex[s] = inIndex;
+      return lvProgram;
+    }
+  }
+  return NULL;
+}
+
+// Returns NULL if the program is not constructed
+CLEDProgram *Registry_Get(uint8_t inIndex)
+{
+  for (uint8_t s = 0; s < PROGRAM_SLOTS; s++)
+  {
+    if ((s_SlotPrograms[s] != NULL) && (s_SlotIndex[s] == inIndex))
+    {
+      return s_SlotPrograms[s];
+    }
+  }
+  return NULL;
+}
+
+// Stop the program and free its slot
+void Registry_Release(uint8_t inIndex)
+{
+  for (uint8_t s = 0; s < PROGRAM_SLOTS; s++)
+  {
+    if ((s_SlotPrograms[s] != NULL) && (s_SlotIndex[s] == inIndex))
+    {
+      s_SlotPrograms[s]->Stop();
+      s_SlotPrograms[s]->~CLEDProgram();
+      s_SlotPrograms[s] = NULL;
+    }
+  }
+}
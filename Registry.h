@@ -0,0 +1,70 @@
+#ifndef REGISTRY_H
+#define REGISTRY_H
+
+/*** INCLUDES ***/
+#include "Settings.h"
+
+/*** DEFINES ***/
+#define REGISTRY_FNV_OFFSET_BASIS   2166136261UL
+#define REGISTRY_FNV_PRIME          16777619UL
+#define REGISTRY_BUCKETS            64      // hashed name index, power of 2 and at least twice the number of programs
+
+// Registry entries, see g_ProgramRegistry in XMasLights.ino
+#define PROGRAM(name, type)                   { name, Registry_Hash(name), true,  0,     0,     Registry_Create<type> }
+#define PROGRAM_VARIANT(name, type, param)    { name, Registry_Hash(name), true,  param, 0,     Registry_CreateVariant<type> }
+#define PROGRAM_MANUAL(name, type)            { name, Registry_Hash(name), false, 0,     0,     Registry_Create<type> }   // not part of the automatic program cycle
+
+// The program starts at LED start when it runs on the complete strip, the LEDs before it stay dark
+#define PROGRAM_AT(name, type, start)                 { name, Registry_Hash(name), true,  0,     start, Registry_Create<type> }
+#define PROGRAM_VARIANT_AT(name, type, param, start)  { name, Registry_Hash(name), true,  param, start, Registry_CreateVariant<type> }
+
+/*** TYPE DEFINITIONS ***/
+typedef CLEDProgram *(*ProgramFactory)(void *inSlot, uint8_t inParam);
+
+typedef struct
+{
+  const char *Name;
+  uint32_t NameHash;                      // FNV-1a hash of Name
+  bool IncludeInAutoProgram;
+  uint8_t Param;                          // constructor argument of a program variant
+  uint8_t StartLED;                       // first LED of the program on the complete strip, not used in a segment
+  ProgramFactory Create;                  // constructs the program in a slot of the program arena
+} ProgramEntry;
+
+// Placement new into a program slot. The tag keeps it apart from the standard placement new, which not every core provides.
+struct ProgramSlotTag {};
+inline void *operator new(size_t, ProgramSlotTag, void *inSlot) { return inSlot; }
+inline void operator delete(void *, ProgramSlotTag, void *) {}
+
+/*** INLINE FUNCTIONS ***/
+// FNV-1a, evaluated by the compiler for the registry entries
+constexpr uint32_t Registry_Hash(const char *inName, uint32_t inHash = REGISTRY_FNV_OFFSET_BASIS)
+{
+  return (*inName == '\0') ? inHash : Registry_Hash(inName + 1, (inHash ^ (uint8_t)*inName) * REGISTRY_FNV_PRIME);
+}
+
+// Both factories have the ProgramFactory signature, programs without a variant have no use for the parameter
+template <class T> CLEDProgram *Registry_Create(void *inSlot, uint8_t)
+{
+  static_assert(sizeof(T) <= PROGRAM_SLOT_SIZE, "Program does not fit in PROGRAM_SLOT_SIZE");
+  return new (ProgramSlotTag(), inSlot) T();
+}
+
+template <class T> CLEDProgram *Registry_CreateVariant(void *inSlot, uint8_t inParam)
+{
+  static_assert(sizeof(T) <= PROGRAM_SLOT_SIZE, "Program does not fit in PROGRAM_SLOT_SIZE");
+  return new (ProgramSlotTag(), inSlot) T(inParam);
+}
+
+/*** GLOBALS ***/
+extern const ProgramEntry g_ProgramRegistry[];
+
+/*** PUBLIC FUNCTIONS ***/
+void Registry_Init(void);
+int8_t Registry_Find(const char *inName);
+
+CLEDProgram *Registry_Acquire(uint8_t inIndex);
+CLEDProgram *Registry_Get(uint8_t inIndex);
+void Registry_Release(uint8_t inIndex);
+
+#endif //REGISTRY_H
@@ -0,0 +1,183 @@
+/*** INCLUDES ***/
+#include "Segments.h"
+#include "Profiler.h"
+#include "Registry.h"
+
+/*** PRIVATE VARIABLES ***/
+static SegmentConfig s_Segments[SEGMENTS_MAX];
+static uint8_t s_NumSegments = 0;
+
+// Runtime state
+static bool s_Active = false;
+static CLEDProgram *s_Programs[SEGMENTS_MAX];       // NULL: program not started
+static unsigned long s_LastUpdateUs[SEGMENTS_MAX];
+static uint8_t s_NextSegment = 0;                 // first segment to render in the next frame
+static SegmentStats s_Stats;
+
+/*** FORWARD DECLARATIONS ***/
+static bool Segments_IsValid(const SegmentConfig *inSegments, uint8_t inCount);
+
+/*** PUBLIC FUNCTIONS ***/
+
+// Replace the segment table, 0 segments returns the complete strip to the selected program.
+// Returns false and keeps the current table if the segments overlap, do not fit the strip or share a program.
+bool Segments_Set(const SegmentConfig *inSegments, uint8_t inCount)
+{
+  if (!Segments_IsValid(inSegments, inCount))
+  {
+    return false;
+  }
+  Segments_Stop();
+  memcpy(s_Segments, inSegments, inCount * sizeof(SegmentConfig));
+  s_NumSegments = inCount;
+  s_NextSegment = 0;
+  fill_solid(g_LEDBuffer, DEFAULT_NUM_LEDS, CRGB(0,0,0));
+  return true;
+}
+
+uint8_t Segments_GetCount()
+{
+  return s_NumSegments;
+}
+
+const SegmentConfig *Segments_Get(uint8_t inIndex)
+{
+  return (inIndex < s_NumSegments) ? &s_Segments[inIndex] : NULL;
+}
+
+// Update the program of each segment in its own part of g_LEDBuffer.
+// Segments are rendered round robin until the frame budget is used up, the remaining segments are first in the next frame.
+void Segments_Render(unsigned long inFramePeriodUs)
+{
+  unsigned long lvFrameStartUs = micros();
+  unsigned long lvBudgetUs = (inFramePeriodUs * SEGMENTS_BUDGET_PERCENT) / 100;
+  CRGB *lvSavedLEDS = g_LEDS;
+  uint16_t lvSavedNumLeds = NUM_LEDS;
+  uint8_t lvSavedSpeed = g_GlobalSettings.Speed;
+  uint8_t lvSavedHue = g_GlobalSettings.Hue;
+  uint8_t n;
+
+  if (!s_Active)
+  {
+    // LEDs outside the segments stay dark
+    fill_solid(g_LEDBuffer, DEFAULT_NUM_LEDS, CRGB(0,0,0));
+    s_Active = true;
+  }
+
+  for (n = 0; n < s_NumSegments; n++)
+  {
+    uint8_t i = (s_NextSegment + n) % s_NumSegments;
+    const SegmentConfig *lvSegment = &s_Segments[i];
+    if ((n > 0) && ((micros() - lvFrameStartUs) >= lvBudgetUs))
+    {
+      s_NextSegment = i;
+      s_Stats.DeferredUpdates += s_NumSegments - n;
+      break;
+    }
+    if (lvSegment->Start >= lvSavedNumLeds)
+    {
+      // not visible: mirror mode halves the number of LEDs
+      continue;
+    }
+
+    g_LEDS = &g_LEDBuffer[lvSegment->Start];
+    NUM_LEDS = min(lvSegment->Length, (uint16_t)(lvSavedNumLeds - lvSegment->Start));
+    g_GlobalSettings.Speed = lvSegment->Speed;
+    g_GlobalSettings.Hue = lvSegment->Hue;
+
+    if (s_Programs[i] == NULL)
+    {
+      // constructed for the segment: the program sees the segment length from the start
+      s_Programs[i] = Registry_Acquire(lvSegment->ProgramIndex);
+      if (s_Programs[i] == NULL)
+      {
+        continue;
+      }
+      s_Programs[i]->Start();
+      s_LastUpdateUs[i] = micros();
+    }
+
+    PROFILER_START(lvStartUs);
+    unsigned long lvNowUs = micros();
+    s_Programs[i]->Update(lvNowUs - s_LastUpdateUs[i]);
+    s_LastUpdateUs[i] = lvNowUs;
+    PROFILER_LAP(lvStartUs, lvSegment->ProgramIndex, PROFILER_STAGE_UPDATE);
+    #ifdef ENABLE_PROFILER
+      Profiler_RecordFrame(lvSegment->ProgramIndex, inFramePeriodUs);
+    #endif // ENABLE_PROFILER
+  }
+  s_Stats.Frames++;
+
+  g_LEDS = lvSavedLEDS;
+  NUM_LEDS = lvSavedNumLeds;
+  g_GlobalSettings.Speed = lvSavedSpeed;
+  g_GlobalSettings.Hue = lvSavedHue;
+}
+
+// Stop and release all segment programs, they are restarted by the next Segments_Render()
+void Segments_Stop()
+{
+  for (uint8_t i = 0; i < s_NumSegments; i++)
+  {
+    if (s_Programs[i] != NULL)
+    {
+      Registry_Release(s_Segments[i].ProgramIndex);
+      s_Programs[i] = NULL;
+    }
+  }
+  s_Active = false;
+}
+
+const SegmentStats *Segments_GetStats()
+{
+  return &s_Stats;
+}
+
+void Segments_ClearStats()
+{
+  memset(&s_Stats, 0, sizeof(s_Stats));
+}
+
+void Segments_PrintStats()
+{
+  Serial.print(F("Segments: "));
+  Serial.print(s_NumSegments);
+  Serial.print(F("; Frames: "));
+  Serial.print(s_Stats.Frames);
+  Serial.print(F("; Deferred: "));
+  Serial.println(s_Stats.DeferredUpdates);
+}
+
+/*** PRIVATE FUNCTIONS ***/
+static bool Segments_IsValid(const SegmentConfig *inSegments, uint8_t inCount)
+{
+  if ((inCount > SEGMENTS_MAX) || (inCount > PROGRAM_SLOTS))
+  {
+    return false;
+  }
+  for (uint8_t i = 0; i < inCount; i++)
+  {
+    const SegmentConfig *lvSegment = &inSegments[i];
+    if ((lvSegment->Length == 0) || (lvSegment->Start >= DEFAULT_NUM_LEDS) || (lvSegment->Length > (DEFAULT_NUM_LEDS - lvSegment->Start)))
+    {
+      return false;
+    }
+    if ((lvSegment->ProgramIndex < 0) || (lvSegment->ProgramIndex >= g_NumPrograms))
+    {
+      return false;
+    }
+    for (uint8_t j = 0; j < i; j++)
+    {
+      // a program instance holds the state of one animation, it cannot render two segments
+      if (inSegments[j].ProgramIndex == lvSegment->ProgramIndex)
+      {
+        return false;
+      }
+      if ((lvSegment->Start < (inSegments[j].Start + inSegments[j].Length)) && (inSegments[j].Start < (lvSegment->Start + lvSegment->Length)))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
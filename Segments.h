@@ -0,0 +1,39 @@
+#ifndef SEGMENTS_H
+#define SEGMENTS_H
+
+/*** INCLUDES ***/
+#include "Settings.h"
+
+/*** DEFINES ***/
+#define SEGMENTS_MAX              4
+#define SEGMENTS_BUDGET_PERCENT   75      // part of the frame period available for rendering, the rest is left for the output
+
+/*** TYPE DEFINITIONS ***/
+typedef struct
+{
+  uint16_t Start;                         // first LED
+  uint16_t Length;
+  int8_t ProgramIndex;                    // index in g_ProgramRegistry, a program can only run in one segment
+  uint8_t Speed;                          // replaces g_GlobalSettings.Speed while the program renders
+  uint8_t Hue;                            // replaces g_GlobalSettings.Hue while the program renders
+} SegmentConfig;
+
+typedef struct
+{
+  unsigned long Frames;
+  unsigned long DeferredUpdates;          // segment updates moved to the next frame because the frame budget was used up
+} SegmentStats;
+
+/*** PUBLIC FUNCTIONS ***/
+bool Segments_Set(const SegmentConfig *inSegments, uint8_t inCount);
+uint8_t Segments_GetCount(void);
+const SegmentConfig *Segments_Get(uint8_t inIndex);
+
+void Segments_Render(unsigned long inFramePeriodUs);
+void Segments_Stop(void);
+
+const SegmentStats *Segments_GetStats(void);
+void Segments_ClearStats(void);
+void Segments_PrintStats(void);
+
+#endif //SEGMENTS_H
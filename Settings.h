@@ -2,10 +2,13 @@
 #define SETTINGS_H
 
 /*** DEVICE SELECTION ***/
+// host/Makefile selects the device on the command line
+#if !defined(LEDSTRIP1) && !defined(LEDSTRIP2) && !defined(LEDSTRIP3) && !defined(LEDSTRIP4) && !defined(LEDSTRIP_HOST)
 //#define LEDSTRIP1   // Tafel LEDs
 //#define LEDSTRIP2   // Spiegel LEDs
 //#define LEDSTRIP3   // Kerstboom
 #define LEDSTRIP4   // Pomp
+#endif
 
 /*** BOARD SELECTION ***/
 
@@ -18,6 +21,7 @@
 #define LEDSTRIP2_NUM_LEDS          300
 #define LEDSTRIP3_NUM_LEDS          200
 #define LEDSTRIP4_NUM_LEDS          7
+#define LEDSTRIP_HOST_NUM_LEDS      10000
 
 #define E131_MAX_CHANNELS_PER_UNIVERSE    510
 
@@ -79,6 +83,19 @@
   #define DEFAULT_BRIGHTNESS        48  
   #define START_LED                 1
 #endif
+#ifdef LEDSTRIP_HOST
+  #define DEVICENAME          "host"
+  #define DEVICENR            0
+  
+  // host/Makefile: no strip, long enough to benchmark the programs on 10k LEDs
+  #define LED_TYPE            WS2812
+  #define COLOR_ORDER         GRB
+  #define DEFAULT_NUM_LEDS    LEDSTRIP_HOST_NUM_LEDS
+  
+  #define E131_UNIVERSE_START 1                // First DMX Universe to listen for
+  #define E131_UNIVERSE_END   4                // Last DMX Universe to listen for: 680 LEDs, the captures in host/data
+  #define E131_CHANNEL_START  1                // First channel in first universe
+#endif
 
 #define DEVICETYPE        "ledstrip"
 #define GROUPNAME         "group"
@@ -86,13 +103,40 @@
 #define LED_VOLTAGE           5
 #define LED_MAX_CURRENT_MA    3800
 
+// host/Makefile builds the sketch for Linux against the Arduino and FastLED shims in host/shim
+#ifdef BOARD_HOST
+  #undef BOARD_ESP32
+  #undef WIFI_ENABLED
+  #define INCLUDE_PROGRAM_SOUND       // no capture, WAV files go through Audio_AnalyzeWav(), see host/main.cpp
+  #ifndef LEDSTRIP4                 // not part of the E1.31 channel layout, see Realtime.h
+    #define INCLUDE_PROGRAM_REALTIME  // no sockets, pcap captures go through Realtime_ReplayPcap(), see host/main.cpp
+    #define INCLUDE_REALTIME_E131
+    #define INCLUDE_REALTIME_DDP
+    #define INCLUDE_REALTIME_ARTNET
+  #endif //LEDSTRIP4
+#endif //BOARD_HOST
+
 #ifdef BOARD_ESP32
   #define FASTLED_INTERRUPT_RETRY_COUNT 0
   #define WIFI_ENABLED
-  //#define INCLUDE_PROGRAM_E131
+  //#define INCLUDE_PROGRAM_REALTIME
+
+  // Protocols of the realtime program
+  #ifdef INCLUDE_PROGRAM_REALTIME
+    #define INCLUDE_REALTIME_E131
+    #define INCLUDE_REALTIME_DDP
+    #define INCLUDE_REALTIME_ARTNET     // port-address 0 is E1.31 universe 1, see ARTNET_UNIVERSE_START in ArtNetReceiver.h
+  #endif //INCLUDE_PROGRAM_REALTIME
+
+  // Render on the loop() core while the previous frame is transmitted from a task on the other core
+  #define ENABLE_DUAL_CORE_OUTPUT
+  #define LED_OUTPUT_CORE             0
+  #define LED_OUTPUT_TASK_PRIORITY    2
+  #define LED_OUTPUT_TASK_STACK_SIZE  2048
 #endif //BOARD_ESP32
 
 #define FASTLED_INTERNAL  // suppress FastLED pragma message warning
+#define USE_GET_MILLISECOND_TIMER   // FastLED beat functions use get_millisecond_timer() (Clock.cpp) instead of millis()
 #include <FastLED.h>
 
 FASTLED_USING_NAMESPACE
@@ -101,7 +145,38 @@ FASTLED_USING_NAMESPACE
 
 /*** DEFINES ***/
 #define ENABLE_DEBUG
-//#define ENABLE_PROFILING
+#if !defined(BOARD_ARDUINO_NANO) && !defined(BOARD_ARDUINO_NANO_HW_CONTROLS)
+  #define ENABLE_PROFILER             // per program Update/post-processing/show timing, see Profiler.h
+  #define PROFILER_MAX_PROGRAMS       32
+  #define PROFILER_PUBLISH_PERIOD_MS  10000
+#endif
+// Program arena (see Registry.h): the running program and the next one during a program change, or one per segment
+#if defined(BOARD_ARDUINO_NANO) || defined(BOARD_ARDUINO_NANO_HW_CONTROLS)
+  #define PROGRAM_SLOTS               2
+#else
+  #define PROGRAM_SLOTS               4
+#endif
+#ifdef BOARD_HOST
+  #define PROGRAM_SLOT_SIZE           128         // 64 bit pointers
+#else
+  #define PROGRAM_SLOT_SIZE           64          // bytes, checked at compile time for every registered program
+#endif
+// State arena (see StateArena.h): simulation state of the running programs, allocated in Start() and sized from NUM_LEDS
+#if defined(BOARD_ARDUINO_NANO) || defined(BOARD_ARDUINO_NANO_HW_CONTROLS)
+  #define STATE_ARENA_SIZE            (DEFAULT_NUM_LEDS * 2 + 64)
+#else
+  #define STATE_ARENA_SIZE            (DEFAULT_NUM_LEDS * 3 + 2048)   // + particle pools and palettes, see Particles.h
+#endif
+// Expanded palettes (see Palettes.h), 768 bytes each
+#if defined(BOARD_ARDUINO_NANO) || defined(BOARD_ARDUINO_NANO_HW_CONTROLS)
+  #define PALETTE_CACHE_SLOTS         1
+#else
+  #define PALETTE_CACHE_SLOTS         3
+#endif
+#define ENABLE_BENCHMARK              // 'b' on the serial console renders all programs and reports the cost, see Benchmark.h
+#if !defined(BOARD_ARDUINO_NANO) && !defined(BOARD_ARDUINO_NANO_HW_CONTROLS)
+  #define ENABLE_GOLDEN_FRAMES        // 'g'/'G' on the serial console record/compare frame hashes of all programs, see GoldenFrames.h
+#endif
 
 #ifdef BOARD_ESP32
   #define DATA_PIN            4
@@ -117,6 +192,16 @@ FASTLED_USING_NAMESPACE
 
 
 //#define INCLUDE_PROGRAM_SOUND
+// Audio capture for Program_Sound (see Audio.h)
+#ifdef BOARD_ESP32
+  #define AUDIO_SAMPLE_RATE           20480           // Hz, 80 Hz per FFT bin
+  #define AUDIO_ADC_CHANNEL           ADC1_CHANNEL_0  // GPIO36
+  #define AUDIO_TASK_CORE             0
+  #define AUDIO_TASK_PRIORITY         1               // below the LED output task
+  #define AUDIO_TASK_STACK_SIZE       3072
+#else
+  #define AUDIO_SAMPLE_RATE           38462           // Hz, free running ADC: 16 MHz / 32 / 13 cycles
+#endif
 
 #ifdef BOARD_ARDUINO_NANO_HW_CONTROLS
   #define HAS_ANALOG_INPUTS
@@ -158,6 +243,8 @@ FASTLED_USING_NAMESPACE
   #define MQTT_TOPIC_STATUS                     DEVICETYPE "/" DEVICENAME "/status"
   #define MQTT_TOPIC_SET                        DEVICETYPE "/" DEVICENAME "/set"  
   #define MQTT_TOPIC_CONFIG                     DEVICETYPE "/" DEVICENAME "/config"
+  #define MQTT_TOPIC_STATS                      DEVICETYPE "/" DEVICENAME "/stats"
+  #define MQTT_TOPIC_SEGMENTS                   DEVICETYPE "/" DEVICENAME "/segments"
   #define MQTT_TOPIC_GROUP                      DEVICETYPE "/" GROUPNAME
   #define MQTT_HOMEASSISTANT_DISCOVERY_PREFIX   "homeassistant"
   
@@ -182,6 +269,11 @@ FASTLED_USING_NAMESPACE
 
 #define FRAMES_PER_SECOND         30 //120
 
+#define MAX_FRAMES_PER_SECOND     60
+#define FRAME_PERIOD_MIN_US       (1000000UL / MAX_FRAMES_PER_SECOND)
+#define FRAME_LATE_THRESHOLD_US   1000      // frames started later than this are counted as late
+#define FRAME_MAX_CATCHUP         4         // max number of periods to catch up, skip frames when further behind
+
 #define MIN_SPEED                 0
 #define MAX_SPEED                 255
 #ifndef DEFAULT_SPEED
@@ -212,6 +304,14 @@ FASTLED_USING_NAMESPACE
 #define DEFAULT_MIRROR_MODE       false
 #define DEFAULT_REVERSE_MODE      false
 
+// Physical arrangement of the LEDs, see Mapping.cpp
+#define LED_LAYOUT_STRIP          0         // single line
+#define LED_LAYOUT_FOLD           1         // strip folded in the middle, both halves run side by side
+#define LED_LAYOUT_SERPENTINE     2         // matrix of LED_MATRIX_WIDTH columns, every other row runs backwards
+#ifndef LED_LAYOUT
+  #define LED_LAYOUT                LED_LAYOUT_STRIP
+#endif //LED_LAYOUT
+
 #ifndef START_LED
   #define START_LED                 0
 #endif //START_LED  
@@ -237,14 +337,14 @@ typedef struct
 } GlobalSettings;
 
 
-extern CRGB g_LEDS[DEFAULT_NUM_LEDS];
+extern CRGB g_LEDBuffer[DEFAULT_NUM_LEDS];   // complete strip
+extern CRGB *g_LEDS;                        // LEDs of the running program: the complete strip or a segment
 extern GlobalSettings g_GlobalSettings;
 
 extern uint16_t         g_NumLeds;
 #define NUM_LEDS        g_NumLeds
 
 #include "CProgram.h"
-extern CLEDProgram *g_LEDPrograms[];
 
 extern const uint8_t g_NumPrograms;
 extern int8_t g_NextProgramIndex;
@@ -0,0 +1,164 @@
+/*** INCLUDES ***/
+#include "Settings.h"
+#include "StateArena.h"
+
+/*** DEFINES ***/
+#define STATE_ALIGN             ((sizeof(void *) > 4) ? 8 : 4)    // the state of some programs holds pointers
+#define STATE_ALIGN_UP(n)       (((n) + (STATE_ALIGN - 1)) & ~(STATE_ALIGN - 1))
+#define STATE_ARENA_BYTES       ((uint16_t)STATE_ALIGN_UP(STATE_ARENA_SIZE))
+#define STATE_HEADER_SIZE       ((uint16_t)STATE_ALIGN_UP(sizeof(StateBlock)))
+
+/*** TYPE DEFINITIONS ***/
+typedef struct
+{
+  const void *Owner;                      // NULL: free block
+  uint16_t Size;                          // bytes including this header
+} StateBlock;
+
+typedef union
+{
+  void *AlignPointer;
+  uint32_t AlignLong;
+  uint8_t Bytes[STATE_ARENA_BYTES];
+} StateArenaStorage;
+
+/*** FORWARD DECLARATIONS ***/
+static StateBlock *StateArena_Block(uint16_t inOffset);
+
+/*** PRIVATE VARIABLES ***/
+// Blocks are laid out back to back, a program holds at most one block
+static StateArenaStorage s_Arena;
+static StateArenaStats s_Stats;
+
+/*** PUBLIC FUNCTIONS ***/
+
+// One free block spanning the complete arena
+void StateArena_Init()
+{
+  StateBlock *lvBlock = StateArena_Block(0);
+  lvBlock->Owner = NULL;
+  lvBlock->Size = STATE_ARENA_BYTES;
+  s_Stats.Used = 0;
+}
+
+// Zeroed block of inSize bytes for inOwner, the previous block of inOwner is freed first.
+// Returns NULL if there is no free block that is large enough.
+void *StateArena_Alloc(const void *inOwner, uint16_t inSize)
+{
+  uint16_t lvSize = STATE_HEADER_SIZE + STATE_ALIGN_UP(inSize);
+  uint16_t lvOffset = 0;
+
+  StateArena_Free(inOwner);
+  while (lvOffset < STATE_ARENA_BYTES)
+  {
+    StateBlock *lvBlock = StateArena_Block(lvOffset);
+    if ((lvBlock->Owner == NULL) && (lvBlock->Size >= lvSize))
+    {
+      if ((lvBlock->Size - lvSize) > STATE_HEADER_SIZE)
+      {
+        // split: the rest stays free
+        StateBlock *lvRest = StateArena_Block(lvOffset + lvSize);
+        lvRest->Owner = NULL;
+        lvRest->Size = lvBlock->Size - lvSize;
+        lvBlock->Size = lvSize;
+      }
+      lvBlock->Owner = inOwner;
+      s_Stats.Used += lvBlock->Size;
+      if (s_Stats.Used > s_Stats.Peak)
+      {
+        s_Stats.Peak = s_Stats.Used;
+      }
+      memset(&s_Arena.Bytes[lvOffset + STATE_HEADER_SIZE], 0, lvBlock->Size - STATE_HEADER_SIZE);
+      return &s_Arena.Bytes[lvOffset + STATE_HEADER_SIZE];
+    }
+    lvOffset += lvBlock->Size;
+  }
+  s_Stats.Failures++;
+  return NULL;
+}
+
+// Free the block of inOwner and merge it with the free blocks around it
+void StateArena_Free(const void *inOwner)
+{
+  uint16_t lvOffset = 0;
+  StateBlock *lvFree = NULL;            // first block of a run of free blocks
+
+  while (lvOffset < STATE_ARENA_BYTES)
+  {
+    StateBlock *lvBlock = StateArena_Block(lvOffset);
+    lvOffset += lvBlock->Size;
+    if ((lvBlock->Owner != NULL) && (lvBlock->Owner == inOwner))
+    {
+      s_Stats.Used -= lvBlock->Size;
+      lvBlock->Owner = NULL;
+    }
+    if (lvBlock->Owner != NULL)
+    {
+      lvFree = NULL;
+    }
+    else if (lvFree == NULL)
+    {
+      lvFree = lvBlock;
+    }
+    else
+    {
+      lvFree->Size += lvBlock->Size;
+    }
+  }
+}
+
+// Largest size StateArena_Alloc() can return for inOwner now, the block of inOwner counts as free
+uint16_t StateArena_MaxAlloc(const void *inOwner)
+{
+  uint16_t lvOffset = 0;
+  uint16_t lvRun = 0;                   // size of the current run of free blocks
+  uint16_t lvMax = 0;
+
+  while (lvOffset < STATE_ARENA_BYTES)
+  {
+    StateBlock *lvBlock = StateArena_Block(lvOffset);
+    lvOffset += lvBlock->Size;
+    if ((lvBlock->Owner == NULL) || (lvBlock->Owner == inOwner))
+    {
+      lvRun += lvBlock->Size;
+      if (lvRun > lvMax)
+      {
+        lvMax = lvRun;
+      }
+    }
+    else
+    {
+      lvRun = 0;
+    }
+  }
+  return (lvMax > STATE_HEADER_SIZE) ? (lvMax - STATE_HEADER_SIZE) : 0;
+}
+
+const StateArenaStats *StateArena_GetStats()
+{
+  return &s_Stats;
+}
+
+void StateArena_ClearStats()
+{
+  s_Stats.Peak = s_Stats.Used;
+  s_Stats.Failures = 0;
+}
+
+void StateArena_PrintStats()
+{
+  Serial.print(F("State arena: "));
+  Serial.print(s_Stats.Used);
+  Serial.print(F("/"));
+  Serial.print(STATE_ARENA_BYTES);
+  Serial.print(F("; Peak: "));
+  Serial.print(s_Stats.Peak);
+  Serial.print(F("; Failures: "));
+  Serial.println(s_Stats.Failures);
+}
+
+/*** PRIVATE FUNCTIONS ***/
+static StateBlock *StateArena_Block(uint16_t inOffset)
+{
+  return (StateBlock *)&s_Arena.Bytes[inOffset];
+}
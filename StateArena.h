@@ -0,0 +1,25 @@
+#ifndef STATEARENA_H
+#define STATEARENA_H
+
+/*** INCLUDES ***/
+#include <stdint.h>                       // included by CProgram.h, so not Settings.h
+
+/*** TYPE DEFINITIONS ***/
+typedef struct
+{
+  uint16_t Used;                          // bytes including the block headers
+  uint16_t Peak;
+  unsigned long Failures;                 // allocations that did not fit
+} StateArenaStats;
+
+/*** PUBLIC FUNCTIONS ***/
+void StateArena_Init(void);
+void *StateArena_Alloc(const void *inOwner, uint16_t inSize);
+void StateArena_Free(const void *inOwner);
+uint16_t StateArena_MaxAlloc(const void *inOwner);
+
+const StateArenaStats *StateArena_GetStats(void);
+void StateArena_ClearStats(void);
+void StateArena_PrintStats(void);
+
+#endif //STATEARENA_H
@@ -0,0 +1,48 @@
+/*** INCLUDES ***/
+#include "Settings.h"
+#include "Tile.h"
+
+/*** PUBLIC FUNCTIONS ***/
+
+void Tile_Fill(CRGB *outLEDs, uint16_t inNumLeds, const CRGB *inTile, uint16_t inSize, uint16_t inPhase)
+{
+  uint16_t lvFilled = min(inSize, inNumLeds);
+  uint16_t lvHead = min((uint16_t)(inSize - inPhase), lvFilled);
+
+  // one period, rotated to the phase
+  memcpy(outLEDs, &inTile[inPhase], lvHead * sizeof(CRGB));
+  memcpy(&outLEDs[lvHead], inTile, (lvFilled - lvHead) * sizeof(CRGB));
+
+  // the filled part is a whole number of periods: copy it behind itself, doubling it every time
+  while (lvFilled < inNumLeds)
+  {
+    uint16_t lvCopy = min(lvFilled, (uint16_t)(inNumLeds - lvFilled));
+    memcpy(&outLEDs[lvFilled], outLEDs, lvCopy * sizeof(CRGB));
+    lvFilled += lvCopy;
+  }
+}
+
+uint16_t Tile_Scroll(uint16_t inPhase, int16_t inSteps, uint16_t inSize)
+{
+  int32_t lvPhase = ((int32_t)inPhase + inSteps) % inSize;
+  return (lvPhase < 0) ? (lvPhase + inSize) : lvPhase;
+}
+
+// Render the tile in the next update
+void Tile_Invalidate(TileCache *outCache)
+{
+  outCache->NumLeds = 0;
+}
+
+// True if the settings or the strip length changed since the previous call, the tile has to be rendered again
+bool Tile_Changed(TileCache *ioCache, uint16_t inNumLeds)
+{
+  if ((ioCache->NumLeds == inNumLeds) && (ioCache->Hue == g_GlobalSettings.Hue) && (ioCache->Saturation == g_GlobalSettings.Saturation))
+  {
+    return false;
+  }
+  ioCache->NumLeds = inNumLeds;
+  ioCache->Hue = g_GlobalSettings.Hue;
+  ioCache->Saturation = g_GlobalSettings.Saturation;
+  return true;
+}
@@ -0,0 +1,28 @@
+#ifndef TILE_H
+#define TILE_H
+
+/*** INCLUDES ***/
+#include "Settings.h"
+
+/*** TYPE DEFINITIONS ***/
+// One pre-rendered period of a periodic pattern, in the state arena of the program.
+// The period is rendered again only when hue, saturation or the strip length change, see Tile_Changed().
+typedef struct
+{
+  CRGB *Pixels;
+  uint16_t NumLeds;                       // 0: not rendered yet
+  uint8_t Hue;
+  uint8_t Saturation;
+} TileCache;
+
+/*** PUBLIC FUNCTIONS ***/
+// Fill a strip with a periodic pattern: LED i gets inTile[(i + inPhase) % inSize].
+// Programs render the tile once and scroll by changing the phase.
+void Tile_Fill(CRGB *outLEDs, uint16_t inNumLeds, const CRGB *inTile, uint16_t inSize, uint16_t inPhase);
+// Phase after scrolling inSteps LEDs, towards the start of the strip for inSteps > 0
+uint16_t Tile_Scroll(uint16_t inPhase, int16_t inSteps, uint16_t inSize);
+
+void Tile_Invalidate(TileCache *outCache);
+bool Tile_Changed(TileCache *ioCache, uint16_t inNumLeds);
+
+#endif //TILE_H
@@ -1,5 +1,8 @@
 /*** INCLUDES ***/
 #include "WiFi_MQTT.h"
+#include "Profiler.h"
+#include "Segments.h"
+#include "Registry.h"
 
 #ifdef WIFI_ENABLED
 
@@ -28,7 +31,7 @@
 #define MS_TIMER_ELAPSED(tim, delay)      ((millis() - tim) >= delay)
 
 // JSON Settings
-const int JSON_BUFFER_SIZE = JSON_OBJECT_SIZE(30);
+const int JSON_BUFFER_SIZE = JSON_OBJECT_SIZE(30) + JSON_ARRAY_SIZE(SEGMENTS_MAX) + SEGMENTS_MAX*JSON_OBJECT_SIZE(5);
 
 
 /*** TYPE DEFINITIONS ***/
@@ -44,10 +47,12 @@ typedef enum {
 static void OTA_Setup(void);
 static void MQTT_Callback(char* inTopic, byte* inPayload, unsigned int inLlength);
 static bool MQTT_ParseJSON(char* inMessage);
+static bool MQTT_ParseSegments(JsonArray& inSegments);
 static void MQTT_Reconnect(void);
 static void MQTT_SetOnline(bool inOnline);
 static void MQTT_Discovery(void);
 static void MQTT_SendConfig(void);
+static void MQTT_SendSegments(void);
 
 /*** PRIVATE VARIABLES ***/
 static WiFi_MQTT_State  s_State;
@@ -192,9 +197,9 @@ void MQTT_SendState()
   
     if (g_NextProgramIndex >= 0)
     {
-      lvRoot["effect"]            = g_LEDPrograms[g_NextProgramIndex]->Name;
+      lvRoot["effect"]            = g_ProgramRegistry[g_NextProgramIndex].Name;
     }
-  
+
     char lvBuffer[lvRoot.measureLength() + 1];
     lvRoot.printTo(lvBuffer, sizeof(lvBuffer));
   
@@ -205,9 +210,55 @@ void MQTT_SendState()
     MSG_DBG_LN(MQTT_TOPIC_STATE);
   
     s_MQTTClient.publish(MQTT_TOPIC_STATE, lvBuffer, true);
+    MQTT_SendSegments();
   }
 }
 
+/*
+    Example stats JSON (durations in us: p50/p99/max):
+  {"effect":"Fire","frames":600,"fps":59.9,"target_fps":60.0,"update":[412,512,530],"show":[24,32,35]}
+*/
+
+void MQTT_SendStats() 
+{
+#ifdef ENABLE_PROFILER
+  if (s_MQTTClient.connected())
+  {
+    ProfilerSummary lvSummary;
+    const char *lvStageNames[PROFILER_NUM_STAGES] = {"update", "show"};
+    
+    for (uint8_t i = 0; i < g_NumPrograms; i++)
+    {
+      if (!Profiler_GetSummary(i, &lvSummary))
+      {
+        // program did not run since the last report
+        continue;
+      }
+      StaticJsonBuffer<JSON_BUFFER_SIZE> lvJSONBuffer;
+      JsonObject& lvRoot = lvJSONBuffer.createObject();
+
+      lvRoot["effect"]            = g_ProgramRegistry[i].Name;
+      lvRoot["frames"]            = lvSummary.Frames;
+      lvRoot["fps"]               = lvSummary.Fps;
+      lvRoot["target_fps"]        = lvSummary.TargetFps;
+      for (uint8_t s = 0; s < PROFILER_NUM_STAGES; s++)
+      {
+        JsonArray& lvStage = lvRoot.createNestedArray(lvStageNames[s]);
+        lvStage.add(lvSummary.Stages[s].P50Us);
+        lvStage.add(lvSummary.Stages[s].P99Us);
+        lvStage.add(lvSummary.Stages[s].MaxUs);
+      }
+
+      char lvBuffer[lvRoot.measureLength() + 1];
+      lvRoot.printTo(lvBuffer, sizeof(lvBuffer));
+    
+      s_MQTTClient.publish(MQTT_TOPIC_STATS, lvBuffer);
+    }
+  }
+  Profiler_StartWindow();
+#endif //ENABLE_PROFILER
+}
+
 /*** PRIVATE FUNCTIONS ***/
 static void OTA_Setup(void)
 {
@@ -405,29 +456,61 @@ static bool MQTT_ParseJSON(char* inMessage)
   if (lvRoot.containsKey("effect") && lvRoot.is<char *>("effect"))
   {
     const char *lvEffect = lvRoot.get<char *>("effect");
-    int i;
-    for (i = 0; i < g_NumPrograms; i++)
+    int8_t lvIndex = Registry_Find(lvEffect);
+    if (lvIndex >= 0)
     {
-      if (strcmp(g_LEDPrograms[i]->Name, lvEffect) == 0)
-      {
-        g_GlobalSettings.AutoCyclePrograms = false;
-        g_NextProgramIndex = i;
-        MSG_DBG("Next Effect: ");
-        MSG_DBG(g_NextProgramIndex);
-        MSG_DBG(" -> ");
-        MSG_DBG_LN(lvEffect);
-        break;
-      }
+      g_GlobalSettings.AutoCyclePrograms = false;
+      g_NextProgramIndex = lvIndex;
+      MSG_DBG("Next Effect: ");
+      MSG_DBG(g_NextProgramIndex);
+      MSG_DBG(" -> ");
+      MSG_DBG_LN(lvEffect);
     }
-    if (i >= g_NumPrograms)
+    else
     {
       MSG_DBG("Unknown effect: ");
       MSG_DBG_LN(lvEffect);
     }
   }
+  if (lvRoot.containsKey("segments") && lvRoot.is<JsonArray>("segments"))
+  {
+    if (!MQTT_ParseSegments(lvRoot["segments"].as<JsonArray&>()))
+    {
+      MSG_DBG_LN("MQTT_ParseJSON: invalid segments");
+    }
+  }
   return true;
 }
 
+// "segments":[{"start":0,"length":60,"effect":"Fire","Speed":128,"Hue":0}, ...]
+// Speed and Hue are optional, an empty array removes all segments.
+static bool MQTT_ParseSegments(JsonArray& inSegments)
+{
+  SegmentConfig lvSegments[SEGMENTS_MAX];
+  uint8_t lvCount = inSegments.size();
+
+  if (lvCount > SEGMENTS_MAX)
+  {
+    return false;
+  }
+  for (uint8_t i = 0; i < lvCount; i++)
+  {
+    JsonObject& lvSegment = inSegments[i].as<JsonObject&>();
+    if (!lvSegment.success() || !lvSegment.is<unsigned short>("start") || !lvSegment.is<unsigned short>("length") || !lvSegment.is<char *>("effect"))
+    {
+      return false;
+    }
+    lvSegments[i].Start = lvSegment.get<unsigned short>("start");
+    lvSegments[i].Length = lvSegment.get<unsigned short>("length");
+    lvSegments[i].ProgramIndex = Registry_Find(lvSegment.get<char *>("effect"));
+    lvSegments[i].Speed = lvSegment.is<unsigned char>("Speed") ? lvSegment.get<unsigned char>("Speed") : g_GlobalSettings.Speed;
+    lvSegments[i].Hue = lvSegment.is<unsigned char>("Hue") ? lvSegment.get<unsigned char>("Hue") : g_GlobalSettings.Hue;
+  }
+  MSG_DBG("Segments: ");
+  MSG_DBG_LN(lvCount);
+  return Segments_Set(lvSegments, lvCount);
+}
+
 static void MQTT_SetOnline(bool inOnline)
 {
   if (inOnline)
@@ -461,7 +544,7 @@ static void MQTT_Discovery()
   JsonArray& lvEffects = lvRoot.createNestedArray("effect_list");
   for (int i = 0; i < g_NumPrograms; i++)
   {
-    lvEffects.add(g_LEDPrograms[i]->Name);
+    lvEffects.add(g_ProgramRegistry[i].Name);
   }
 
   char lvBuffer[lvRoot.measureLength() + 1];
@@ -493,6 +576,34 @@ static void MQTT_SendConfig()
 
   s_MQTTClient.publish(MQTT_TOPIC_CONFIG, lvBuffer, true);
 }
+
+/*
+    Example segments JSON, published separately: with SEGMENTS_MAX segments the state message would exceed MQTT_MAX_PACKET_SIZE
+  {"segments":[{"start":0,"length":60,"effect":"Fire","Speed":128,"Hue":0},{"start":60,"length":60,"effect":"Twinkle","Speed":30,"Hue":160}]}
+*/
+static void MQTT_SendSegments()
+{
+  StaticJsonBuffer<JSON_BUFFER_SIZE> lvJSONBuffer;
+  JsonObject& lvRoot = lvJSONBuffer.createObject();
+
+  JsonArray& lvSegments = lvRoot.createNestedArray("segments");
+  for (uint8_t i = 0; i < Segments_GetCount(); i++)
+  {
+    const SegmentConfig *lvConfig = Segments_Get(i);
+    JsonObject& lvSegment = lvSegments.createNestedObject();
+    lvSegment["start"]          = lvConfig->Start;
+    lvSegment["length"]         = lvConfig->Length;
+    lvSegment["effect"]         = g_ProgramRegistry[lvConfig->ProgramIndex].Name;
+    lvSegment["Speed"]          = lvConfig->Speed;
+    lvSegment["Hue"]            = lvConfig->Hue;
+  }
+
+  char lvBuffer[lvRoot.measureLength() + 1];
+  lvRoot.printTo(lvBuffer, sizeof(lvBuffer));
+
+  s_MQTTClient.publish(MQTT_TOPIC_SEGMENTS, lvBuffer, true);
+}
+
 static void MQTT_Reconnect() 
 {
   // Loop until we're reconnected
@@ -9,5 +9,6 @@ void WiFi_MQTT_Init(void);
 bool WiFi_MQTT_IsConnected(void);
 void WiFi_MQTT_Tick(void);
 void MQTT_SendState(void);
+void MQTT_SendStats(void);
 
 #endif // WIFI_ENABLED
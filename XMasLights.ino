@@ -5,34 +5,31 @@
 #include "Programs.h"
 
 #include "WiFi_MQTT.h"
+#include "FrameScheduler.h"
+#include "LEDOutput.h"
+#include "Profiler.h"
+#include "Benchmark.h"
+#include "GoldenFrames.h"
+#include "Segments.h"
+#include "Mapping.h"
+#include "Registry.h"
+#include "StateArena.h"
+#include "Random.h"
+#include "Audio.h"
+#include "AudioBus.h"
+#include "Realtime.h"
 
-// Gradient palette "bhw2_xmas_gp", originally from
-// http://soliton.vm.bytemark.co.uk/pub/cpt-city/bhw/bhw2/tn/bhw2_xmas.png.index.html
-// converted for FastLED with gammas (2.6, 2.2, 2.5)
-// Size: 48 bytes of program space.
-
-DEFINE_GRADIENT_PALETTE( bhw2_xmas_gp ) {
-    0,   0, 12,  0,
-   40,   0, 55,  0,
-   66,   1,117,  2,
-   77,   1, 84,  1,
-   81,   0, 55,  0,
-  119,   0, 12,  0,
-  153,  42,  0,  0,
-  181, 121,  0,  0,
-  204, 255, 12,  8,
-  224, 121,  0,  0,
-  244,  42,  0,  0,
-  255,  42,  0,  0};
-    
 /*** TYPE DEFINITIONS ***/
 typedef void (*LEDPatternFcn)(void);
 
 /*** FORWARD DECLARATIONS ***/
-static void LEDPattern_Sparkles(void);
+static void Program_Release(void);
+static CLEDProgram *Program_Acquire(int8_t inIndex);
+static void Program_SetWindow(int8_t inIndex);
 
 /*** GLOBALS ***/
-CRGB g_LEDS[DEFAULT_NUM_LEDS];
+CRGB g_LEDBuffer[DEFAULT_NUM_LEDS];
+CRGB *g_LEDS = g_LEDBuffer;
 
 GlobalSettings g_GlobalSettings =
 {
@@ -53,70 +50,66 @@ GlobalSettings g_GlobalSettings =
   .Reverse = DEFAULT_REVERSE_MODE
 };
 
-CLEDProgram *g_LEDPrograms[] = {
-  new Program_Solid("Solid", 1),
-  new Program_Solid("Solid2", 2),
-  new Program_Solid("Solid3", 3),  
+// Programs are only constructed while they run, see Registry.h
+const ProgramEntry g_ProgramRegistry[] = {
+  PROGRAM_VARIANT("Solid", Program_Solid, 1),
+  PROGRAM_VARIANT("Solid2", Program_Solid, 2),
+  PROGRAM_VARIANT("Solid3", Program_Solid, 3),  
 #ifdef LEDSTRIP4  
-  new Program_Solid("Solid1a", 1, 1),
-  new Program_Solid("Solid2a", 2, 1),
-  new Program_Solid("Solid3a", 3, 1),  
-  new Program_Solid("Solid6a", 6, 1),  
+  PROGRAM_VARIANT_AT("Solid1a", Program_Solid, 1, START_LED),
+  PROGRAM_VARIANT_AT("Solid2a", Program_Solid, 2, START_LED),
+  PROGRAM_VARIANT_AT("Solid3a", Program_Solid, 3, START_LED),  
+  PROGRAM_VARIANT_AT("Solid6a", Program_Solid, 6, START_LED),  
 #endif //LEDSTRIP4
 #ifndef LEDSTRIP4    
-  new Program_Chase("Chase", 1),
-  new Program_Chase("Chase2", 5),
-  new Program_Chase("Chase3", 10),
+  PROGRAM_VARIANT("Chase", Program_Chase, 1),
+  PROGRAM_VARIANT("Chase2", Program_Chase, 5),
+  PROGRAM_VARIANT("Chase3", Program_Chase, 10),
 #else 
-  new Program_Chase("Chase", 1, 0),
-  new Program_Chase("Chase2", 2, 1),
-  new Program_Chase("Chase3", 1, 1),
+  PROGRAM_VARIANT("Chase", Program_Chase, 1),
+  PROGRAM_VARIANT_AT("Chase2", Program_Chase, 2, START_LED),
+  PROGRAM_VARIANT_AT("Chase3", Program_Chase, 1, START_LED),
 #endif //LEDSTRIP4    
-  new Program_Breathe,
-  new Program_Strobe,
-  new Program_ColorWipe(START_LED),
-  new Program_Rainbow, 
-  new Program_Gradient, 
+  PROGRAM("Breathe", Program_Breathe),
+  PROGRAM_MANUAL("Strobe", Program_Strobe),
+  PROGRAM_AT("ColorWipe", Program_ColorWipe, START_LED),
+  PROGRAM("Rainbow", Program_Rainbow), 
+  PROGRAM("Gradient", Program_Gradient), 
 #ifndef LEDSTRIP4  
-  new Program_Twinkle, 
-  new Program_Glitter,
-  new Program_Fire, 
-  new Program_Meteor,//("Meteor", false),
-  //new Program_Meteor("Meteor2", true), 
-  new Program_Confetti, 
-  new Program_Juggle,
-  new Program_Bubble,
-  new Program_Magnets, 
-  new Program_Christmas
+  PROGRAM_VARIANT("Twinkle", Program_Twinkle, TWINKLE_DENSITY),
+  PROGRAM_VARIANT("Twinkle2", Program_Twinkle, 64),
+  PROGRAM("Glitter", Program_Glitter),
+  PROGRAM("Fire", Program_Fire), 
+  PROGRAM("Meteor", Program_Meteor),
+  PROGRAM("Confetti", Program_Confetti), 
+  PROGRAM("Juggle", Program_Juggle),
+  PROGRAM("Bubble", Program_Bubble),
+  PROGRAM("Magnets", Program_Magnets), 
+  PROGRAM("Christmas", Program_Christmas),
 #endif //LEDSTRIP4  
 #ifdef INCLUDE_PROGRAM_SOUND
-  ,new Program_Sound
+  PROGRAM("Sound", Program_Sound),
 #endif //INCLUDE_PROGRAM_SOUND
-#ifdef INCLUDE_PROGRAM_E131
-  ,new Program_E131
-#endif //INCLUDE_PROGRAM_E131
+#ifdef INCLUDE_PROGRAM_REALTIME
+  PROGRAM_MANUAL("Realtime", Program_Realtime),
+#endif //INCLUDE_PROGRAM_REALTIME
 };
 
 #ifdef WIFI_ENABLED
-CLEDProgram *g_Program_Connecting = new Program_Connecting();
-#endif WIFI_ENABLED
+static Program_Connecting s_ProgramConnecting;
+CLEDProgram *g_Program_Connecting = &s_ProgramConnecting;
+#endif //WIFI_ENABLED
 
-#define NUM_PROGRAMS    (sizeof(g_LEDPrograms)/sizeof(g_LEDPrograms[0]))
+#define NUM_PROGRAMS    (sizeof(g_ProgramRegistry)/sizeof(g_ProgramRegistry[0]))
+static_assert(NUM_PROGRAMS <= (REGISTRY_BUCKETS / 2), "Increase REGISTRY_BUCKETS");
 const uint8_t g_NumPrograms = NUM_PROGRAMS;
 uint16_t g_NumLeds = DEFAULT_NUM_LEDS;
 
-CLEDProgram *g_CurrentProgram = g_LEDPrograms[0];
+CLEDProgram *g_CurrentProgram = NULL;
 
 static int8_t s_ProgramIndex = -1;
 int8_t g_NextProgramIndex = 0;
 
-#ifdef ENABLE_PROFILING
-  static unsigned long s_DurationMin;
-  static unsigned long s_DurationMax;
-  static unsigned long s_DurationSum;
-  static unsigned long s_DurationCount;
-#endif //ENABLE_PROFILING
-
 
 /*** SETUP ***/
 void setup() 
@@ -128,8 +121,14 @@ void setup()
     Serial.begin(115200);
   #endif
   
+  Registry_Init();
+  StateArena_Init();
+  Random_SeedFromEntropy();
+
   // Set LED strip configuration
-  FastLED.addLeds<LED_TYPE, DATA_PIN, COLOR_ORDER>(g_LEDS, DEFAULT_NUM_LEDS).setCorrection(TypicalLEDStrip);
+  Mapping_Update();
+  NUM_LEDS = Mapping_GetNumLeds();
+  LEDOutput_Init();
 
   // Limit current
   FastLED.setMaxPowerInVoltsAndMilliamps(LED_VOLTAGE,LED_MAX_CURRENT_MA); 
@@ -147,54 +146,66 @@ void setup()
     pinMode(DIGITAL_IN_1, INPUT);
   #endif //HAS_DIGITAL_INPUTS
   
-  #ifdef ENABLE_PROFILING
-    s_DurationSum = 0;
-    s_DurationCount = 0;
-    s_DurationMin = 9999999;
-    s_DurationMax = 0;
-  #endif // ENABLE_PROFILING
+  #ifdef ENABLE_PROFILER
+    Profiler_StartWindow();
+  #endif // ENABLE_PROFILER
 
 
   Serial.println("Program List:");
-  for (int i = 0; i < NUM_PROGRAMS; i++)
+  for (int i = 0; i < g_NumPrograms; i++)
   {
     Serial.print(i);
     Serial.print(": ");
-    Serial.println(g_LEDPrograms[i]->Name);
+    Serial.println(g_ProgramRegistry[i].Name);
   }
 }
 
 /*** MAIN LOOP ***/
 void loop() 
 {
-  static unsigned long s_LastRunTimeMs = 0;
   static unsigned long s_LastProgramStartTimeMs = 0;
   static unsigned long s_LastHueChangeTimeMs = 0;
+  static unsigned long s_LastUpdateTimeUs = 0;
   static bool s_WasEnabled = true;
   
 #ifdef WIFI_ENABLED
   static bool s_SendUpdate = false;
   WiFi_MQTT_Tick();
 #endif // WIFI_ENABLED
+  LEDOutput_Tick();
+#ifdef INCLUDE_PROGRAM_SOUND
+  Audio_Tick();
+#endif //INCLUDE_PROGRAM_SOUND
 
   if (!g_GlobalSettings.Enabled)
   {
     if (s_WasEnabled)
     {
       Serial.println(F("Output Disabled")); 
-      FastLED.clear();
-      FastLED.show();
+      LEDOutput_Clear();
     }
     s_WasEnabled = false;
   }
   else
   {
     bool lvDoUpdate = false;
-    bool lvRunDone = false;
+    bool lvSegmentMode;
+    
+    // Mirror/Reverse changed: rebuild the pixel map
+    if (Mapping_Update())
+    {
+      // the programs see a different number of LEDs, restart them
+      NUM_LEDS = Mapping_GetNumLeds();
+      Program_Release();
+      Segments_Stop();
+    }
+    lvSegmentMode = (Segments_GetCount() > 0);
     if (!s_WasEnabled)
     {
       s_LastHueChangeTimeMs = millis();
       s_LastProgramStartTimeMs = millis();
+      s_LastUpdateTimeUs = micros();
+      FrameScheduler_Reset();
       lvDoUpdate = true;
     }
     s_WasEnabled = true;
@@ -204,18 +215,30 @@ void loop()
     #ifdef WIFI_ENABLED
       if (!WiFi_MQTT_IsConnected())
       {
+        if (lvSegmentMode)
+        {
+          Segments_Stop();
+          lvSegmentMode = false;
+        }
+        Program_Release();
         g_CurrentProgram = g_Program_Connecting;
-        s_ProgramIndex = -1;
       }
       else
-    #endif WIFI_ENABLED  
-    if (g_NextProgramIndex != s_ProgramIndex)
+    #endif //WIFI_ENABLED
+    if (lvSegmentMode)
+    {
+      // the segments take over the strip, the selected program is restarted when the segments are removed
+      Program_Release();
+    }
+    else if ((g_NextProgramIndex != s_ProgramIndex) && (Program_Acquire(g_NextProgramIndex) != NULL))
     { 
-      g_CurrentProgram->Stop();
-
-      // change program
+      // change program: the new program is constructed before the previous one is released
+      CLEDProgram *lvNextProgram = Registry_Get(g_NextProgramIndex);
+      Program_Release();
       s_ProgramIndex = g_NextProgramIndex;
-      g_CurrentProgram = g_LEDPrograms[s_ProgramIndex];
+      g_CurrentProgram = lvNextProgram;
+      Program_SetWindow(s_ProgramIndex);
+      fill_solid(g_LEDBuffer, g_LEDS - g_LEDBuffer, CRGB(0,0,0));
       
       // Start new program
       #ifdef ENABLE_DEBUG
@@ -226,8 +249,10 @@ void loop()
       
       g_CurrentProgram->Start();
       s_LastProgramStartTimeMs = millis();
+      s_LastUpdateTimeUs = micros();
 
       // Force Update
+      FrameScheduler_Reset();
       lvDoUpdate = true;
       
       #ifdef WIFI_ENABLED
@@ -235,98 +260,67 @@ void loop()
       #endif // WIFI_ENABLED
     }
  
-    // Insert delay if not running at max speed
-    if ((g_GlobalSettings.Speed < MAX_SPEED) && (!g_CurrentProgram->NoDelay))
+    if (!lvSegmentMode && (g_CurrentProgram != NULL) && g_CurrentProgram->NoDelay)
+    {
+      // Program handles its own timing: update every loop, unless stopped
+      lvDoUpdate = (g_GlobalSettings.Speed > 0);
+    }
+    else
     {
-      unsigned long lvUpdatePeriodMs = g_CurrentProgram->GetUpdatePeriod(g_GlobalSettings.Speed);
-      // insert a delay to keep the framerate modest
+      // Render at MAX_FRAMES_PER_SECOND, the program converts the elapsed time into animation steps
       #ifdef USE_NONBLOCKING_DELAY
-        // non-blocking delay      
-        if ((millis() - s_LastRunTimeMs) >= lvUpdatePeriodMs)
+        // non-blocking: fixed timestep scheduler with microsecond deadlines
+        FrameScheduler_SetPeriod(FRAME_PERIOD_MIN_US);
+        if (FrameScheduler_IsFrameDue())
         {
           lvDoUpdate = true;
         }
       #else
         // blocking delay
-        FastLED.delay(1000UL/(2*g_GlobalSettings.Speed)); 
+        if (g_GlobalSettings.Speed < MAX_SPEED)
+        {
+          delay(1000UL/(2*g_GlobalSettings.Speed)); 
+        }
         lvDoUpdate = true;
       #endif // USE_NONBLOCKING_DELAY
     }
-    else if (g_GlobalSettings.Speed == 0)
-    {
-      // stop updating
-      lvDoUpdate = false;
-    }
-    else
-    {
-      // max speed
-      lvDoUpdate = true;
-    }
     if (lvDoUpdate)
     {
-      unsigned long lvPeriod = millis() - s_LastRunTimeMs;
-      s_LastRunTimeMs = millis();
-
       if (FastLED.getBrightness() != g_GlobalSettings.Brightness)
       {
         FastLED.setBrightness(g_GlobalSettings.Brightness);
       }
       
-      #ifdef ENABLE_PROFILING
-        unsigned long lvDuration;
-        lvDuration = micros();
-      #endif    
+      PROFILER_START(lvStageStartUs);
             
-      lvRunDone = g_CurrentProgram->Update();        
+      unsigned long lvNowUs = micros();
+      unsigned long lvElapsedUs = lvNowUs - s_LastUpdateTimeUs;
+      s_LastUpdateTimeUs = lvNowUs;
 
-      if (g_GlobalSettings.Mirror)
+      LEDOutput_BeginFrame();
+      if (lvSegmentMode)
       {
-        NUM_LEDS = DEFAULT_NUM_LEDS / 2;
-        for (int i = 0; i < NUM_LEDS; i++)
-        {
-          g_LEDS[DEFAULT_NUM_LEDS-1-i] = g_LEDS[i];
-        }
+        // each program renders only into its own segment
+        Segments_Render(FrameScheduler_GetPeriod());
       }
-      else
+      else if (g_CurrentProgram != NULL)
       {
-        NUM_LEDS = DEFAULT_NUM_LEDS;
+        g_CurrentProgram->Update(lvElapsedUs);
       }
+      PROFILER_LAP(lvStageStartUs, s_ProgramIndex, PROFILER_STAGE_UPDATE);
 
-      FastLED.show();
+      LEDOutput_Show();
+      PROFILER_LAP(lvStageStartUs, s_ProgramIndex, PROFILER_STAGE_SHOW);
+      #ifdef INCLUDE_PROGRAM_SOUND
+        AudioBus_FrameShown();
+      #endif // INCLUDE_PROGRAM_SOUND
       
-      #ifdef ENABLE_PROFILING
-        lvDuration = micros() - lvDuration;
-        s_DurationSum += lvDuration;
-        s_DurationCount++;
-        if (lvDuration < s_DurationMin)
+      #ifdef ENABLE_PROFILER
+        if (!lvSegmentMode && (g_CurrentProgram != NULL))
         {
-          s_DurationMin = lvDuration;
+          Profiler_RecordFrame(s_ProgramIndex, g_CurrentProgram->NoDelay ? 0 : FrameScheduler_GetPeriod());
         }
-        if (lvDuration > s_DurationMax)
-        {
-          s_DurationMax = lvDuration;
-        }
-        EVERY_N_MILLISECONDS(1000) 
-        { 
-          Serial.print(F("Count: ")); 
-          Serial.print(s_DurationCount);
-          Serial.print(F("; Avg: ")); 
-          Serial.print((float)s_DurationSum / s_DurationCount);
-          Serial.print(F("; Min: ")); 
-          Serial.print(s_DurationMin);
-          Serial.print(F("; Max: ")); 
-          Serial.print(s_DurationMax);
-          Serial.print(F("; Period: ")); 
-          Serial.print(lvPeriod);
-          Serial.print(F("; Freq: ")); 
-          Serial.println(1000.0f / lvPeriod);
-          
-          s_DurationSum = 0;
-          s_DurationCount = 0;
-          s_DurationMin = 9999999;
-          s_DurationMax = 0;
-        }
-      #endif // ENABLE_PROFILING
+      #endif // ENABLE_PROFILER
     }
     else
     {
@@ -353,11 +347,11 @@ void loop()
         do
         {
           g_NextProgramIndex++;
-          if (g_NextProgramIndex >= NUM_PROGRAMS)
+          if (g_NextProgramIndex >= g_NumPrograms)
           {
             g_NextProgramIndex = 0;
           }      
-        } while (!g_LEDPrograms[g_NextProgramIndex]->IncludeInAutoProgram);
+        } while (!g_ProgramRegistry[g_NextProgramIndex].IncludeInAutoProgram);
         s_LastProgramStartTimeMs = millis();
       }
     }
@@ -373,7 +367,7 @@ void loop()
 //    }
     // Basic CLI
     int lvRecvByte = Serial.read();
-    if (lvRecvByte >= '0' && lvRecvByte < ('0' + NUM_PROGRAMS))
+    if (lvRecvByte >= '0' && lvRecvByte < ('0' + g_NumPrograms))
     {
       g_NextProgramIndex = lvRecvByte - '0';
     }
@@ -414,7 +408,10 @@ void loop()
       Serial.print(F("Hue: ")); 
       Serial.print(g_GlobalSettings.Hue);
       Serial.println();
-      g_CurrentProgram->Start();
+      if (g_CurrentProgram != NULL)
+      {
+        g_CurrentProgram->Start();
+      }
     }
     else if (lvRecvByte == '<')
     {
@@ -423,8 +420,65 @@ void loop()
       Serial.print(F("Hue: ")); 
       Serial.print(g_GlobalSettings.Hue);
       Serial.println();
-      g_CurrentProgram->Start();
+      if (g_CurrentProgram != NULL)
+      {
+        g_CurrentProgram->Start();
+      }
+    }
+    else if (lvRecvByte == 'f')
+    {
+      // print and clear frame timing statistics
+      FrameScheduler_PrintStats();
+      FrameScheduler_ClearStats();
+      LEDOutput_PrintStats();
+      LEDOutput_ClearStats();
+      Segments_PrintStats();
+      Segments_ClearStats();
+      StateArena_PrintStats();
+      StateArena_ClearStats();
+  #ifdef INCLUDE_PROGRAM_SOUND
+      Audio_PrintStats();
+      Audio_ClearStats();
+      AudioBus_PrintStats();
+      AudioBus_ClearStats();
+  #endif // INCLUDE_PROGRAM_SOUND
+  #ifdef INCLUDE_PROGRAM_REALTIME
+      Realtime_PrintStats();
+      Realtime_ClearStats();
+  #endif // INCLUDE_PROGRAM_REALTIME
+    }
+  #ifdef ENABLE_PROFILER
+    else if (lvRecvByte == 'p')
+    {
+      // print per program timing: p50/p99/max [us]
+      Profiler_Print();
+    }
+  #endif // ENABLE_PROFILER
+  #ifdef ENABLE_BENCHMARK
+    else if (lvRecvByte == 'b')
+    {
+      // the running programs are restarted afterwards
+      Program_Release();
+      Segments_Stop();
+      Benchmark_Run();
+    }
+  #endif // ENABLE_BENCHMARK
+  #ifdef ENABLE_GOLDEN_FRAMES
+    else if (lvRecvByte == 'g')
+    {
+      // print frame hashes of all programs for GoldenFrames_Data.h
+      Program_Release();
+      Segments_Stop();
+      GoldenFrames_Record();
     }
+    else if (lvRecvByte == 'G')
+    {
+      // compare all programs with GoldenFrames_Data.h
+      Program_Release();
+      Segments_Stop();
+      GoldenFrames_Compare();
+    }
+  #endif // ENABLE_GOLDEN_FRAMES
     else if (lvRecvByte == '*')
     {
       g_GlobalSettings.AutoCyclePrograms = !g_GlobalSettings.AutoCyclePrograms;
@@ -463,9 +517,8 @@ void loop()
           Serial.print("Speed: ");
           Serial.print(g_GlobalSettings.Speed);
           
-          unsigned long lvUpdatePeriodMs1 = ((MAX_CYCLE_TIME_MS * (255 - g_GlobalSettings.Speed)) / 255) / g_CurrentProgram->TicksPerCycle;
           Serial.print("; Period: ");
-          Serial.println(lvUpdatePeriodMs1);
+          Serial.println((g_CurrentProgram != NULL) ? g_CurrentProgram->GetUpdatePeriodUs(g_GlobalSettings.Speed) : 0);
           
           s_PrevAnalogIn0 = lvAnalog0;
         }
@@ -549,8 +602,45 @@ void loop()
         s_SendUpdate = false;
       }
     }
+    #ifdef ENABLE_PROFILER
+      EVERY_N_MILLISECONDS(PROFILER_PUBLISH_PERIOD_MS)
+      {
+        MQTT_SendStats();
+      }
+    #endif // ENABLE_PROFILER
   #endif // WIFI_ENABLED  
 }
 
 
 /*** PRIVATE FUNCTIONS ***/
+
+// Stop and destroy the selected program, the main loop starts g_NextProgramIndex again
+static void Program_Release()
+{
+  if (s_ProgramIndex >= 0)
+  {
+    Registry_Release(s_ProgramIndex);
+    s_ProgramIndex = -1;
+    g_CurrentProgram = NULL;
+  }
+  Program_SetWindow(-1);
+}
+
+// Construct the program for its part of the strip, the running program keeps its part.
+// Returns NULL if no program slot is free.
+static CLEDProgram *Program_Acquire(int8_t inIndex)
+{
+  CLEDProgram *lvProgram;
+  Program_SetWindow(inIndex);
+  lvProgram = Registry_Acquire(inIndex);
+  Program_SetWindow(s_ProgramIndex);
+  return lvProgram;
+}
+
+// Point g_LEDS and NUM_LEDS at the part of the strip the program runs on, -1: the complete strip
+static void Program_SetWindow(int8_t inIndex)
+{
+  uint8_t lvStartLED = (inIndex >= 0) ? g_ProgramRegistry[inIndex].StartLED : 0;
+  g_LEDS = &g_LEDBuffer[lvStartLED];
+  NUM_LEDS = Mapping_GetNumLeds() - lvStartLED;
+}
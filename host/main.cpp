@@ -0,0 +1,164 @@
+/*** INCLUDES ***/
+#include <stdio.h>
+#include <vector>
+#include "Settings.h"
+#include "Audio.h"
+#include "AudioBus.h"
+#ifdef INCLUDE_PROGRAM_REALTIME
+  #include "Realtime.h"
+#endif //INCLUDE_PROGRAM_REALTIME
+
+/*** FORWARD DECLARATIONS ***/
+// XMasLights.ino
+void setup(void);
+void loop(void);
+
+static bool Host_ReadFile(const char *inPath, std::vector<uint8_t> *outData);
+static int Host_AnalyzeWav(const char *inPath);
+static void Host_PrintAudioFrame(const AudioFrame *inFrame);
+#ifdef INCLUDE_PROGRAM_REALTIME
+static int Host_ReplayPcap(const char *inPath, unsigned long inRepeat);
+#endif //INCLUDE_PROGRAM_REALTIME
+
+/*** PRIVATE VARIABLES ***/
+static AudioWavStats s_WavStats;
+
+/*** PUBLIC FUNCTIONS ***/
+
+// Runs the sketch on a PC. The arguments are typed on the serial console one after the other, e.g.
+//   xmaslights b        benchmark, see Benchmark.h
+//   xmaslights g        print GoldenFrames_Data.h
+// loop() runs until the sketch has read all input, the command of the last character has returned by then.
+// The audio analysis runs on a file instead of the sketch:
+//   xmaslights --wav <file>    16 bit PCM WAV through Audio_AnalyzeWav() and AudioBus, prints every frame, the
+//                              analysis time and the tempo found by the beat tracker
+//   xmaslights --pcap <file> [n]   E1.31, DDP and Art-Net datagrams of a capture through Realtime_ReplayPcap(), n times,
+//                                  prints the receive path throughput and the decoder stats
+int main(int argc, char *argv[])
+{
+  if ((argc == 3) && (strcmp(argv[1], "--wav") == 0))
+  {
+    return Host_AnalyzeWav(argv[2]);
+  }
+#ifdef INCLUDE_PROGRAM_REALTIME
+  if (((argc == 3) || (argc == 4)) && (strcmp(argv[1], "--pcap") == 0))
+  {
+    return Host_ReplayPcap(argv[2], (argc == 4) ? strtoul(argv[3], NULL, 10) : 1);
+  }
+#endif //INCLUDE_PROGRAM_REALTIME
+
+  for (int i = 1; i < argc; i++)
+  {
+    HostSerial_Input(argv[i]);
+  }
+
+  setup();
+  while (HostSerial_Pending() > 0)
+  {
+    loop();
+  }
+  fflush(stdout);
+  return 0;
+}
+
+/*** PRIVATE FUNCTIONS ***/
+
+static bool Host_ReadFile(const char *inPath, std::vector<uint8_t> *outData)
+{
+  FILE *lvFile = fopen(inPath, "rb");
+  if (lvFile == NULL)
+  {
+    fprintf(stderr, "%s: cannot open\n", inPath);
+    return false;
+  }
+  uint8_t lvBuffer[4096];
+  size_t lvLength;
+  while ((lvLength = fread(lvBuffer, 1, sizeof(lvBuffer), lvFile)) > 0)
+  {
+    outData->insert(outData->end(), lvBuffer, lvBuffer + lvLength);
+  }
+  fclose(lvFile);
+  return true;
+}
+
+static int Host_AnalyzeWav(const char *inPath)
+{
+  std::vector<uint8_t> lvWav;
+  AudioBusFrame lvBus;
+
+  if (!Host_ReadFile(inPath, &lvWav))
+  {
+    return 1;
+  }
+  AudioBus_Reset();
+  printf("block, octaves 0..7, bands 0..7, level, peak-peak, onset, beats\n");
+  if (!Audio_AnalyzeWav(lvWav.data(), lvWav.size(), Host_PrintAudioFrame, &s_WavStats) || (s_WavStats.Blocks == 0))
+  {
+    fprintf(stderr, "%s: not a 16 bit PCM WAV file of at least %d samples\n", inPath, AUDIO_FFT_SIZE);
+    return 1;
+  }
+  printf("%s: %lu Hz, %lu blocks, %lu us of audio analysed in %lu us, %.1f us/block, max %lu us\n",
+         inPath, (unsigned long)s_WavStats.SampleRate, s_WavStats.Blocks, s_WavStats.AudioUs, s_WavStats.TotalUs,
+         (double)s_WavStats.TotalUs / s_WavStats.Blocks, s_WavStats.MaxUs);
+  AudioBus_Read(&lvBus);
+  printf("%s: tempo %.2f BPM, confidence %u, %lu onsets, %lu beats\n",
+         inPath, (lvBus.PeriodUs > 0) ? 60000000.0 / lvBus.PeriodUs : 0.0, lvBus.Confidence, lvBus.Onsets, lvBus.Beats);
+  return 0;
+}
+
+// The bus runs on the time of the audio, the end of the block in the file, instead of micros()
+static void Host_PrintAudioFrame(const AudioFrame *inFrame)
+{
+  AudioBusFrame lvBus;
+
+  AudioBus_Publish(inFrame, (unsigned long)(((uint64_t)inFrame->Sequence * AUDIO_FFT_SIZE * 1000000UL) / s_WavStats.SampleRate));
+  AudioBus_Read(&lvBus);
+
+  printf("%lu", inFrame->Sequence);
+  for (uint8_t i = 0; i < AUDIO_NUM_BANDS; i++)
+  {
+    printf(", %u", inFrame->Octaves[i]);
+  }
+  for (uint8_t i = 0; i < AUDIO_NUM_BANDS; i++)
+  {
+    printf(", %u", inFrame->Bands[i]);
+  }
+  printf(", %u, %u, %u, %lu\n", inFrame->Level, inFrame->PeakPeak, lvBus.OnsetBands ? lvBus.OnsetStrength : 0, lvBus.Beats);
+}
+
+#ifdef INCLUDE_PROGRAM_REALTIME
+// Into a frame of the whole strip, like Program_Realtime
+static int Host_ReplayPcap(const char *inPath, unsigned long inRepeat)
+{
+  std::vector<uint8_t> lvPcap;
+  std::vector<uint8_t> lvFrame(DEFAULT_NUM_LEDS * 3);
+  std::vector<CRGB> lvLEDs(DEFAULT_NUM_LEDS);
+  RealtimeOutput lvOutput = {lvFrame.data(), (uint16_t)lvFrame.size(), lvLEDs.data()};
+  RealtimeReplayStats lvStats;
+  RealtimeReplayStats lvTotal;
+
+  if (!Host_ReadFile(inPath, &lvPcap))
+  {
+    return 1;
+  }
+  memset(&lvTotal, 0, sizeof(lvTotal));
+  for (unsigned long i = 0; i < inRepeat; i++)
+  {
+    if (!Realtime_ReplayPcap(lvPcap.data(), lvPcap.size(), &lvOutput, &lvStats) || (lvStats.Packets == 0))
+    {
+      fprintf(stderr, "%s: not a pcap capture with realtime datagrams\n", inPath);
+      return 1;
+    }
+    lvTotal.Packets += lvStats.Packets;
+    lvTotal.Bytes += lvStats.Bytes;
+    lvTotal.Frames += lvStats.Frames;
+    lvTotal.TotalUs += lvStats.TotalUs;
+  }
+  Realtime_PrintStats();
+  printf("%s: %lu packets, %lu bytes, %lu frames in %lu us, %.0f packets/s, %.1f MB/s, %.2f us/frame\n",
+         inPath, lvTotal.Packets, lvTotal.Bytes, lvTotal.Frames, lvTotal.TotalUs,
+         lvTotal.Packets * 1e6 / max(lvTotal.TotalUs, 1UL), lvTotal.Bytes / (double)max(lvTotal.TotalUs, 1UL),
+         (double)lvTotal.TotalUs / max(lvTotal.Frames, 1UL));
+  return 0;
+}
+#endif //INCLUDE_PROGRAM_REALTIME
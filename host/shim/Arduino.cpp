@@ -0,0 +1,179 @@
+/*** INCLUDES ***/
+#include "Arduino.h"
+#include <stdio.h>
+#include <stdarg.h>
+#include <string>
+#include <chrono>
+#include <thread>
+
+/*** PRIVATE VARIABLES ***/
+static const std::chrono::steady_clock::time_point s_StartTime = std::chrono::steady_clock::now();
+static std::string s_SerialInput;
+static size_t s_SerialReadPos = 0;
+
+/*** PUBLIC VARIABLES ***/
+HardwareSerial Serial;
+
+/*** PUBLIC FUNCTIONS ***/
+void HardwareSerial::begin(unsigned long inBaud)
+{
+  (void)inBaud;
+}
+
+int HardwareSerial::available()
+{
+  return HostSerial_Pending();
+}
+
+int HardwareSerial::read()
+{
+  if (s_SerialReadPos >= s_SerialInput.size())
+  {
+    return -1;
+  }
+  return (uint8_t)s_SerialInput[s_SerialReadPos++];
+}
+
+size_t HardwareSerial::write(uint8_t inByte)
+{
+  return fwrite(&inByte, 1, 1, stdout);
+}
+
+size_t HardwareSerial::write(const uint8_t *inData, size_t inLength)
+{
+  return fwrite(inData, 1, inLength, stdout);
+}
+
+size_t HardwareSerial::print(const char *inText)
+{
+  return fputs(inText, stdout) >= 0 ? strlen(inText) : 0;
+}
+
+size_t HardwareSerial::print(char inChar)
+{
+  return write((uint8_t)inChar);
+}
+
+size_t HardwareSerial::print(unsigned char inValue, int inBase)
+{
+  return print((unsigned long)inValue, inBase);
+}
+
+size_t HardwareSerial::print(int inValue, int inBase)
+{
+  return print((long)inValue, inBase);
+}
+
+size_t HardwareSerial::print(unsigned int inValue, int inBase)
+{
+  return print((unsigned long)inValue, inBase);
+}
+
+size_t HardwareSerial::print(long inValue, int inBase)
+{
+  // like Arduino's Print, other bases print the two's complement
+  if (inBase != DEC)
+  {
+    return print((unsigned long)inValue, inBase);
+  }
+  return printf("%ld", inValue);
+}
+
+size_t HardwareSerial::print(unsigned long inValue, int inBase)
+{
+  return printf((inBase == HEX) ? "%lX" : "%lu", inValue);
+}
+
+size_t HardwareSerial::print(double inValue, int inDigits)
+{
+  return printf("%.*f", inDigits, inValue);
+}
+
+size_t HardwareSerial::println()
+{
+  return print("\r\n");
+}
+
+size_t HardwareSerial::printf(const char *inFormat, ...)
+{
+  va_list lvArgs;
+  va_start(lvArgs, inFormat);
+  int lvLength = vprintf(inFormat, lvArgs);
+  va_end(lvArgs);
+  return (lvLength > 0) ? lvLength : 0;
+}
+
+unsigned long millis()
+{
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - s_StartTime).count();
+}
+
+unsigned long micros()
+{
+  // wraps like the 32 bit counter of the controllers
+  return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - s_StartTime).count();
+}
+
+void delay(unsigned long inMs)
+{
+  std::this_thread::sleep_for(std::chrono::milliseconds(inMs));
+}
+
+void delayMicroseconds(unsigned int inUs)
+{
+  std::this_thread::sleep_for(std::chrono::microseconds(inUs));
+}
+
+void yield()
+{
+  fflush(stdout);
+}
+
+void pinMode(uint8_t inPin, uint8_t inMode)
+{
+  (void)inPin;
+  (void)inMode;
+}
+
+int digitalRead(uint8_t inPin)
+{
+  (void)inPin;
+  return LOW;
+}
+
+// A floating input: only used as entropy
+int analogRead(uint8_t inPin)
+{
+  (void)inPin;
+  return rand() & 0x3ff;
+}
+
+long map(long inValue, long inFromLow, long inFromHigh, long inToLow, long inToHigh)
+{
+  return (inValue - inFromLow) * (inToHigh - inToLow) / (inFromHigh - inFromLow) + inToLow;
+}
+
+long random(long inLimit)
+{
+  return (inLimit > 0) ? (rand() % inLimit) : 0;
+}
+
+long random(long inMin, long inLimit)
+{
+  return (inLimit > inMin) ? (inMin + random(inLimit - inMin)) : inMin;
+}
+
+void randomSeed(unsigned long inSeed)
+{
+  srand(inSeed);
+}
+
+void HostSerial_Input(const char *inText)
+{
+  s_SerialInput.append(inText);
+}
+
+int HostSerial_Pending()
+{
+  return (int)(s_SerialInput.size() - s_SerialReadPos);
+}
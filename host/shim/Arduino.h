@@ -0,0 +1,93 @@
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+// The part of the Arduino core the sketch uses, for the host build (see host/Makefile).
+// Serial reads the input given with HostSerial_Input() and prints to stdout, the time is the process' monotonic clock.
+
+/*** INCLUDES ***/
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+/*** DEFINES ***/
+#define F(s)                  (s)
+#define PROGMEM
+#define memcpy_P              memcpy
+#define pgm_read_byte(p)      (*(const uint8_t *)(p))
+#define pgm_read_word(p)      (*(const uint16_t *)(p))
+#define pgm_read_dword(p)     (*(const uint32_t *)(p))
+#define IRAM_ATTR
+
+#define DEC                   10
+#define HEX                   16
+#define INPUT                 0
+#define OUTPUT                1
+#define LOW                   0
+#define HIGH                  1
+#define A0                    14
+#define A1                    15
+#define A2                    16
+
+#define constrain(x, lo, hi)  ((x) < (lo) ? (lo) : ((x) > (hi) ? (hi) : (x)))
+
+/*** TYPE DEFINITIONS ***/
+typedef uint8_t byte;
+typedef bool boolean;
+
+class HardwareSerial
+{
+  public:
+    void begin(unsigned long inBaud);
+    int available(void);
+    int read(void);
+    size_t write(uint8_t inByte);
+    size_t write(const uint8_t *inData, size_t inLength);
+
+    size_t print(const char *inText);
+    size_t print(char inChar);
+    size_t print(unsigned char inValue, int inBase = DEC);
+    size_t print(int inValue, int inBase = DEC);
+    size_t print(unsigned int inValue, int inBase = DEC);
+    size_t print(long inValue, int inBase = DEC);
+    size_t print(unsigned long inValue, int inBase = DEC);
+    size_t print(double inValue, int inDigits = 2);
+
+    size_t println(void);
+    template<typename T> size_t println(T inValue) { return print(inValue) + println(); }
+    template<typename T> size_t println(T inValue, int inFormat) { return print(inValue, inFormat) + println(); }
+
+    size_t printf(const char *inFormat, ...) __attribute__((format(printf, 2, 3)));
+};
+
+/*** PUBLIC VARIABLES ***/
+extern HardwareSerial Serial;
+
+/*** PUBLIC FUNCTIONS ***/
+unsigned long millis(void);
+unsigned long micros(void);
+void delay(unsigned long inMs);
+void delayMicroseconds(unsigned int inUs);
+void yield(void);
+
+void pinMode(uint8_t inPin, uint8_t inMode);
+int digitalRead(uint8_t inPin);
+int analogRead(uint8_t inPin);
+
+long map(long inValue, long inFromLow, long inFromHigh, long inToLow, long inToHigh);
+long random(long inLimit);
+long random(long inMin, long inLimit);
+void randomSeed(unsigned long inSeed);
+
+// Arduino's min()/max() are macros, these take mixed types the same way
+template<typename T, typename U> auto min(T inA, U inB) -> decltype(inA + inB) { return (inA < inB) ? inA : inB; }
+template<typename T, typename U> auto max(T inA, U inB) -> decltype(inA + inB) { return (inA > inB) ? inA : inB; }
+
+// Host only: queue text for Serial.read(), like typing it on the serial console
+void HostSerial_Input(const char *inText);
+// Host only: bytes not yet read by the sketch
+int HostSerial_Pending(void);
+
+#endif //ARDUINO_H
@@ -0,0 +1,700 @@
+/*** INCLUDES ***/
+#include "FastLED.h"
+
+/*** DEFINES ***/
+#define K255                      255
+#define K171                      171
+#define K170                      170
+#define K85                       85
+
+// power model of the library: mW per channel at full value, and per LED
+#define POWER_RED_MW              (16 * 5)
+#define POWER_GREEN_MW            (11 * 5)
+#define POWER_BLUE_MW             (15 * 5)
+#define POWER_DARK_MW             (1 * 5)
+
+/*** PRIVATE VARIABLES ***/
+static uint16_t s_Rand16Seed = 1337;
+
+static const uint8_t c_Sin8Interleave[8] = {0, 49, 49, 41, 90, 27, 117, 10};
+static const uint16_t c_Sin16Base[8] = {0, 6393, 12539, 18204, 23170, 27245, 30273, 32137};
+static const uint8_t c_Sin16Slope[8] = {49, 48, 44, 38, 31, 23, 14, 4};
+
+/*** PUBLIC VARIABLES ***/
+CFastLED FastLED;
+
+const TProgmemRGBPalette16 OceanColors_p =
+{
+  0x191970, 0x00008B, 0x191970, 0x000080, 0x00008B, 0x0000CD, 0x2E8B57, 0x008080,
+  0x5F9EA0, 0x0000FF, 0x008B8B, 0x6495ED, 0x7FFFD4, 0x2E8B57, 0x00FFFF, 0x87CEFA
+};
+
+const TProgmemRGBPalette16 LavaColors_p =
+{
+  0x000000, 0x800000, 0x000000, 0x800000, 0x8B0000, 0x800000, 0x8B0000, 0x8B0000,
+  0x8B0000, 0xFF0000, 0xFFA500, 0xFFFFFF, 0xFFA500, 0xFF0000, 0x8B0000, 0x000000
+};
+
+const TProgmemRGBPalette16 ForestColors_p =
+{
+  0x006400, 0x006400, 0x556B2F, 0x006400, 0x008000, 0x228B22, 0x6B8E23, 0x008000,
+  0x2E8B57, 0x66CDAA, 0x32CD32, 0x9ACD32, 0x90EE90, 0x7CFC00, 0x66CDAA, 0x228B22
+};
+
+const TProgmemRGBPalette16 RainbowColors_p =
+{
+  0xFF0000, 0xD52A00, 0xAB5500, 0xAB7F00, 0xABAB00, 0x56D500, 0x00FF00, 0x00D52A,
+  0x00AB55, 0x0056AA, 0x0000FF, 0x2A00D5, 0x5500AB, 0x7F0081, 0xAB0055, 0xD5002B
+};
+
+/*** PUBLIC FUNCTIONS ***/
+
+// CRGB
+CRGB::CRGB(const CHSV &inHsv)
+{
+  hsv2rgb_rainbow(inHsv, *this);
+}
+
+CRGB &CRGB::operator=(const CHSV &inHsv)
+{
+  hsv2rgb_rainbow(inHsv, *this);
+  return *this;
+}
+
+CRGB &CRGB::operator+=(const CRGB &inRhs)
+{
+  r = qadd8(r, inRhs.r);
+  g = qadd8(g, inRhs.g);
+  b = qadd8(b, inRhs.b);
+  return *this;
+}
+
+CRGB &CRGB::operator-=(const CRGB &inRhs)
+{
+  r = qsub8(r, inRhs.r);
+  g = qsub8(g, inRhs.g);
+  b = qsub8(b, inRhs.b);
+  return *this;
+}
+
+CRGB &CRGB::operator|=(const CRGB &inRhs)
+{
+  r = (inRhs.r > r) ? inRhs.r : r;
+  g = (inRhs.g > g) ? inRhs.g : g;
+  b = (inRhs.b > b) ? inRhs.b : b;
+  return *this;
+}
+
+CRGB &CRGB::operator&=(const CRGB &inRhs)
+{
+  r = (inRhs.r < r) ? inRhs.r : r;
+  g = (inRhs.g < g) ? inRhs.g : g;
+  b = (inRhs.b < b) ? inRhs.b : b;
+  return *this;
+}
+
+// nscale8x3() with FASTLED_SCALE8_FIXED
+CRGB &CRGB::nscale8(uint8_t inScale)
+{
+  uint16_t lvScale = (uint16_t)inScale + 1;
+  r = (r * lvScale) >> 8;
+  g = (g * lvScale) >> 8;
+  b = (b * lvScale) >> 8;
+  return *this;
+}
+
+CRGB &CRGB::nscale8_video(uint8_t inScale)
+{
+  uint8_t lvNonZero = (inScale != 0) ? 1 : 0;
+  r = (r == 0) ? 0 : (((int)r * (int)inScale) >> 8) + lvNonZero;
+  g = (g == 0) ? 0 : (((int)g * (int)inScale) >> 8) + lvNonZero;
+  b = (b == 0) ? 0 : (((int)b * (int)inScale) >> 8) + lvNonZero;
+  return *this;
+}
+
+CRGB &CRGB::fadeToBlackBy(uint8_t inFade)
+{
+  return nscale8(255 - inFade);
+}
+
+uint8_t CRGB::getAverageLight() const
+{
+  const uint8_t lvEquals = 0x55;  // 1/3
+  return scale8(r, lvEquals) + scale8(g, lvEquals) + scale8(b, lvEquals);
+}
+
+bool operator==(const CRGB &inLhs, const CRGB &inRhs)
+{
+  return (inLhs.r == inRhs.r) && (inLhs.g == inRhs.g) && (inLhs.b == inRhs.b);
+}
+
+bool operator!=(const CRGB &inLhs, const CRGB &inRhs)
+{
+  return !(inLhs == inRhs);
+}
+
+CRGB operator+(const CRGB &inLhs, const CRGB &inRhs)
+{
+  return CRGB(qadd8(inLhs.r, inRhs.r), qadd8(inLhs.g, inRhs.g), qadd8(inLhs.b, inRhs.b));
+}
+
+CRGB operator-(const CRGB &inLhs, const CRGB &inRhs)
+{
+  return CRGB(qsub8(inLhs.r, inRhs.r), qsub8(inLhs.g, inRhs.g), qsub8(inLhs.b, inRhs.b));
+}
+
+static uint16_t CRGB_Sum(const CRGB &inColor)
+{
+  return inColor.r + inColor.g + inColor.b;
+}
+
+bool operator<(const CRGB &inLhs, const CRGB &inRhs)
+{
+  return CRGB_Sum(inLhs) < CRGB_Sum(inRhs);
+}
+
+bool operator>(const CRGB &inLhs, const CRGB &inRhs)
+{
+  return CRGB_Sum(inLhs) > CRGB_Sum(inRhs);
+}
+
+bool operator<=(const CRGB &inLhs, const CRGB &inRhs)
+{
+  return CRGB_Sum(inLhs) <= CRGB_Sum(inRhs);
+}
+
+bool operator>=(const CRGB &inLhs, const CRGB &inRhs)
+{
+  return CRGB_Sum(inLhs) >= CRGB_Sum(inRhs);
+}
+
+// Palettes
+CRGBPalette16::CRGBPalette16(const TProgmemRGBPalette16 &inPalette)
+{
+  for (uint8_t i = 0; i < 16; i++)
+  {
+    entries[i] = CRGB(inPalette[i]);
+  }
+}
+
+// Gradient entries are index, r, g, b; the last one has index 255. Each gradient segment fills the entries of its
+// index range / 16, with fewer than 16 entries every segment gets at least the entry after the previous segment.
+CRGBPalette16 &CRGBPalette16::operator=(TProgmemRGBGradientPalette_bytes inGradient)
+{
+  const uint8_t *lvEntry = inGradient;
+  uint16_t lvCount = 0;
+  int8_t lvLastSlotUsed = -1;
+
+  do
+  {
+    lvCount++;
+  } while (inGradient[(lvCount - 1) * 4] != 255);
+
+  CRGB lvStartColor(lvEntry[1], lvEntry[2], lvEntry[3]);
+  int lvStartIndex = 0;
+  while (lvStartIndex < 255)
+  {
+    lvEntry += 4;
+    int lvEndIndex = lvEntry[0];
+    CRGB lvEndColor(lvEntry[1], lvEntry[2], lvEntry[3]);
+    uint8_t lvStart16 = lvStartIndex / 16;
+    uint8_t lvEnd16 = lvEndIndex / 16;
+    if (lvCount < 16)
+    {
+      if ((lvStart16 <= lvLastSlotUsed) && (lvLastSlotUsed < 15))
+      {
+        lvStart16 = lvLastSlotUsed + 1;
+        if (lvEnd16 < lvStart16)
+        {
+          lvEnd16 = lvStart16;
+        }
+      }
+      lvLastSlotUsed = lvEnd16;
+    }
+    fill_gradient_RGB(entries, lvStart16, lvStartColor, lvEnd16, lvEndColor);
+    lvStartIndex = lvEndIndex;
+    lvStartColor = lvEndColor;
+  }
+  return *this;
+}
+
+// UpscalePalette(): every entry interpolated like ColorFromPalette(..., LINEARBLEND)
+CRGBPalette256 &CRGBPalette256::operator=(const CRGBPalette16 &inPalette)
+{
+  for (int i = 0; i < 256; i++)
+  {
+    entries[i] = ColorFromPalette(inPalette, i);
+  }
+  return *this;
+}
+
+CRGBPalette256 &CRGBPalette256::operator=(const TProgmemRGBPalette16 &inPalette)
+{
+  return *this = CRGBPalette16(inPalette);
+}
+
+// Gradient entries are index, r, g, b; the last one has index 255
+CRGBPalette256 &CRGBPalette256::operator=(TProgmemRGBGradientPalette_bytes inGradient)
+{
+  const uint8_t *lvEntry = inGradient;
+  CRGB lvStartColor(lvEntry[1], lvEntry[2], lvEntry[3]);
+  int lvStartIndex = 0;
+
+  while (lvStartIndex < 255)
+  {
+    lvEntry += 4;
+    int lvEndIndex = lvEntry[0];
+    CRGB lvEndColor(lvEntry[1], lvEntry[2], lvEntry[3]);
+    fill_gradient_RGB(entries, lvStartIndex, lvStartColor, lvEndIndex, lvEndColor);
+    lvStartIndex = lvEndIndex;
+    lvStartColor = lvEndColor;
+  }
+  return *this;
+}
+
+// Controller
+void CFastLED::show()
+{
+  show(m_Brightness);
+}
+
+void CFastLED::show(uint8_t inScale)
+{
+  (void)inScale;
+  m_ShowCount++;
+  m_PixelCount += m_Controller.size();
+}
+
+void CFastLED::clear(bool inWriteData)
+{
+  if (m_Controller.leds() != NULL)
+  {
+    fill_solid(m_Controller.leds(), m_Controller.size(), CRGB(0, 0, 0));
+  }
+  if (inWriteData)
+  {
+    show(0);
+  }
+}
+
+// lib8tion
+uint8_t blend8(uint8_t inA, uint8_t inB, uint8_t inAmountOfB)
+{
+  uint8_t lvAmountOfA = 255 - inAmountOfB;
+  uint16_t lvPartial = (inA * lvAmountOfA) + inA;
+  lvPartial += (inB * inAmountOfB) + inB;
+  return lvPartial >> 8;
+}
+
+uint8_t sin8(uint8_t inTheta)
+{
+  uint8_t lvOffset = inTheta;
+  if (inTheta & 0x40)
+  {
+    lvOffset = (uint8_t)255 - lvOffset;
+  }
+  lvOffset &= 0x3F;
+
+  uint8_t lvSecOffset = lvOffset & 0x0F;
+  if (inTheta & 0x40)
+  {
+    lvSecOffset++;
+  }
+
+  uint8_t lvSection = lvOffset >> 4;
+  uint8_t lvB = c_Sin8Interleave[lvSection * 2];
+  uint8_t lvM16 = c_Sin8Interleave[(lvSection * 2) + 1];
+  uint8_t lvMx = (lvM16 * lvSecOffset) >> 4;
+
+  int8_t lvY = lvMx + lvB;
+  if (inTheta & 0x80)
+  {
+    lvY = -lvY;
+  }
+  lvY += 128;
+  return lvY;
+}
+
+int16_t sin16(uint16_t inTheta)
+{
+  uint16_t lvOffset = (inTheta & 0x3FFF) >> 3;
+  if (inTheta & 0x4000)
+  {
+    lvOffset = 2047 - lvOffset;
+  }
+
+  uint8_t lvSection = lvOffset / 256;
+  uint16_t lvB = c_Sin16Base[lvSection];
+  uint8_t lvM = c_Sin16Slope[lvSection];
+  uint8_t lvSecOffset8 = (uint8_t)(lvOffset) / 2;
+
+  uint16_t lvMx = lvM * lvSecOffset8;
+  int16_t lvY = lvMx + lvB;
+  if (inTheta & 0x8000)
+  {
+    lvY = -lvY;
+  }
+  return lvY;
+}
+
+uint16_t random16()
+{
+  s_Rand16Seed = (s_Rand16Seed * 2053) + 13849;
+  return s_Rand16Seed;
+}
+
+uint16_t random16(uint16_t inLimit)
+{
+  return ((uint32_t)inLimit * (uint32_t)random16()) >> 16;
+}
+
+uint16_t random16(uint16_t inMin, uint16_t inLimit)
+{
+  return random16(inLimit - inMin) + inMin;
+}
+
+uint8_t random8()
+{
+  random16();
+  return (uint8_t)((uint8_t)(s_Rand16Seed & 0xFF) + (uint8_t)(s_Rand16Seed >> 8));
+}
+
+uint8_t random8(uint8_t inLimit)
+{
+  return (random8() * inLimit) >> 8;
+}
+
+uint8_t random8(uint8_t inMin, uint8_t inLimit)
+{
+  return random8(inLimit - inMin) + inMin;
+}
+
+void random16_set_seed(uint16_t inSeed)
+{
+  s_Rand16Seed = inSeed;
+}
+
+uint16_t random16_get_seed()
+{
+  return s_Rand16Seed;
+}
+
+void random16_add_entropy(uint16_t inEntropy)
+{
+  s_Rand16Seed += inEntropy;
+}
+
+// Colors
+void hsv2rgb_rainbow(const CHSV &inHsv, CRGB &outRgb)
+{
+  uint8_t lvHue = inHsv.hue;
+  uint8_t lvSat = inHsv.sat;
+  uint8_t lvVal = inHsv.val;
+  uint8_t lvOffset8 = (lvHue & 0x1F) << 3;
+  uint8_t lvThird = scale8(lvOffset8, (256 / 3));
+  uint8_t lvTwoThirds = scale8(lvOffset8, ((256 * 2) / 3));
+  uint8_t r, g, b;
+
+  // moderate yellow boost (Y1), no green scaling
+  switch (lvHue >> 5)
+  {
+    case 0: r = K255 - lvThird;       g = lvThird;                b = 0;                  break;  // R -> O
+    case 1: r = K171;                 g = K85 + lvThird;          b = 0;                  break;  // O -> Y
+    case 2: r = K171 - lvTwoThirds;   g = K170 + lvThird;         b = 0;                  break;  // Y -> G
+    case 3: r = 0;                    g = K255 - lvThird;         b = lvThird;            break;  // G -> A
+    case 4: r = 0;                    g = K171 - lvTwoThirds;     b = K85 + lvTwoThirds;  break;  // A -> B
+    case 5: r = lvThird;              g = 0;                      b = K255 - lvThird;     break;  // B -> P
+    case 6: r = K85 + lvThird;        g = 0;                      b = K171 - lvThird;     break;  // P -> K
+    default: r = K170 + lvThird;      g = 0;                      b = K85 - lvThird;      break;  // K -> R
+  }
+
+  if (lvSat != 255)
+  {
+    if (lvSat == 0)
+    {
+      r = 255;
+      g = 255;
+      b = 255;
+    }
+    else
+    {
+      if (r) r = scale8(r, lvSat);
+      if (g) g = scale8(g, lvSat);
+      if (b) b = scale8(b, lvSat);
+
+      uint8_t lvDesat = 255 - lvSat;
+      lvDesat = scale8(lvDesat, lvDesat);
+      r += lvDesat;
+      g += lvDesat;
+      b += lvDesat;
+    }
+  }
+
+  if (lvVal != 255)
+  {
+    lvVal = scale8_video(lvVal, lvVal);
+    if (lvVal == 0)
+    {
+      r = 0;
+      g = 0;
+      b = 0;
+    }
+    else
+    {
+      if (r) r = scale8(r, lvVal);
+      if (g) g = scale8(g, lvVal);
+      if (b) b = scale8(b, lvVal);
+    }
+  }
+
+  outRgb.r = r;
+  outRgb.g = g;
+  outRgb.b = b;
+}
+
+void hsv2rgb_rainbow(const CHSV *inHsv, CRGB *outRgb, int inNumLeds)
+{
+  for (int i = 0; i < inNumLeds; i++)
+  {
+    hsv2rgb_rainbow(inHsv[i], outRgb[i]);
+  }
+}
+
+// hsv2rgb_raw_C(): three 64 step sections
+void hsv2rgb_raw(const CHSV &inHsv, CRGB &outRgb)
+{
+  uint8_t lvValue = inHsv.val;
+  uint8_t lvInvSat = 255 - inHsv.sat;
+  uint8_t lvBrightnessFloor = (lvValue * lvInvSat) / 256;
+  uint8_t lvColorAmplitude = lvValue - lvBrightnessFloor;
+  uint8_t lvSection = inHsv.hue / 0x40;
+  uint8_t lvOffset = inHsv.hue % 0x40;
+  uint8_t lvRampUp = lvOffset;
+  uint8_t lvRampDown = (0x40 - 1) - lvOffset;
+  uint8_t lvRampUpAdj = ((lvRampUp * lvColorAmplitude) / (256 / 4)) + lvBrightnessFloor;
+  uint8_t lvRampDownAdj = ((lvRampDown * lvColorAmplitude) / (256 / 4)) + lvBrightnessFloor;
+
+  if (lvSection == 0)
+  {
+    outRgb = CRGB(lvRampDownAdj, lvRampUpAdj, lvBrightnessFloor);
+  }
+  else if (lvSection == 1)
+  {
+    outRgb = CRGB(lvBrightnessFloor, lvRampDownAdj, lvRampUpAdj);
+  }
+  else
+  {
+    outRgb = CRGB(lvRampUpAdj, lvBrightnessFloor, lvRampDownAdj);
+  }
+}
+
+void hsv2rgb_spectrum(const CHSV &inHsv, CRGB &outRgb)
+{
+  CHSV lvHsv(scale8(inHsv.hue, 191), inHsv.sat, inHsv.val);
+  hsv2rgb_raw(lvHsv, outRgb);
+}
+
+CRGB &nblend(CRGB &ioExisting, const CRGB &inOverlay, fract8 inAmountOfOverlay)
+{
+  if (inAmountOfOverlay == 0)
+  {
+    return ioExisting;
+  }
+  if (inAmountOfOverlay == 255)
+  {
+    ioExisting = inOverlay;
+    return ioExisting;
+  }
+  ioExisting.r = blend8(ioExisting.r, inOverlay.r, inAmountOfOverlay);
+  ioExisting.g = blend8(ioExisting.g, inOverlay.g, inAmountOfOverlay);
+  ioExisting.b = blend8(ioExisting.b, inOverlay.b, inAmountOfOverlay);
+  return ioExisting;
+}
+
+CRGB blend(const CRGB &inP1, const CRGB &inP2, fract8 inAmountOfP2)
+{
+  CRGB lvResult(inP1);
+  nblend(lvResult, inP2, inAmountOfP2);
+  return lvResult;
+}
+
+CRGB HeatColor(uint8_t inTemperature)
+{
+  uint8_t lvT192 = scale8_video(inTemperature, 191);
+  uint8_t lvHeatRamp = (lvT192 & 0x3F) << 2;
+
+  if (lvT192 & 0x80)
+  {
+    return CRGB(255, 255, lvHeatRamp);
+  }
+  if (lvT192 & 0x40)
+  {
+    return CRGB(255, lvHeatRamp, 0);
+  }
+  return CRGB(lvHeatRamp, 0, 0);
+}
+
+CRGB ColorFromPalette(const CRGBPalette16 &inPalette, uint8_t inIndex, uint8_t inBrightness, TBlendType inBlendType)
+{
+  uint8_t lvHi4 = inIndex >> 4;
+  uint8_t lvLo4 = inIndex & 0x0F;
+  const CRGB *lvEntry = &inPalette.entries[lvHi4];
+  uint8_t r = lvEntry->r;
+  uint8_t g = lvEntry->g;
+  uint8_t b = lvEntry->b;
+
+  if (lvLo4 && (inBlendType != NOBLEND))
+  {
+    lvEntry = (lvHi4 == 15) ? &inPalette.entries[0] : (lvEntry + 1);
+    uint8_t lvF2 = lvLo4 << 4;
+    uint8_t lvF1 = 255 - lvF2;
+    r = scale8(r, lvF1) + scale8(lvEntry->r, lvF2);
+    g = scale8(g, lvF1) + scale8(lvEntry->g, lvF2);
+    b = scale8(b, lvF1) + scale8(lvEntry->b, lvF2);
+  }
+
+  if (inBrightness != 255)
+  {
+    if (inBrightness)
+    {
+      inBrightness++;
+      if (r) r = scale8(r, inBrightness);
+      if (g) g = scale8(g, inBrightness);
+      if (b) b = scale8(b, inBrightness);
+    }
+    else
+    {
+      r = 0;
+      g = 0;
+      b = 0;
+    }
+  }
+  return CRGB(r, g, b);
+}
+
+CRGB ColorFromPalette(const CRGBPalette256 &inPalette, uint8_t inIndex, uint8_t inBrightness, TBlendType inBlendType)
+{
+  (void)inBlendType;
+  CRGB lvColor = inPalette.entries[inIndex];
+  if (inBrightness != 255)
+  {
+    lvColor.nscale8_video(inBrightness);
+  }
+  return lvColor;
+}
+
+void fill_solid(CRGB *outLEDs, int inNumLeds, const CRGB &inColor)
+{
+  for (int i = 0; i < inNumLeds; i++)
+  {
+    outLEDs[i] = inColor;
+  }
+}
+
+void fill_rainbow(CRGB *outLEDs, int inNumLeds, uint8_t inInitialHue, uint8_t inDeltaHue)
+{
+  CHSV lvHsv(inInitialHue, 240, 255);
+  for (int i = 0; i < inNumLeds; i++)
+  {
+    outLEDs[i] = lvHsv;
+    lvHsv.hue += inDeltaHue;
+  }
+}
+
+// Q8.8 color accumulators, Q8.7 deltas
+void fill_gradient_RGB(CRGB *outLEDs, uint16_t inStartPos, CRGB inStartColor, uint16_t inEndPos, CRGB inEndColor)
+{
+  if (inEndPos < inStartPos)
+  {
+    uint16_t lvPos = inEndPos;
+    CRGB lvColor = inEndColor;
+    inEndPos = inStartPos;
+    inEndColor = inStartColor;
+    inStartPos = lvPos;
+    inStartColor = lvColor;
+  }
+
+  int16_t lvDivisor = (inEndPos - inStartPos) ? (inEndPos - inStartPos) : 1;
+  saccum87 lvRDelta87 = (saccum87)((inEndColor.r - inStartColor.r) << 7) / lvDivisor;
+  saccum87 lvGDelta87 = (saccum87)((inEndColor.g - inStartColor.g) << 7) / lvDivisor;
+  saccum87 lvBDelta87 = (saccum87)((inEndColor.b - inStartColor.b) << 7) / lvDivisor;
+  lvRDelta87 *= 2;
+  lvGDelta87 *= 2;
+  lvBDelta87 *= 2;
+
+  accum88 lvR88 = inStartColor.r << 8;
+  accum88 lvG88 = inStartColor.g << 8;
+  accum88 lvB88 = inStartColor.b << 8;
+  for (uint16_t i = inStartPos; i <= inEndPos; i++)
+  {
+    outLEDs[i] = CRGB(lvR88 >> 8, lvG88 >> 8, lvB88 >> 8);
+    lvR88 += lvRDelta87;
+    lvG88 += lvGDelta87;
+    lvB88 += lvBDelta87;
+  }
+}
+
+void nscale8(CRGB *ioLEDs, uint16_t inNumLeds, uint8_t inScale)
+{
+  for (uint16_t i = 0; i < inNumLeds; i++)
+  {
+    ioLEDs[i].nscale8(inScale);
+  }
+}
+
+void fadeToBlackBy(CRGB *ioLEDs, uint16_t inNumLeds, uint8_t inFade)
+{
+  nscale8(ioLEDs, inNumLeds, 255 - inFade);
+}
+
+// Every LED keeps 255 - inBlurAmount and gets inBlurAmount / 2 of each neighbour
+void blur1d(CRGB *ioLEDs, uint16_t inNumLeds, fract8 inBlurAmount)
+{
+  uint8_t lvKeep = 255 - inBlurAmount;
+  uint8_t lvSeep = inBlurAmount >> 1;
+  CRGB lvCarryOver = CRGB(0, 0, 0);
+
+  for (uint16_t i = 0; i < inNumLeds; i++)
+  {
+    CRGB lvCurrent = ioLEDs[i];
+    CRGB lvPart = lvCurrent;
+    lvPart.nscale8(lvSeep);
+    lvCurrent.nscale8(lvKeep);
+    lvCurrent += lvCarryOver;
+    if (i > 0)
+    {
+      ioLEDs[i - 1] += lvPart;
+    }
+    ioLEDs[i] = lvCurrent;
+    lvCarryOver = lvPart;
+  }
+}
+
+// Power management
+uint32_t calculate_unscaled_power_mW(const CRGB *inLEDs, uint16_t inNumLeds)
+{
+  uint32_t lvRed = 0;
+  uint32_t lvGreen = 0;
+  uint32_t lvBlue = 0;
+
+  for (uint16_t i = 0; i < inNumLeds; i++)
+  {
+    lvRed += inLEDs[i].r;
+    lvGreen += inLEDs[i].g;
+    lvBlue += inLEDs[i].b;
+  }
+  lvRed = (lvRed * POWER_RED_MW) >> 8;
+  lvGreen = (lvGreen * POWER_GREEN_MW) >> 8;
+  lvBlue = (lvBlue * POWER_BLUE_MW) >> 8;
+  return lvRed + lvGreen + lvBlue + ((uint32_t)POWER_DARK_MW * inNumLeds);
+}
+
+uint8_t calculate_max_brightness_for_power_mW(const CRGB *inLEDs, uint16_t inNumLeds, uint8_t inTargetBrightness, uint32_t inMaxPowerMw)
+{
+  uint32_t lvRequestedMw = (calculate_unscaled_power_mW(inLEDs, inNumLeds) * inTargetBrightness) / 256;
+  if (lvRequestedMw > inMaxPowerMw)
+  {
+    return ((uint32_t)inTargetBrightness * inMaxPowerMw) / lvRequestedMw;
+  }
+  return inTargetBrightness;
+}
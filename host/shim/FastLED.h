@@ -0,0 +1,267 @@
+#ifndef FASTLED_H
+#define FASTLED_H
+
+// The part of FastLED 3.2.1 the sketch uses, for the host build (see host/Makefile).
+// The color and math functions follow the library's portable C code with FASTLED_SCALE8_FIXED, so the
+// programs compute the same pixels as on the controllers. show() does not output anything.
+
+/*** INCLUDES ***/
+#include "Arduino.h"
+
+/*** DEFINES ***/
+#define FASTLED_VERSION           3002001
+#define FASTLED_USING_NAMESPACE
+#define FASTLED_SCALE8_FIXED      1
+
+#define DEFINE_GRADIENT_PALETTE(name)   extern const TProgmemRGBGradientPalette_byte name[]; const TProgmemRGBGradientPalette_byte name[] =
+#define DECLARE_GRADIENT_PALETTE(name)  extern const TProgmemRGBGradientPalette_byte name[]
+
+// Polled like the library's macro, one instance per call site
+#define EVERY_N_MILLISECONDS(n)   for (static unsigned long s_EveryLastMs = 0; (millis() - s_EveryLastMs) >= (n); s_EveryLastMs = millis())
+
+/*** TYPE DEFINITIONS ***/
+typedef uint16_t accum88;
+typedef int16_t saccum87;
+typedef uint8_t fract8;
+
+typedef const uint32_t TProgmemRGBPalette16[16];
+typedef const uint8_t TProgmemRGBGradientPalette_byte;
+typedef const TProgmemRGBGradientPalette_byte *TProgmemRGBGradientPalette_bytes;
+
+enum EOrder { RGB = 0012, RBG = 0021, GRB = 0102, GBR = 0120, BRG = 0201, BGR = 0210 };
+enum ELEDType { WS2811, WS2812, WS2812B, NEOPIXEL };
+enum LEDColorCorrection { TypicalLEDStrip = 0xFFB0F0, UncorrectedColor = 0xFFFFFF };
+enum TBlendType { NOBLEND = 0, LINEARBLEND = 1 };
+
+struct CHSV
+{
+  union
+  {
+    struct
+    {
+      uint8_t hue;
+      uint8_t sat;
+      uint8_t val;
+    };
+    uint8_t raw[3];
+  };
+
+  CHSV() {}
+  CHSV(uint8_t inHue, uint8_t inSat, uint8_t inVal) : hue(inHue), sat(inSat), val(inVal) {}
+};
+
+struct CRGB
+{
+  union
+  {
+    struct
+    {
+      union { uint8_t r; uint8_t red; };
+      union { uint8_t g; uint8_t green; };
+      union { uint8_t b; uint8_t blue; };
+    };
+    uint8_t raw[3];
+  };
+
+  enum HTMLColorCode
+  {
+    Black = 0x000000,
+    Blue = 0x0000FF,
+    Green = 0x008000,
+    Red = 0xFF0000,
+    White = 0xFFFFFF
+  };
+
+  CRGB() {}
+  CRGB(uint8_t inR, uint8_t inG, uint8_t inB) : r(inR), g(inG), b(inB) {}
+  CRGB(uint32_t inColorCode) : r((inColorCode >> 16) & 0xFF), g((inColorCode >> 8) & 0xFF), b(inColorCode & 0xFF) {}
+  CRGB(HTMLColorCode inColorCode) : CRGB((uint32_t)inColorCode) {}
+  CRGB(const CHSV &inHsv);
+  CRGB &operator=(const CHSV &inHsv);
+  CRGB &operator=(uint32_t inColorCode) { *this = CRGB(inColorCode); return *this; }
+
+  uint8_t &operator[](uint8_t inIndex) { return raw[inIndex]; }
+  const uint8_t &operator[](uint8_t inIndex) const { return raw[inIndex]; }
+
+  CRGB &operator+=(const CRGB &inRhs);
+  CRGB &operator-=(const CRGB &inRhs);
+  CRGB &operator|=(const CRGB &inRhs);
+  CRGB &operator&=(const CRGB &inRhs);
+  CRGB &nscale8(uint8_t inScale);
+  CRGB &nscale8_video(uint8_t inScale);
+  CRGB &fadeToBlackBy(uint8_t inFade);
+  uint8_t getAverageLight() const;
+  explicit operator bool() const { return r || g || b; }
+};
+
+bool operator==(const CRGB &inLhs, const CRGB &inRhs);
+bool operator!=(const CRGB &inLhs, const CRGB &inRhs);
+CRGB operator+(const CRGB &inLhs, const CRGB &inRhs);
+CRGB operator-(const CRGB &inLhs, const CRGB &inRhs);
+// by the sum of the channels
+bool operator<(const CRGB &inLhs, const CRGB &inRhs);
+bool operator>(const CRGB &inLhs, const CRGB &inRhs);
+bool operator<=(const CRGB &inLhs, const CRGB &inRhs);
+bool operator>=(const CRGB &inLhs, const CRGB &inRhs);
+
+struct CRGBPalette16
+{
+  CRGB entries[16];
+
+  CRGBPalette16() {}
+  CRGBPalette16(const TProgmemRGBPalette16 &inPalette);
+  CRGBPalette16(TProgmemRGBGradientPalette_bytes inGradient) { *this = inGradient; }
+  CRGBPalette16 &operator=(TProgmemRGBGradientPalette_bytes inGradient);
+  CRGB &operator[](uint8_t inIndex) { return entries[inIndex]; }
+  const CRGB &operator[](uint8_t inIndex) const { return entries[inIndex]; }
+};
+
+struct CRGBPalette256
+{
+  CRGB entries[256];
+
+  CRGBPalette256() {}
+  CRGBPalette256 &operator=(const CRGBPalette16 &inPalette);
+  CRGBPalette256 &operator=(const TProgmemRGBPalette16 &inPalette);
+  CRGBPalette256 &operator=(TProgmemRGBGradientPalette_bytes inGradient);
+  CRGB &operator[](uint8_t inIndex) { return entries[inIndex]; }
+  const CRGB &operator[](uint8_t inIndex) const { return entries[inIndex]; }
+};
+
+class CLEDController
+{
+  public:
+    CLEDController &setCorrection(uint32_t inCorrection) { (void)inCorrection; return *this; }
+    CLEDController &setLeds(CRGB *inLEDs, int inNumLeds) { m_LEDs = inLEDs; m_NumLeds = inNumLeds; return *this; }
+    CRGB *leds() { return m_LEDs; }
+    int size() { return m_NumLeds; }
+
+  private:
+    CRGB *m_LEDs = NULL;
+    int m_NumLeds = 0;
+};
+
+class CFastLED
+{
+  public:
+    template<ELEDType TYPE, uint8_t DATA_PIN, EOrder ORDER> CLEDController &addLeds(CRGB *inLEDs, int inNumLeds, int inOffset = 0)
+    {
+      return m_Controller.setLeds(inLEDs + inOffset, inNumLeds);
+    }
+    CLEDController &operator[](int inIndex) { (void)inIndex; return m_Controller; }
+
+    void setBrightness(uint8_t inBrightness) { m_Brightness = inBrightness; }
+    uint8_t getBrightness() { return m_Brightness; }
+    void setMaxPowerInVoltsAndMilliamps(uint8_t inVolts, uint32_t inMilliamps) { m_MaxPowerMw = inVolts * inMilliamps; }
+    // Counts the frames and pixels that would have been sent
+    void show();
+    void show(uint8_t inScale);
+    void clear(bool inWriteData = false);
+
+    // Host only
+    unsigned long getShowCount() { return m_ShowCount; }
+    unsigned long getPixelCount() { return m_PixelCount; }
+
+  private:
+    CLEDController m_Controller;
+    uint8_t m_Brightness = 255;
+    uint32_t m_MaxPowerMw = 0xFFFFFFFF;
+    unsigned long m_ShowCount = 0;
+    unsigned long m_PixelCount = 0;
+};
+
+/*** PUBLIC VARIABLES ***/
+extern CFastLED FastLED;
+
+extern const TProgmemRGBPalette16 OceanColors_p;
+extern const TProgmemRGBPalette16 LavaColors_p;
+extern const TProgmemRGBPalette16 ForestColors_p;
+extern const TProgmemRGBPalette16 RainbowColors_p;
+
+/*** PUBLIC FUNCTIONS ***/
+// lib8tion
+inline uint8_t qadd8(uint8_t inI, uint8_t inJ) { unsigned int t = inI + inJ; return (t > 255) ? 255 : t; }
+inline uint8_t qsub8(uint8_t inI, uint8_t inJ) { int t = inI - inJ; return (t < 0) ? 0 : t; }
+inline uint8_t scale8(uint8_t inI, fract8 inScale) { return ((uint16_t)inI * (1 + (uint16_t)inScale)) >> 8; }
+inline uint8_t scale8_video(uint8_t inI, fract8 inScale) { return (((int)inI * (int)inScale) >> 8) + ((inI && inScale) ? 1 : 0); }
+inline uint16_t scale16(uint16_t inI, uint16_t inScale) { return ((uint32_t)inI * (1 + (uint32_t)inScale)) / 65536; }
+inline uint8_t triwave8(uint8_t inI) { if (inI & 0x80) { inI = 255 - inI; } return inI << 1; }
+uint8_t blend8(uint8_t inA, uint8_t inB, uint8_t inAmountOfB);
+uint8_t sin8(uint8_t inTheta);
+int16_t sin16(uint16_t inTheta);
+
+uint8_t random8(void);
+uint8_t random8(uint8_t inLimit);
+uint8_t random8(uint8_t inMin, uint8_t inLimit);
+uint16_t random16(void);
+uint16_t random16(uint16_t inLimit);
+uint16_t random16(uint16_t inMin, uint16_t inLimit);
+void random16_set_seed(uint16_t inSeed);
+uint16_t random16_get_seed(void);
+void random16_add_entropy(uint16_t inEntropy);
+
+#ifdef USE_GET_MILLISECOND_TIMER
+uint32_t get_millisecond_timer(void);
+  #define GET_MILLIS                get_millisecond_timer
+#else
+  #define GET_MILLIS                millis
+#endif
+// inline like in the library, so the time source is the one selected by the sketch
+inline uint16_t beat88(accum88 inBpm88, uint32_t inTimebase = 0)
+{
+  return (((GET_MILLIS()) - inTimebase) * inBpm88 * 280) >> 16;
+}
+
+inline uint16_t beat16(accum88 inBpm, uint32_t inTimebase = 0)
+{
+  // plain integer BPM are converted to Q8.8
+  if (inBpm < 256)
+  {
+    inBpm <<= 8;
+  }
+  return beat88(inBpm, inTimebase);
+}
+
+inline uint8_t beat8(accum88 inBpm, uint32_t inTimebase = 0)
+{
+  return beat16(inBpm, inTimebase) >> 8;
+}
+
+inline uint8_t beatsin8(accum88 inBpm, uint8_t inLowest = 0, uint8_t inHighest = 255, uint32_t inTimebase = 0, uint8_t inPhase = 0)
+{
+  uint8_t lvBeat = beat8(inBpm, inTimebase);
+  uint8_t lvBeatSin = sin8(lvBeat + inPhase);
+  return inLowest + scale8(lvBeatSin, inHighest - inLowest);
+}
+
+inline uint16_t beatsin16(accum88 inBpm, uint16_t inLowest = 0, uint16_t inHighest = 65535, uint32_t inTimebase = 0, uint16_t inPhase = 0)
+{
+  uint16_t lvBeat = beat16(inBpm, inTimebase);
+  uint16_t lvBeatSin = sin16(lvBeat + inPhase) + 32768;
+  return inLowest + scale16(lvBeatSin, inHighest - inLowest);
+}
+
+// colors
+void hsv2rgb_rainbow(const CHSV &inHsv, CRGB &outRgb);
+void hsv2rgb_rainbow(const CHSV *inHsv, CRGB *outRgb, int inNumLeds);
+void hsv2rgb_spectrum(const CHSV &inHsv, CRGB &outRgb);
+void hsv2rgb_raw(const CHSV &inHsv, CRGB &outRgb);
+
+CRGB blend(const CRGB &inP1, const CRGB &inP2, fract8 inAmountOfP2);
+CRGB &nblend(CRGB &ioExisting, const CRGB &inOverlay, fract8 inAmountOfOverlay);
+CRGB HeatColor(uint8_t inTemperature);
+CRGB ColorFromPalette(const CRGBPalette16 &inPalette, uint8_t inIndex, uint8_t inBrightness = 255, TBlendType inBlendType = LINEARBLEND);
+CRGB ColorFromPalette(const CRGBPalette256 &inPalette, uint8_t inIndex, uint8_t inBrightness = 255, TBlendType inBlendType = NOBLEND);
+
+void fill_solid(CRGB *outLEDs, int inNumLeds, const CRGB &inColor);
+void fill_rainbow(CRGB *outLEDs, int inNumLeds, uint8_t inInitialHue, uint8_t inDeltaHue = 5);
+void fill_gradient_RGB(CRGB *outLEDs, uint16_t inStartPos, CRGB inStartColor, uint16_t inEndPos, CRGB inEndColor);
+void nscale8(CRGB *ioLEDs, uint16_t inNumLeds, uint8_t inScale);
+void fadeToBlackBy(CRGB *ioLEDs, uint16_t inNumLeds, uint8_t inFade);
+void blur1d(CRGB *ioLEDs, uint16_t inNumLeds, fract8 inBlurAmount);
+
+// power management
+uint32_t calculate_unscaled_power_mW(const CRGB *inLEDs, uint16_t inNumLeds);
+uint8_t calculate_max_brightness_for_power_mW(const CRGB *inLEDs, uint16_t inNumLeds, uint8_t inTargetBrightness, uint32_t inMaxPowerMw);
+
+#endif //FASTLED_H
@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+"""Captures of a realtime sender for the receive path of the host build (xmaslights --pcap), written directly as pcap
+files with Ethernet, IPv4 and UDP headers, like a capture of a sender on the Linux loopback interface.
+
+  make_pcap.py e131 <leds> <frames> <out.pcap>     E1.31 data packets, 170 LEDs per universe from universe 1
+  make_pcap.py ddp <leds> <frames> <out.pcap>      DDP packets of up to 480 LEDs, the last one of a frame pushes it
+  make_pcap.py artnet <leds> <frames> <out.pcap>   ArtDmx, 170 LEDs per universe from port-address 0, and an ArtSync
+
+The pixels are a ramp that moves by one per frame, so each frame differs from the previous one.
+"""
+
+import struct
+import sys
+
+E131_PORT = 5568
+E131_CHANNELS_PER_UNIVERSE = 510        # E131_MAX_CHANNELS_PER_UNIVERSE, whole pixels only
+E131_CID = bytes(range(16))
+DDP_PORT = 4048
+DDP_MAX_DATA_LENGTH = 1440
+ARTNET_PORT = 6454
+
+LINK_ETHERNET = 1
+
+
+def pixels(frame, leds):
+    return bytes((frame + i) & 0xff for i in range(leds * 3))
+
+
+def e131_packet(universe, sequence, slots):
+    # root layer, framing layer, DMP layer (ANSI E1.31-2016)
+    length = 126 + len(slots)
+    packet = struct.pack(">HH12sHI16s", 0x0010, 0, b"ASC-E1.17\0\0\0", 0x7000 | (length - 16), 0x00000004, E131_CID)
+    packet += struct.pack(">HI64sBHBBH", 0x7000 | (length - 38), 0x00000002, b"make_pcap.py", 100, 0, sequence & 0xff,
+                          0, universe)
+    packet += struct.pack(">HBBHHHB", 0x7000 | (length - 115), 0x02, 0xa1, 0, 1, len(slots) + 1, 0)
+    return packet + slots
+
+
+def e131(leds, frames):
+    packets = []
+    for frame in range(frames):
+        data = pixels(frame, leds)
+        for universe, start in enumerate(range(0, len(data), E131_CHANNELS_PER_UNIVERSE), 1):
+            packets.append((E131_PORT, e131_packet(universe, frame, data[start:start + E131_CHANNELS_PER_UNIVERSE])))
+    return packets
+
+
+def ddp_packet(sequence, offset, data, push):
+    # version 1, RGB 8 bits per element, display
+    return struct.pack(">BBBBIH", 0x40 | (0x01 if push else 0), (sequence % 15) + 1, 0x0b, 1, offset, len(data)) + data
+
+
+def ddp(leds, frames):
+    packets = []
+    for frame in range(frames):
+        data = pixels(frame, leds)
+        for offset in range(0, len(data), DDP_MAX_DATA_LENGTH):
+            chunk = data[offset:offset + DDP_MAX_DATA_LENGTH]
+            packets.append((DDP_PORT, ddp_packet(frame, offset, chunk, (offset + len(chunk)) == len(data))))
+    return packets
+
+
+def artnet_packet(opcode, body):
+    # op code little endian, protocol version 14
+    return b"Art-Net\0" + struct.pack("<H", opcode) + struct.pack(">H", 14) + body
+
+
+def artnet(leds, frames):
+    packets = []
+    for frame in range(frames):
+        data = pixels(frame, leds)
+        for port_address, start in enumerate(range(0, len(data), E131_CHANNELS_PER_UNIVERSE)):
+            slots = data[start:start + E131_CHANNELS_PER_UNIVERSE]
+            # ArtDmx: sequence 1..255, physical port, sub-net and universe, net, length
+            body = struct.pack(">BBBBH", (frame % 255) + 1, 0, port_address & 0xff, port_address >> 8, len(slots))
+            packets.append((ARTNET_PORT, artnet_packet(0x5000, body + slots)))
+        packets.append((ARTNET_PORT, artnet_packet(0x5200, bytes(2))))
+    return packets
+
+
+def udp_record(port, payload):
+    udp = struct.pack(">HHHH", 40000, port, 8 + len(payload), 0) + payload
+    # checksums are not checked by the replay
+    ip = struct.pack(">BBHHHBBH4s4s", 0x45, 0, 20 + len(udp), 0, 0x4000, 64, 17, 0, bytes([127, 0, 0, 1]),
+                     bytes([127, 0, 0, 1]))
+    return bytes(12) + struct.pack(">H", 0x0800) + ip + udp
+
+
+def write_pcap(path, packets):
+    with open(path, "wb") as pcap:
+        pcap.write(struct.pack("<IHHiIII", 0xa1b2c3d4, 2, 4, 0, 0, 65535, LINK_ETHERNET))
+        for n, (port, payload) in enumerate(packets):
+            record = udp_record(port, payload)
+            # 1 ms per datagram
+            pcap.write(struct.pack("<IIII", n // 1000, (n % 1000) * 1000, len(record), len(record)))
+            pcap.write(record)
+
+
+def main(args):
+    if (len(args) == 4) and (args[0] == "e131"):
+        write_pcap(args[3], e131(int(args[1]), int(args[2])))
+        return 0
+    if (len(args) == 4) and (args[0] == "ddp"):
+        write_pcap(args[3], ddp(int(args[1]), int(args[2])))
+        return 0
+    if (len(args) == 4) and (args[0] == "artnet"):
+        write_pcap(args[3], artnet(int(args[1]), int(args[2])))
+        return 0
+    sys.stderr.write(__doc__)
+    return 1
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+"""Test signals for the audio analysis of the host build (xmaslights --wav), 16 bit PCM mono.
+
+  make_wav.py sweep <out.wav>         2 s logarithmic sweep 40 Hz .. 8 kHz at half scale: each octave band in turn
+  make_wav.py kicks <bpm> <out.wav>   20 s of kick drums at a fixed tempo over low noise: the beat tracker of AudioBus
+"""
+
+import math
+import random
+import struct
+import sys
+import wave
+
+SAMPLE_RATE = 20480         # AUDIO_SAMPLE_RATE of the ESP32 capture
+
+
+def sweep(seconds=2.0, start_hz=40.0, end_hz=8000.0, amplitude=0.5):
+    samples = []
+    num = int(seconds * SAMPLE_RATE)
+    rate = math.log(end_hz / start_hz) / seconds
+    for i in range(num):
+        t = i / SAMPLE_RATE
+        # phase of an exponential chirp
+        phase = 2 * math.pi * start_hz * (math.exp(rate * t) - 1) / rate
+        samples.append(amplitude * math.sin(phase))
+    return samples
+
+
+def kicks(bpm, seconds=20.0):
+    # an 80 Hz kick and a short noise burst per beat, decaying within ~100 ms
+    noise = random.Random(1)
+    beat = 60.0 / bpm
+    samples = []
+    for i in range(int(seconds * SAMPLE_RATE)):
+        t = i / SAMPLE_RATE
+        phase = math.fmod(t, beat)
+        kick = 0.6 * math.exp(-phase * 30) * math.sin(2 * math.pi * 80 * phase)
+        burst = 0.2 * math.exp(-phase * 60) * noise.uniform(-1.0, 1.0)
+        samples.append(0.01 * noise.uniform(-1.0, 1.0) + kick + burst)
+    return samples
+
+
+def write_wav(path, samples):
+    with wave.open(path, "wb") as wav:
+        wav.setnchannels(1)
+        wav.setsampwidth(2)
+        wav.setframerate(SAMPLE_RATE)
+        wav.writeframes(b"".join(struct.pack("<h", int(round(max(-1.0, min(1.0, s)) * 32767))) for s in samples))
+
+
+def main(args):
+    if (len(args) == 2) and (args[0] == "sweep"):
+        write_wav(args[1], sweep())
+        return 0
+    if (len(args) == 3) and (args[0] == "kicks"):
+        write_wav(args[2], kicks(float(args[1])))
+        return 0
+    sys.stderr.write(__doc__)
+    return 1
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))